@@ -10,6 +10,8 @@
 
 
 MObject AttachmentConstraint::relative;
+MObject AttachmentConstraint::blendMode;
+MObject AttachmentConstraint::slerpPrecision;
 MObject AttachmentConstraint::restTranslate;
 MObject AttachmentConstraint::restTranslateX;
 MObject AttachmentConstraint::restTranslateY;
@@ -48,6 +50,7 @@ MObject AttachmentConstraint::constraintInverseMatrix;
 MObject AttachmentConstraint::constraintWorldMatrix;
 MObject AttachmentConstraint::constraintWorldInverseMatrix;
 MObject AttachmentConstraint::constraintParentInverseMatrix;
+MObject AttachmentConstraint::evaluatedTargets;
 
 MString	AttachmentConstraint::inputCategory("Input");
 MString	AttachmentConstraint::restCategory("Rest");
@@ -80,6 +83,8 @@ Only these values should be used when performing computations!
 
 	MStatus status;
 
+	MAXFORM_PROFILE_COMPUTE("AttachmentConstraint::compute", this->thisMObject());
+
 	// Check requested attribute
 	//
 	MObject attribute = plug.attribute(&status);
@@ -91,199 +96,389 @@ Only these values should be used when performing computations!
 	if (fnAttribute.hasCategory(AttachmentConstraint::outputCategory))
 	{
 
-		// Get input data handles
+		// Get constraint matrices
+		// Any subsequent output requests within the same evaluation are derived from the cached matrices!
 		//
-		MDataHandle relativeHandle = data.inputValue(AttachmentConstraint::relative, &status);
+		MDGContext context = data.context(&status);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle offsetTranslateHandle = data.inputValue(AttachmentConstraint::offsetTranslate, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		MMatrix constraintMatrix, constraintWorldMatrix;
+		bool isCached = this->cache.get(context, constraintMatrix, constraintWorldMatrix);
+		MAXFORM_RECORD_CACHE_ACCESS(isCached);
 
-		MDataHandle offsetRotateHandle = data.inputValue(AttachmentConstraint::offsetRotate, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		if (!isCached)
+		{
 
-		MDataHandle enableRestPositionHandle = data.inputValue(AttachmentConstraint::enableRestPosition, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			status = this->computeMatrices(data, constraintMatrix, constraintWorldMatrix);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle restTranslateHandle = data.inputValue(AttachmentConstraint::restTranslate, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			this->cache.set(context, constraintMatrix, constraintWorldMatrix);
 
-		MDataHandle restRotateHandle = data.inputValue(AttachmentConstraint::restRotate, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		}
 
-		MDataHandle constraintParentInverseMatrixHandle = data.inputValue(AttachmentConstraint::constraintParentInverseMatrix, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		// Update requested output
+		//
+		MObject output = plug.isChild() ? plug.parent().attribute() : attribute;
 
-		MDataHandle constraintRotateOrderHandle = data.inputValue(AttachmentConstraint::constraintRotateOrder, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		if (output == AttachmentConstraint::constraintTranslate)
+		{
 
-		MArrayDataHandle targetArrayHandle = data.inputArrayValue(AttachmentConstraint::target, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			MDataHandle constraintTranslateXHandle = data.outputValue(AttachmentConstraint::constraintTranslateX, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		// Get values from handles
-		//
-		bool relative = relativeHandle.asBool();
-		MVector offsetRotate = offsetRotateHandle.asVector();
-		MMatrix offsetMatrix = relative ? Maxformations::createRotationMatrix(offsetRotate) : MMatrix::identity;
-
-		MEulerRotation::RotationOrder constraintRotateOrder = MEulerRotation::RotationOrder(constraintRotateOrderHandle.asShort());
-		MMatrix constraintParentInverseMatrix = constraintParentInverseMatrixHandle.asMatrix();
-		MMatrix constraintParentMatrix = constraintParentInverseMatrix.inverse();
-
-		bool restEnabled = enableRestPositionHandle.asBool();
-		MVector restTranslate = restTranslateHandle.asVector();
-		MMatrix restTranslateMatrix = Maxformations::createPositionMatrix(restTranslate);
-		MVector restRotate = restRotateHandle.asVector();
-		MMatrix restRotateMatrix = Maxformations::createRotationMatrix(restRotate, constraintRotateOrder);
-		MMatrix restMatrix = restEnabled ? (restRotateMatrix * restTranslateMatrix) : MMatrix::identity;
-		MMatrix restWorldMatrix = restMatrix * constraintParentMatrix;
-
-		// Collect target matrices
-		//
-		unsigned int targetCount = targetArrayHandle.elementCount();
-		MFloatArray targetWeights = MFloatArray(targetCount);
-		MMatrixArray targetMatrices = MMatrixArray(targetCount);
+			MDataHandle constraintTranslateYHandle = data.outputValue(AttachmentConstraint::constraintTranslateY, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			MDataHandle constraintTranslateZHandle = data.outputValue(AttachmentConstraint::constraintTranslateZ, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			MVector constraintTranslate = Maxformations::matrixToPosition(constraintMatrix);
 
-		MDataHandle  targetHandle, targetWeightHandle, targetFaceHandle, targetCoordHandle, targetCoordXHandle, targetCoordYHandle, targetMeshHandle;
+			constraintTranslateXHandle.setMDistance(MDistance(constraintTranslate.x, MDistance::kCentimeters));
+			constraintTranslateYHandle.setMDistance(MDistance(constraintTranslate.y, MDistance::kCentimeters));
+			constraintTranslateZHandle.setMDistance(MDistance(constraintTranslate.z, MDistance::kCentimeters));
 
-		MObject targetMesh;
-		unsigned int targetFace;
-		MVector targetCoord, targetTangent, targetBinormal;
-		MPoint targetPosition;
-		float targetCoordX, targetCoordY;
-		MMatrix targetMatrix;
+			constraintTranslateXHandle.setClean();
+			constraintTranslateYHandle.setClean();
+			constraintTranslateZHandle.setClean();
 
-		for (unsigned int i = 0; i < targetCount; i++)
+		}
+		else if (output == AttachmentConstraint::constraintRotate)
 		{
 
-			// Jump to array element
-			//
-			status = targetArrayHandle.jumpToArrayElement(i);
+			MDataHandle constraintRotateOrderHandle = data.inputValue(AttachmentConstraint::constraintRotateOrder, &status);
 			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-			targetHandle = targetArrayHandle.inputValue(&status);
+			MDataHandle constraintRotateXHandle = data.outputValue(AttachmentConstraint::constraintRotateX, &status);
 			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-			// Get target data handles
-			//
-			targetWeightHandle = targetHandle.child(AttachmentConstraint::targetWeight);
-			targetFaceHandle = targetHandle.child(AttachmentConstraint::targetFace);
-			targetCoordHandle = targetHandle.child(AttachmentConstraint::targetCoord);
-			targetCoordXHandle = targetCoordHandle.child(AttachmentConstraint::targetCoordX);
-			targetCoordYHandle = targetCoordHandle.child(AttachmentConstraint::targetCoordY);
-			targetMeshHandle = targetHandle.child(AttachmentConstraint::targetMesh);
-
-			// Get weight value
-			//
-			targetWeights[i] = Maxformations::clamp(targetWeightHandle.asFloat(), 0.0f, 100.0f) / 100.0;
+			MDataHandle constraintRotateYHandle = data.outputValue(AttachmentConstraint::constraintRotateY, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-			// Get curve parameter
-			//
-			targetMesh = targetMeshHandle.asMesh();
-			targetFace = targetFaceHandle.asLong();
-			targetCoordX = targetCoordXHandle.asFloat();
-			targetCoordY = targetCoordYHandle.asFloat();
-			targetCoord = MVector(targetCoordX, targetCoordY, 1.0f - (targetCoordX + targetCoordY));
+			MDataHandle constraintRotateZHandle = data.outputValue(AttachmentConstraint::constraintRotateZ, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			MEulerRotation::RotationOrder constraintRotateOrder = MEulerRotation::RotationOrder(constraintRotateOrderHandle.asShort());
+			MEulerRotation constraintRotate = Maxformations::matrixToEulerRotation(constraintMatrix, constraintRotateOrder);
+
+			constraintRotateXHandle.setMAngle(MAngle(constraintRotate.x, MAngle::kRadians));
+			constraintRotateYHandle.setMAngle(MAngle(constraintRotate.y, MAngle::kRadians));
+			constraintRotateZHandle.setMAngle(MAngle(constraintRotate.z, MAngle::kRadians));
+
+			constraintRotateXHandle.setClean();
+			constraintRotateYHandle.setClean();
+			constraintRotateZHandle.setClean();
+
+		}
+		else if (output == AttachmentConstraint::constraintMatrix)
+		{
+
+			MDataHandle constraintMatrixHandle = data.outputValue(AttachmentConstraint::constraintMatrix, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			constraintMatrixHandle.setMMatrix(constraintMatrix);
+			constraintMatrixHandle.setClean();
+
+		}
+		else if (output == AttachmentConstraint::constraintInverseMatrix)
+		{
 
-			// Compose transform matrix
+			MDataHandle constraintInverseMatrixHandle = data.outputValue(AttachmentConstraint::constraintInverseMatrix, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			constraintInverseMatrixHandle.setMMatrix(Maxformations::invertMatrix(constraintMatrix));
+			constraintInverseMatrixHandle.setClean();
+
+		}
+		else if (output == AttachmentConstraint::constraintWorldMatrix)
+		{
+
+			MDataHandle constraintWorldMatrixHandle = data.outputValue(AttachmentConstraint::constraintWorldMatrix, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			constraintWorldMatrixHandle.setMMatrix(constraintWorldMatrix);
+			constraintWorldMatrixHandle.setClean();
+
+		}
+		else if (output == AttachmentConstraint::constraintWorldInverseMatrix)
+		{
+
+			MDataHandle constraintWorldInverseMatrixHandle = data.outputValue(AttachmentConstraint::constraintWorldInverseMatrix, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			constraintWorldInverseMatrixHandle.setMMatrix(Maxformations::invertMatrix(constraintWorldMatrix));
+			constraintWorldInverseMatrixHandle.setClean();
+
+		}
+		else if (output == AttachmentConstraint::evaluatedTargets)
+		{
+
+			// The evaluated target count is written alongside the constraint matrices
 			//
-			status = Maxformations::composeMatrix(targetMesh, targetFace, targetCoord, targetMatrix);
+			MDataHandle evaluatedTargetsHandle = data.outputValue(AttachmentConstraint::evaluatedTargets, &status);
 			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-			targetMatrices[i] = MMatrix(targetMatrix);
+			evaluatedTargetsHandle.setClean();
 
 		}
+		else
+		{
 
-		// Calculate weighted constraint matrix
-		//
-		MMatrix attachmentMatrix = Maxformations::blendMatrices(restWorldMatrix, targetMatrices, targetWeights);
+			return MS::kUnknownParameter;
 
-		MMatrix constraintWorldMatrix = offsetMatrix * attachmentMatrix;
-		MMatrix constraintMatrix = constraintWorldMatrix * constraintParentInverseMatrix;
+		}
 
-		// Get output data handles
+		// Mark data block as clean
 		//
-		MDataHandle constraintTranslateXHandle = data.outputValue(AttachmentConstraint::constraintTranslateX, &status);
+		status = data.setClean(plug);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle constraintTranslateYHandle = data.outputValue(AttachmentConstraint::constraintTranslateY, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		return MS::kSuccess;
 
-		MDataHandle constraintTranslateZHandle = data.outputValue(AttachmentConstraint::constraintTranslateZ, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+	}
+	else
+	{
 
-		MDataHandle constraintRotateXHandle = data.outputValue(AttachmentConstraint::constraintRotateX, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		return MS::kUnknownParameter;
 
-		MDataHandle constraintRotateYHandle = data.outputValue(AttachmentConstraint::constraintRotateY, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+	}
 
-		MDataHandle constraintRotateZHandle = data.outputValue(AttachmentConstraint::constraintRotateZ, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+};
 
-		MDataHandle constraintMatrixHandle = data.outputValue(AttachmentConstraint::constraintMatrix, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle constraintInverseMatrixHandle = data.outputValue(AttachmentConstraint::constraintInverseMatrix, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+MStatus AttachmentConstraint::computeMatrices(MDataBlock& data, MMatrix& constraintMatrix, MMatrix& constraintWorldMatrix)
+/**
+Computes the blended constraint matrices from the node's inputs.
+This is only called once per evaluation, see `compute` for how the individual outputs are derived.
+
+@param data: Data block containing storage for the node's attributes.
+@param constraintMatrix: The passed matrix to populate.
+@param constraintWorldMatrix: The passed world matrix to populate.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Get input data handles
+	//
+	MDataHandle relativeHandle = data.inputValue(AttachmentConstraint::relative, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle blendModeHandle = data.inputValue(AttachmentConstraint::blendMode, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle slerpPrecisionHandle = data.inputValue(AttachmentConstraint::slerpPrecision, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle constraintWorldMatrixHandle = data.outputValue(AttachmentConstraint::constraintWorldMatrix, &status);
+	MDataHandle offsetTranslateHandle = data.inputValue(AttachmentConstraint::offsetTranslate, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle offsetRotateHandle = data.inputValue(AttachmentConstraint::offsetRotate, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle enableRestPositionHandle = data.inputValue(AttachmentConstraint::enableRestPosition, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle restTranslateHandle = data.inputValue(AttachmentConstraint::restTranslate, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle restRotateHandle = data.inputValue(AttachmentConstraint::restRotate, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle constraintParentInverseMatrixHandle = data.inputValue(AttachmentConstraint::constraintParentInverseMatrix, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle constraintRotateOrderHandle = data.inputValue(AttachmentConstraint::constraintRotateOrder, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MArrayDataHandle targetArrayHandle = data.inputArrayValue(AttachmentConstraint::target, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Get values from handles
+	//
+	bool relative = relativeHandle.asBool();
+	Maxformations::BlendMode blendMode = Maxformations::BlendMode(blendModeHandle.asShort());
+	Maxformations::SlerpPrecision precision = Maxformations::SlerpPrecision(slerpPrecisionHandle.asShort());
+	MVector offsetRotate = offsetRotateHandle.asVector();
+	MMatrix offsetMatrix = relative ? Maxformations::createRotationMatrix(offsetRotate) : MMatrix::identity;
+
+	MEulerRotation::RotationOrder constraintRotateOrder = MEulerRotation::RotationOrder(constraintRotateOrderHandle.asShort());
+	MMatrix constraintParentInverseMatrix = constraintParentInverseMatrixHandle.asMatrix();
+	MMatrix constraintParentMatrix = Maxformations::invertMatrix(constraintParentInverseMatrix);
+
+	bool restEnabled = enableRestPositionHandle.asBool();
+	MVector restTranslate = restTranslateHandle.asVector();
+	MMatrix restTranslateMatrix = Maxformations::createPositionMatrix(restTranslate);
+	MVector restRotate = restRotateHandle.asVector();
+	MMatrix restRotateMatrix = Maxformations::createRotationMatrix(restRotate, constraintRotateOrder);
+	MMatrix restMatrix = restEnabled ? (restRotateMatrix * restTranslateMatrix) : MMatrix::identity;
+	MMatrix restWorldMatrix = restMatrix * constraintParentMatrix;
+
+	// Collect target matrices
+	//
+	unsigned int targetCount = targetArrayHandle.elementCount();
+	MFloatArray targetWeights;
+	MMatrixArray targetMatrices;
+
+	float weight;
+
+	MDataHandle  targetHandle, targetWeightHandle, targetFaceHandle, targetCoordHandle, targetCoordXHandle, targetCoordYHandle, targetMeshHandle;
+
+	MObject targetMesh;
+	unsigned int targetFace;
+	MVector targetCoord, targetTangent, targetBinormal;
+	MPoint targetPosition;
+	float targetCoordX, targetCoordY;
+	MMatrix targetMatrix;
+
+	for (unsigned int i = 0; i < targetCount; i++)
+	{
+
+		// Jump to array element
+		//
+		status = targetArrayHandle.jumpToArrayElement(i);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle constraintWorldInverseMatrixHandle = data.outputValue(AttachmentConstraint::constraintWorldInverseMatrix, &status);
+		targetHandle = targetArrayHandle.inputValue(&status);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		// Update translation constraints
+		// Get target data handles
 		//
-		MVector constraintTranslate = Maxformations::matrixToPosition(constraintMatrix);
-
-		constraintTranslateXHandle.setMDistance(MDistance(constraintTranslate.x, MDistance::kCentimeters));
-		constraintTranslateYHandle.setMDistance(MDistance(constraintTranslate.y, MDistance::kCentimeters));
-		constraintTranslateZHandle.setMDistance(MDistance(constraintTranslate.z, MDistance::kCentimeters));
+		targetWeightHandle = targetHandle.child(AttachmentConstraint::targetWeight);
+		targetFaceHandle = targetHandle.child(AttachmentConstraint::targetFace);
+		targetCoordHandle = targetHandle.child(AttachmentConstraint::targetCoord);
+		targetCoordXHandle = targetCoordHandle.child(AttachmentConstraint::targetCoordX);
+		targetCoordYHandle = targetCoordHandle.child(AttachmentConstraint::targetCoordY);
+		targetMeshHandle = targetHandle.child(AttachmentConstraint::targetMesh);
+
+		// Get weight value
+		//
+		weight = Maxformations::clamp(targetWeightHandle.asFloat(), 0.0f, 100.0f) / 100.0;
 
-		constraintTranslateXHandle.setClean();
-		constraintTranslateYHandle.setClean();
-		constraintTranslateZHandle.setClean();
+		if (weight == 0.0f)
+		{
 
-		// Update rotation constraints
-		//
-		MEulerRotation constraintRotate = Maxformations::matrixToEulerRotation(constraintMatrix, constraintRotateOrder);
+			continue;  // Skip targets that don't contribute!
 
-		constraintRotateXHandle.setMAngle(MAngle(constraintRotate.x, MAngle::kRadians));
-		constraintRotateYHandle.setMAngle(MAngle(constraintRotate.y, MAngle::kRadians));
-		constraintRotateZHandle.setMAngle(MAngle(constraintRotate.z, MAngle::kRadians));
+		}
 
-		constraintRotateXHandle.setClean();
-		constraintRotateYHandle.setClean();
-		constraintRotateZHandle.setClean();
+		targetWeights.append(weight);
 
-		// Update matrix constraints
+		// Get curve parameter
 		//
-		constraintMatrixHandle.setMMatrix(constraintMatrix);
-		constraintInverseMatrixHandle.setMMatrix(constraintMatrix.inverse());
-		constraintWorldMatrixHandle.setMMatrix(constraintWorldMatrix);
-		constraintWorldInverseMatrixHandle.setMMatrix(constraintWorldMatrix.inverse());
+		targetMesh = targetMeshHandle.asMesh();
+		targetFace = targetFaceHandle.asLong();
+		targetCoordX = targetCoordXHandle.asFloat();
+		targetCoordY = targetCoordYHandle.asFloat();
+		targetCoord = MVector(targetCoordX, targetCoordY, 1.0f - (targetCoordX + targetCoordY));
 
-		constraintMatrixHandle.setClean();
-		constraintInverseMatrixHandle.setClean();
-		constraintWorldMatrixHandle.setClean();
-		constraintWorldInverseMatrixHandle.setClean();
-
-		// Mark data block as clean
+		// Compose transform matrix
 		//
-		status = data.setClean(plug);
+		status = Maxformations::composeMatrix(targetMesh, targetFace, targetCoord, targetMatrix);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		return MS::kSuccess;
+		targetMatrices.append(MMatrix(targetMatrix));
 
 	}
-	else
+
+	// Update evaluated target count
+	//
+	MDataHandle evaluatedTargetsHandle = data.outputValue(AttachmentConstraint::evaluatedTargets, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	evaluatedTargetsHandle.setInt(int(targetWeights.length()));
+	evaluatedTargetsHandle.setClean();
+
+	// Calculate weighted constraint matrix
+	//
+	MMatrix attachmentMatrix = Maxformations::blendMatrices(restWorldMatrix, targetMatrices, targetWeights, blendMode, precision);
+
+	constraintWorldMatrix = offsetMatrix * attachmentMatrix;
+	constraintMatrix = constraintWorldMatrix * constraintParentInverseMatrix;
+
+	return MS::kSuccess;
+
+};
+
+
+MStatus AttachmentConstraint::setDependentsDirty(const MPlug& plug, MPlugArray& plugArray)
+/**
+This method can be overridden in user defined nodes to specify which plugs should be set dirty based upon an input plug which Maya is marking dirty.
+Any input change invalidates the cached constraint matrices.
+
+@param plug: Plug which is being set dirty by Maya.
+@param plugArray: The programmer should add any plugs which they want to set dirty to this list.
+@return: Return status.
+*/
+{
+
+	this->cache.invalidate();
+
+	return MPxConstraint::setDependentsDirty(plug, plugArray);
+
+};
+
+
+MStatus AttachmentConstraint::preEvaluation(const MDGContext& context, const MEvaluationNode& evaluationNode)
+/**
+Prepares the node for evaluation by the evaluation manager.
+Dirty propagation is skipped in this case so the cached constraint matrices are invalidated here instead.
+
+@param context: Context in which the evaluation will happen.
+@param evaluationNode: Evaluation node which contains information about the dirty plugs that are about to be evaluated.
+@return: Return status.
+*/
+{
+
+	if (context.isNormal())
 	{
 
-		return MS::kUnknownParameter;
+		this->cache.invalidate();
 
 	}
 
+	return MPxConstraint::preEvaluation(context, evaluationNode);
+
+};
+
+
+MPxNode::SchedulingType AttachmentConstraint::schedulingType() const
+/**
+When overridden this method controls the degree of parallelism supported by the node during threaded evaluation.
+The cached constraint matrices are guarded by their own lock so this constraint can evaluate in parallel!
+
+@return: The scheduling type.
+*/
+{
+
+	return MPxNode::kParallel;
+
+};
+
+
+void AttachmentConstraint::getCacheSetup(const MEvaluationNode& evaluationNode, MNodeCacheDisablingInfo& disablingInfo, MNodeCacheSetupInfo& cacheSetupInfo, MObjectArray& monitoredAttributes) const
+/**
+Provide node-specific setup info for the Cached Playback system.
+The cached constraint matrices are only trusted for normal contexts so background evaluations always recompute them!
+
+@param evaluationNode: This node's evaluation node, contains animated plug information.
+@param disablingInfo: Information about why the node disables Cached Playback to be reported to the user.
+@param cacheSetupInfo: Preferences and requirements this node has for Cached Playback.
+@param monitoredAttributes: Attributes impacting the behavior of this method that will be monitored for change.
+@return: void.
+*/
+{
+
+	// Call parent function
+	//
+	MPxConstraint::getCacheSetup(evaluationNode, disablingInfo, cacheSetupInfo, monitoredAttributes);
+	assert(!disablingInfo.getCacheDisabled());
+
+	// Update caching preference
+	//
+	cacheSetupInfo.setPreference(MNodeCacheSetupInfo::kWantToCacheByDefault, true);
+
 };
 
 
@@ -374,6 +569,26 @@ Use this function to define any static attributes.
 
 	CHECK_MSTATUS(fnNumericAttr.addToCategory(AttachmentConstraint::inputCategory));
 
+	// ".blendMode" attribute
+	//
+	AttachmentConstraint::blendMode = fnEnumAttr.create("blendMode", "bm", short(0), &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnEnumAttr.addField("Slerp", 0));
+	CHECK_MSTATUS(fnEnumAttr.addField("Dual Quaternion", 1));
+	CHECK_MSTATUS(fnEnumAttr.addToCategory(AttachmentConstraint::inputCategory));
+
+	// ".slerpPrecision" attribute
+	// The default is always exact so saved scenes evaluate the same regardless of the global slerp precision!
+	//
+	AttachmentConstraint::slerpPrecision = fnEnumAttr.create("slerpPrecision", "sp", short(Maxformations::SlerpPrecision::Exact), &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnEnumAttr.addField("Exact", 0));
+	CHECK_MSTATUS(fnEnumAttr.addField("Polynomial", 1));
+	CHECK_MSTATUS(fnEnumAttr.addField("Nlerp", 2));
+	CHECK_MSTATUS(fnEnumAttr.addToCategory(AttachmentConstraint::inputCategory));
+
 	// ".offsetTranslateX" attribute
 	//
 	AttachmentConstraint::offsetTranslateX = fnUnitAttr.create("offsetTranslateX", "otx", MFnUnitAttribute::kDistance, 0.0, &status);
@@ -704,11 +919,22 @@ Use this function to define any static attributes.
 	CHECK_MSTATUS(fnMatrixAttr.setStorable(false));
 	CHECK_MSTATUS(fnMatrixAttr.addToCategory(AttachmentConstraint::outputCategory));
 
+	// ".evaluatedTargets" attribute
+	//
+	AttachmentConstraint::evaluatedTargets = fnNumericAttr.create("evaluatedTargets", "evt", MFnNumericData::kInt, 0, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnNumericAttr.setWritable(false));
+	CHECK_MSTATUS(fnNumericAttr.setStorable(false));
+	CHECK_MSTATUS(fnNumericAttr.addToCategory(AttachmentConstraint::outputCategory));
+
 	// Add attributes
 	//
 	CHECK_MSTATUS(AttachmentConstraint::addAttribute(AttachmentConstraint::restTranslate));
 	CHECK_MSTATUS(AttachmentConstraint::addAttribute(AttachmentConstraint::restRotate));
 	CHECK_MSTATUS(AttachmentConstraint::addAttribute(AttachmentConstraint::relative));
+	CHECK_MSTATUS(AttachmentConstraint::addAttribute(AttachmentConstraint::blendMode));
+	CHECK_MSTATUS(AttachmentConstraint::addAttribute(AttachmentConstraint::slerpPrecision));
 	CHECK_MSTATUS(AttachmentConstraint::addAttribute(AttachmentConstraint::offsetTranslate));
 	CHECK_MSTATUS(AttachmentConstraint::addAttribute(AttachmentConstraint::offsetRotate));
 	CHECK_MSTATUS(AttachmentConstraint::addAttribute(AttachmentConstraint::target));
@@ -720,31 +946,98 @@ Use this function to define any static attributes.
 	CHECK_MSTATUS(AttachmentConstraint::addAttribute(AttachmentConstraint::constraintWorldMatrix));
 	CHECK_MSTATUS(AttachmentConstraint::addAttribute(AttachmentConstraint::constraintWorldInverseMatrix));
 	CHECK_MSTATUS(AttachmentConstraint::addAttribute(AttachmentConstraint::constraintParentInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::addAttribute(AttachmentConstraint::evaluatedTargets));
 
 	// Define attribute relationships
+	// Rotation-only inputs are kept off of the translation outputs and vice versa, the offset translation is not evaluated at all!
 	//
-	MObjectArray inputs, outputs;
-
-	status = Maxformations::getAttributesByCategory(AttachmentConstraint::id, AttachmentConstraint::inputCategory, inputs);
-	CHECK_MSTATUS_AND_RETURN_IT(status);
-
-	status = Maxformations::getAttributesByCategory(AttachmentConstraint::id, AttachmentConstraint::outputCategory, outputs);
-	CHECK_MSTATUS_AND_RETURN_IT(status);
-
-	unsigned int inputCount = inputs.length();
-	unsigned int outputCount = outputs.length();
-
-	for (unsigned int i = 0; i < inputCount; i++)
-	{
-
-		for (unsigned int j = 0; j < outputCount; j++)
-		{
-
-			CHECK_MSTATUS(AttachmentConstraint::attributeAffects(inputs[i], outputs[j]));
-
-		}
-
-	}
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::enableRestPosition, AttachmentConstraint::constraintTranslate));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::constraintParentInverseMatrix, AttachmentConstraint::constraintTranslate));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::blendMode, AttachmentConstraint::constraintTranslate));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::slerpPrecision, AttachmentConstraint::constraintTranslate));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::target, AttachmentConstraint::constraintTranslate));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetWeight, AttachmentConstraint::constraintTranslate));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetFace, AttachmentConstraint::constraintTranslate));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetCoord, AttachmentConstraint::constraintTranslate));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetMesh, AttachmentConstraint::constraintTranslate));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::restTranslate, AttachmentConstraint::constraintTranslate));
+
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::enableRestPosition, AttachmentConstraint::constraintRotate));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::constraintParentInverseMatrix, AttachmentConstraint::constraintRotate));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::blendMode, AttachmentConstraint::constraintRotate));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::slerpPrecision, AttachmentConstraint::constraintRotate));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::target, AttachmentConstraint::constraintRotate));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetWeight, AttachmentConstraint::constraintRotate));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetFace, AttachmentConstraint::constraintRotate));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetCoord, AttachmentConstraint::constraintRotate));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetMesh, AttachmentConstraint::constraintRotate));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::relative, AttachmentConstraint::constraintRotate));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::offsetRotate, AttachmentConstraint::constraintRotate));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::restRotate, AttachmentConstraint::constraintRotate));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::constraintRotateOrder, AttachmentConstraint::constraintRotate));
+
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::enableRestPosition, AttachmentConstraint::constraintMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::constraintParentInverseMatrix, AttachmentConstraint::constraintMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::blendMode, AttachmentConstraint::constraintMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::slerpPrecision, AttachmentConstraint::constraintMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::target, AttachmentConstraint::constraintMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetWeight, AttachmentConstraint::constraintMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetFace, AttachmentConstraint::constraintMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetCoord, AttachmentConstraint::constraintMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetMesh, AttachmentConstraint::constraintMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::restTranslate, AttachmentConstraint::constraintMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::relative, AttachmentConstraint::constraintMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::offsetRotate, AttachmentConstraint::constraintMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::restRotate, AttachmentConstraint::constraintMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::constraintRotateOrder, AttachmentConstraint::constraintMatrix));
+
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::enableRestPosition, AttachmentConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::constraintParentInverseMatrix, AttachmentConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::blendMode, AttachmentConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::slerpPrecision, AttachmentConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::target, AttachmentConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetWeight, AttachmentConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetFace, AttachmentConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetCoord, AttachmentConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetMesh, AttachmentConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::restTranslate, AttachmentConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::relative, AttachmentConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::offsetRotate, AttachmentConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::restRotate, AttachmentConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::constraintRotateOrder, AttachmentConstraint::constraintInverseMatrix));
+
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::enableRestPosition, AttachmentConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::constraintParentInverseMatrix, AttachmentConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::blendMode, AttachmentConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::slerpPrecision, AttachmentConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::target, AttachmentConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetWeight, AttachmentConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetFace, AttachmentConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetCoord, AttachmentConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetMesh, AttachmentConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::restTranslate, AttachmentConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::relative, AttachmentConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::offsetRotate, AttachmentConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::restRotate, AttachmentConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::constraintRotateOrder, AttachmentConstraint::constraintWorldMatrix));
+
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::enableRestPosition, AttachmentConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::constraintParentInverseMatrix, AttachmentConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::blendMode, AttachmentConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::slerpPrecision, AttachmentConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::target, AttachmentConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetWeight, AttachmentConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetFace, AttachmentConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetCoord, AttachmentConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetMesh, AttachmentConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::restTranslate, AttachmentConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::relative, AttachmentConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::offsetRotate, AttachmentConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::restRotate, AttachmentConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::constraintRotateOrder, AttachmentConstraint::constraintWorldInverseMatrix));
+
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::target, AttachmentConstraint::evaluatedTargets));
+	CHECK_MSTATUS(AttachmentConstraint::attributeAffects(AttachmentConstraint::targetWeight, AttachmentConstraint::evaluatedTargets));
 
 	return status;
 
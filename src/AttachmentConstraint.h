@@ -13,6 +13,12 @@
 #include <maya/MTypeId.h>
 #include <maya/MObject.h>
 #include <maya/MPlug.h>
+#include <maya/MPlugArray.h>
+#include <maya/MDGContext.h>
+#include <maya/MEvaluationNode.h>
+#include <maya/MNodeCacheDisablingInfo.h>
+#include <maya/MNodeCacheSetupInfo.h>
+#include <maya/MObjectArray.h>
 #include <maya/MDataBlock.h>
 #include <maya/MDataHandle.h>
 #include <maya/MArrayDataHandle.h>
@@ -36,6 +42,8 @@
 
 #include "Maxformations.h"
 
+#include <assert.h>
+
 
 class AttachmentConstraint : public MPxConstraint
 {
@@ -46,6 +54,12 @@ public:
 	virtual				~AttachmentConstraint();
 
 	virtual MStatus		compute(const MPlug& plug, MDataBlock& data);
+	virtual	MStatus		setDependentsDirty(const MPlug& plug, MPlugArray& plugArray);
+	virtual	MStatus		preEvaluation(const MDGContext& context, const MEvaluationNode& evaluationNode);
+	virtual	SchedulingType	schedulingType() const;
+	virtual	void		getCacheSetup(const MEvaluationNode& evaluationNode, MNodeCacheDisablingInfo& disablingInfo, MNodeCacheSetupInfo& cacheSetupInfo, MObjectArray& monitoredAttributes) const;
+
+			MStatus		computeMatrices(MDataBlock& data, MMatrix& constraintMatrix, MMatrix& constraintWorldMatrix);
 
 	static  void*		creator();
 	static  MStatus		initialize();
@@ -57,6 +71,8 @@ public:
 public:
 
 	static	MObject		relative;
+	static	MObject		blendMode;
+	static	MObject		slerpPrecision;
 	static	MObject		offsetTranslate;
 	static	MObject		offsetTranslateX;
 	static	MObject		offsetTranslateY;
@@ -96,6 +112,7 @@ public:
 	static	MObject		constraintWorldMatrix;
 	static	MObject		constraintWorldInverseMatrix;
 	static	MObject		constraintParentInverseMatrix;
+	static	MObject		evaluatedTargets;
 
 public:
 
@@ -109,6 +126,10 @@ public:
 
 	static	MTypeId		id;
 
+protected:
+
+	Maxformations::ConstraintCache	cache;
+
 };
 
 #endif
\ No newline at end of file
@@ -43,31 +43,15 @@ MString		ExposeTransform::exposeCategory("Expose");
 
 MTypeId		ExposeTransform::id(0x0013b1c8);
 
+const unsigned int	ExposeTransform::trimBatchSize = 64;
 
-void onPlayingBack(bool state, void* clientData)
-{
-
-	// Check if pointer is valid
-	//
-	ExposeTransform* node = static_cast<ExposeTransform*>(clientData);
-
-	if (node == nullptr)
-	{
-
-		return;
-
-	}
-
-	// Check if internal cache requires clearing
-	//
-	if (!state)
-	{
-
-		node->clearOutOfRangeMatrices();
-
-	}
-
-};
+std::vector<MObjectHandle>	ExposeTransform::instances;
+std::vector<MObjectHandle>	ExposeTransform::pendingTrims;
+unsigned int				ExposeTransform::trimStartFrame = 0;
+unsigned int				ExposeTransform::trimEndFrame = 0;
+MCallbackId					ExposeTransform::playbackCallbackId = 0;
+MCallbackId					ExposeTransform::idleCallbackId = 0;
+bool						ExposeTransform::hasIdleCallback = false;
 
 
 ExposeTransform::ExposeTransform()
@@ -79,17 +63,30 @@ Constructor.
 	this->exposeHandle = MObjectHandle();
 	this->localReferenceHandle = MObjectHandle();
 	this->parentEnabled = false;
-	this->callbackId = MConditionMessage::addConditionCallback("playingBack", onPlayingBack, this);
+
 };
 
 
-ExposeTransform::~ExposeTransform() 
+ExposeTransform::~ExposeTransform() {};
+
+
+void ExposeTransform::postConstructor()
 /**
-Destructor.
+Internally maya creates two objects when a user defined node is created, the internal MObject and the user derived object.
+The association between these two objects is not made until after the MPxNode constructor is called.
+This implies that no MPxNode member function can be called from the MPxNode constructor.
+The postConstructor will get called immediately after the constructor when it is safe to call any MPxNode member function.
+
+@return: Void.
 */
 {
 
-	MConditionMessage::removeCallback(this->callbackId);
+	Maxform::postConstructor();
+
+	// Track this node in the shared registry
+	// The handle is weak so deleted nodes are simply skipped and pruned by the playback callback!
+	//
+	ExposeTransform::instances.push_back(MObjectHandle(this->thisMObject()));
 
 };
 
@@ -110,6 +107,8 @@ Only these values should be used when performing computations!
 
 	MStatus status;
 
+	MAXFORM_PROFILE_COMPUTE("ExposeTransform::compute", this->thisMObject());
+
 	// Check requested attribute
 	//
 	MObject attribute = plug.attribute(&status);
@@ -154,8 +153,14 @@ Only these values should be used when performing computations!
 		MMatrix exposeMatrix = exposeMatrixHandle.asMatrix();
 		MMatrix localReferenceMatrix = localReferenceMatrixHandle.asMatrix();
 
-		this->exposeMatrices[currentFrame] = exposeMatrix;
-		this->localReferenceMatrices[currentFrame] = localReferenceMatrix;
+		{
+
+			std::lock_guard<std::mutex> lock(this->cacheMutex);
+
+			this->exposeMatrices[currentFrame] = exposeMatrix;
+			this->localReferenceMatrices[currentFrame] = localReferenceMatrix;
+
+		}
 
 		// Evaluate time offset
 		//
@@ -212,19 +217,29 @@ Only these values should be used when performing computations!
 			
 		}
 		
-		MMatrix localMatrix = exposeMatrix * localReferenceMatrix.inverse();
+		MMatrix localMatrix = exposeMatrix * Maxformations::invertMatrix(localReferenceMatrix);
 		
 		// Get transform values
 		//
+		// Both the local and world matrices share each axis order so they are converted in pairs!
+		//
+		MMatrixArray eulerMatrices = MMatrixArray(2);
+		eulerMatrices[0] = localMatrix;
+		eulerMatrices[1] = exposeMatrix;
+
+		MVectorArray eulerXAngles = Maxformations::matrixToEulerAngles(eulerMatrices, eulerXOrder);
+		MVectorArray eulerYAngles = Maxformations::matrixToEulerAngles(eulerMatrices, eulerYOrder);
+		MVectorArray eulerZAngles = Maxformations::matrixToEulerAngles(eulerMatrices, eulerZOrder);
+
 		MVector localPosition = Maxformations::matrixToPosition(localMatrix);
-		double localEulerX = Maxformations::matrixToEulerAngles(localMatrix, eulerXOrder)[0];
-		double localEulerY = Maxformations::matrixToEulerAngles(localMatrix, eulerYOrder)[1];
-		double localEulerZ = Maxformations::matrixToEulerAngles(localMatrix, eulerZOrder)[2];
+		double localEulerX = eulerXAngles[0][0];
+		double localEulerY = eulerYAngles[0][1];
+		double localEulerZ = eulerZAngles[0][2];
 
 		MVector worldPosition = Maxformations::matrixToPosition(exposeMatrix);
-		double worldEulerX = Maxformations::matrixToEulerAngles(exposeMatrix, eulerXOrder)[0];
-		double worldEulerY = Maxformations::matrixToEulerAngles(exposeMatrix, eulerYOrder)[1];
-		double worldEulerZ = Maxformations::matrixToEulerAngles(exposeMatrix, eulerZOrder)[2];
+		double worldEulerX = eulerXAngles[1][0];
+		double worldEulerY = eulerYAngles[1][1];
+		double worldEulerZ = eulerZAngles[1][2];
 
 		MDistance distanceBetween = Maxformations::distanceBetween(localReferenceMatrix, exposeMatrix);
 		MAngle angleBetween = Maxformations::angleBetween(localReferenceMatrix, exposeMatrix);
@@ -339,6 +354,59 @@ Only these values should be used when performing computations!
 };
 
 
+MPxNode::SchedulingType ExposeTransform::schedulingType() const
+/**
+When overridden this method controls the degree of parallelism supported by the node during threaded evaluation.
+Time offsets pull the expose matrices at other times, outside of the evaluation graph, so this node must be evaluated by the DG!
+
+@return: The scheduling type.
+*/
+{
+
+	return MPxNode::kUntrusted;
+
+};
+
+
+void ExposeTransform::getCacheSetup(const MEvaluationNode& evaluationNode, MNodeCacheDisablingInfo& disablingInfo, MNodeCacheSetupInfo& cacheSetupInfo, MObjectArray& monitoredAttributes) const
+/**
+Provide node-specific setup info for the Cached Playback system.
+Time offsets evaluate the exposed node at other frames, outside of the evaluation graph, so caching is disabled while they are in use!
+
+@param evaluationNode: This node's evaluation node, contains animated plug information.
+@param disablingInfo: Information about why the node disables Cached Playback to be reported to the user.
+@param cacheSetupInfo: Preferences and requirements this node has for Cached Playback.
+@param monitoredAttributes: Attributes impacting the behavior of this method that will be monitored for change.
+@return: void.
+*/
+{
+
+	// Call parent function
+	//
+	Maxform::getCacheSetup(evaluationNode, disablingInfo, cacheSetupInfo, monitoredAttributes);
+	assert(!disablingInfo.getCacheDisabled());
+
+	// Check if time offset is enabled
+	//
+	MPlug useTimeOffsetPlug = MPlug(this->thisMObject(), ExposeTransform::useTimeOffset);
+	bool useTimeOffset = useTimeOffsetPlug.asBool();
+
+	if (useTimeOffset)
+	{
+
+		disablingInfo.setCacheDisabled(true);
+		disablingInfo.setReason("exposeTm nodes cannot be cached while their time offset is enabled.");
+		disablingInfo.setMitigation("Disable the useTimeOffset attribute on any exposeTm nodes.");
+
+	}
+
+	// Append attributes for monitoring
+	//
+	monitoredAttributes.append(ExposeTransform::useTimeOffset);
+
+};
+
+
 bool ExposeTransform::setInternalValue(const MPlug& plug, const MDataHandle& handle)
 /**
 This method is overridden by nodes that store attribute data in some internal format.
@@ -389,42 +457,66 @@ Returns the expose and local reference matrix, at the specified time, from the i
 	// If not, then evaluate matrices at different context
 	//
 	unsigned int frame = std::round(time.value());
-	
-	bool hasMatrix = this->exposeMatrices.find(frame) != this->exposeMatrices.end();
-	bool hasMatrices = this->exposeMatrices.size() > 0 && this->localReferenceMatrices.size() > 0;
 
-	if (hasMatrix)
 	{
 
-		exposeMatrix = this->exposeMatrices[frame];
-		localReferenceMatrix = this->localReferenceMatrices[frame];
+		std::lock_guard<std::mutex> lock(this->cacheMutex);
 
-	}
-	else
-	{
+		bool hasMatrix = this->exposeMatrices.find(frame) != this->exposeMatrices.end();
+		MAXFORM_RECORD_CACHE_ACCESS(hasMatrix);
 
-		MDGContext context = MDGContext(time);
-		MDGContextGuard guard(context);
+		if (hasMatrix)
+		{
 
-		MPlug exposeMatrixPlug = MPlug(this->thisMObject(), ExposeTransform::exposeMatrix);
-		MPlug localReferenceMatrixPlug = MPlug(this->thisMObject(), ExposeTransform::localReferenceMatrix);
+			exposeMatrix = this->exposeMatrices[frame];
+			localReferenceMatrix = this->localReferenceMatrices[frame];
 
-		exposeMatrix = Maxformations::getMatrixData(exposeMatrixPlug.asMObject());
-		localReferenceMatrix = Maxformations::getMatrixData(localReferenceMatrixPlug.asMObject());
+			return status;
 
-		exposeMatrices[frame] = exposeMatrix;
-		localReferenceMatrices[frame] = localReferenceMatrix;
+		}
 
 	}
 
+	// The lock is released while pulling so other frames can still be cached
+	//
+	MDGContext context = MDGContext(time);
+	MDGContextGuard guard(context);
+
+	MPlug exposeMatrixPlug = MPlug(this->thisMObject(), ExposeTransform::exposeMatrix);
+	MPlug localReferenceMatrixPlug = MPlug(this->thisMObject(), ExposeTransform::localReferenceMatrix);
+
+	exposeMatrix = Maxformations::getMatrixData(exposeMatrixPlug.asMObject());
+	localReferenceMatrix = Maxformations::getMatrixData(localReferenceMatrixPlug.asMObject());
+
+	std::lock_guard<std::mutex> lock(this->cacheMutex);
+
+	this->exposeMatrices[frame] = exposeMatrix;
+	this->localReferenceMatrices[frame] = localReferenceMatrix;
+
 	return status;
 
 };
 
 
+void ExposeTransform::clearCachedMatrices()
+/**
+Removes all cached matrices.
+
+@return: Void.
+*/
+{
+
+	std::lock_guard<std::mutex> lock(this->cacheMutex);
+
+	this->exposeMatrices.clear();
+	this->localReferenceMatrices.clear();
+
+};
+
+
 void ExposeTransform::clearOutOfRangeMatrices()
 /**
-Removes any cached matrices that are out-of-range.
+Removes any cached matrices that are outside of the animation range.
 
 @return: Void.
 */
@@ -433,25 +525,29 @@ Removes any cached matrices that are out-of-range.
 	unsigned int startFrame = round(MAnimControl::animationStartTime().value());
 	unsigned int endFrame = round(MAnimControl::animationEndTime().value());
 
-	std::map<unsigned int, MMatrix>::iterator iter;
-	std::map<unsigned int, MMatrix> exposeMatrices;
-	std::map<unsigned int, MMatrix> localReferenceMatrices;
+	this->clearOutOfRangeMatrices(startFrame, endFrame);
 
-	for (iter = this->exposeMatrices.begin(); iter != this->exposeMatrices.end(); iter++)
-	{
-		
-		if ((startFrame <= iter->first) && (iter->first <= endFrame))
-		{
+};
 
-			exposeMatrices[iter->first] = this->exposeMatrices[iter->first];
-			localReferenceMatrices[iter->first] = this->localReferenceMatrices[iter->first];
 
-		}
+void ExposeTransform::clearOutOfRangeMatrices(const unsigned int startFrame, const unsigned int endFrame)
+/**
+Removes any cached matrices that are outside of the specified range.
+The maps are ordered by frame so the out-of-range entries are erased in place rather than rebuilding the maps!
 
-	}
+@param startFrame: The first frame to keep.
+@param endFrame: The last frame to keep.
+@return: Void.
+*/
+{
+
+	std::lock_guard<std::mutex> lock(this->cacheMutex);
 
-	this->exposeMatrices = exposeMatrices;
-	this->localReferenceMatrices = localReferenceMatrices;
+	this->exposeMatrices.erase(this->exposeMatrices.begin(), this->exposeMatrices.lower_bound(startFrame));
+	this->exposeMatrices.erase(this->exposeMatrices.upper_bound(endFrame), this->exposeMatrices.end());
+
+	this->localReferenceMatrices.erase(this->localReferenceMatrices.begin(), this->localReferenceMatrices.lower_bound(startFrame));
+	this->localReferenceMatrices.erase(this->localReferenceMatrices.upper_bound(endFrame), this->localReferenceMatrices.end());
 
 };
 
@@ -529,6 +625,7 @@ You should return kUnknownParameter to specify that maya should handle this conn
 		this->exposeHandle = MObjectHandle(otherNode);
 		this->updateExposeMatrix();
 		this->updateLocalReferenceMatrix();
+		this->clearCachedMatrices();
 
 	}
 	else if (attribute == ExposeTransform::localReferenceNode && !asSrc)
@@ -541,6 +638,7 @@ You should return kUnknownParameter to specify that maya should handle this conn
 
 		this->localReferenceHandle = MObjectHandle(otherNode);
 		this->updateLocalReferenceMatrix();
+		this->clearCachedMatrices();
 
 	}
 	else;
@@ -573,12 +671,14 @@ You should return kUnknownParameter to specify that maya should handle this conn
 	{
 
 		this->exposeHandle = MObjectHandle();
+		this->clearCachedMatrices();
 
 	}
 	else if (attribute == ExposeTransform::localReferenceNode && !asSrc)
 	{
 
 		this->localReferenceHandle = MObjectHandle();
+		this->clearCachedMatrices();
 
 	}
 	else;
@@ -600,17 +700,40 @@ This function is only called when the `exposeNode` attribute is connected!
 	MStatus status;
 
 	// Evaluate if file is being opened
-	// Any DAG changes will interfere with file IO operations!
+	// Any DAG changes will interfere with file IO operations so these edits are deferred until loading has finished!
 	//
-	bool isSceneLoading = Maxformations::isSceneLoading();
+	bool isDeferred = Maxformations::deferUntilLoaded(this->thisMObject(), ExposeTransform::updateDeferredExposeMatrix);
 
-	if (isSceneLoading)
+	if (isDeferred)
 	{
 
 		return MS::kSuccess;
 
 	}
 
+	// Execute edits
+	//
+	Maxformations::BatchModifier modifier;
+
+	status = this->updateExposeMatrix(modifier);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	return modifier.doIt();
+
+};
+
+
+MStatus ExposeTransform::updateExposeMatrix(Maxformations::BatchModifier& modifier)
+/**
+Queues the edits required to connect the correct attributes to the `exposeMatrix` attribute.
+
+@param modifier: The modifier to queue edits onto.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
 	// Check if expose node is valid
 	//
 	bool isExposeNodeValid = this->exposeHandle.isValid() && this->exposeHandle.isAlive();
@@ -645,7 +768,7 @@ This function is only called when the `exposeNode` attribute is connected!
 
 		// Connect plugs
 		//
-		status = Maxformations::connectPlugs(element, otherPlug, true);
+		status = modifier.connectPlugs(element, otherPlug, true);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
 	}
@@ -656,7 +779,7 @@ This function is only called when the `exposeNode` attribute is connected!
 		//
 		MPlug plug = MPlug(this->thisMObject(), ExposeTransform::exposeMatrix);
 
-		status = Maxformations::breakConnections(plug, true, false);
+		status = modifier.breakConnections(plug, true, false);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
 	}
@@ -678,17 +801,40 @@ This function is only called when the `localReferenceNode` attribute is connecte
 	MStatus status;
 
 	// Evaluate if file is being opened
-	// Any DAG changes will interfere with file IO operations!
+	// Any DAG changes will interfere with file IO operations so these edits are deferred until loading has finished!
 	//
-	bool isSceneLoading = Maxformations::isSceneLoading();
+	bool isDeferred = Maxformations::deferUntilLoaded(this->thisMObject(), ExposeTransform::updateDeferredLocalReferenceMatrix);
 
-	if (isSceneLoading)
+	if (isDeferred)
 	{
 
 		return MS::kSuccess;
 
 	}
 
+	// Execute edits
+	//
+	Maxformations::BatchModifier modifier;
+
+	status = this->updateLocalReferenceMatrix(modifier);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	return modifier.doIt();
+
+};
+
+
+MStatus ExposeTransform::updateLocalReferenceMatrix(Maxformations::BatchModifier& modifier)
+/**
+Queues the edits required to connect the correct attributes to the `localReferenceMatrix` attribute.
+
+@param modifier: The modifier to queue edits onto.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
 	// Check if parent space is enabled
 	//
 	bool isExposeNodeValid = this->exposeHandle.isValid() && this->exposeHandle.isAlive();
@@ -729,23 +875,16 @@ This function is only called when the `localReferenceNode` attribute is connecte
 
 			// Connect plugs
 			//
-			status = Maxformations::connectPlugs(element, otherPlug, true);
+			status = modifier.connectPlugs(element, otherPlug, true);
 			CHECK_MSTATUS_AND_RETURN_IT(status);
 
 		}
 		else
 		{
 
-			// Break connections to ".localReferenceMatrix" plug
+			// Reset ".localReferenceMatrix" plug
 			//
-			MPlug plug = MPlug(this->thisMObject(), ExposeTransform::localReferenceMatrix);
-
-			status = Maxformations::breakConnections(plug, true, false);
-			CHECK_MSTATUS_AND_RETURN_IT(status);
-
-			// Reset plug value
-			//
-			status = Maxformations::resetMatrixPlug(plug);
+			status = this->resetLocalReferenceMatrix(modifier);
 			CHECK_MSTATUS_AND_RETURN_IT(status);
 
 		}
@@ -786,34 +925,326 @@ This function is only called when the `localReferenceNode` attribute is connecte
 
 			// Connect plugs
 			//
-			status = Maxformations::connectPlugs(element, otherPlug, true);
+			status = modifier.connectPlugs(element, otherPlug, true);
 			CHECK_MSTATUS_AND_RETURN_IT(status);
 
 		}
 		else
 		{
 
-			// Break connections to ".localReferenceMatrix" plug
+			// Reset ".localReferenceMatrix" plug
 			//
-			MPlug plug = MPlug(this->thisMObject(), ExposeTransform::localReferenceMatrix);
-
-			status = Maxformations::breakConnections(plug, true, false);
+			status = this->resetLocalReferenceMatrix(modifier);
 			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-			// Reset plug value
-			//
-			status = Maxformations::resetMatrixPlug(plug);
-			CHECK_MSTATUS_AND_RETURN_IT(status);
+		}
+
+	}
+
+	return status;
+
+};
+
+
+MStatus ExposeTransform::resetLocalReferenceMatrix(Maxformations::BatchModifier& modifier)
+/**
+Queues the removal of any connections to the `localReferenceMatrix` attribute and resets it back to identity.
+The value is only reset if a connection was removed or the plug has been modified, that way unchanged scenes are not dirtied!
+
+@param modifier: The modifier to queue edits onto.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Break connections to ".localReferenceMatrix" plug
+	//
+	MPlug plug = MPlug(this->thisMObject(), ExposeTransform::localReferenceMatrix);
+	unsigned int numEdits = modifier.numEdits();
+
+	status = modifier.breakConnections(plug, true, false);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Check if plug value requires resetting
+	//
+	bool isDisconnected = modifier.numEdits() != numEdits;
+
+	if (!isDisconnected)
+	{
+
+		MObject matrixData = plug.asMObject(&status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		MMatrix matrix = Maxformations::getMatrixData(matrixData);
+
+		if (matrix.isEquivalent(MMatrix::identity))
+		{
+
+			return MS::kSuccess;  // Nothing to do here~!
 
 		}
 
 	}
 
+	// Reset plug value
+	//
+	return modifier.newPlugValue(plug, Maxformations::createMatrixData(MMatrix::identity));
+
+};
+
+
+bool ExposeTransform::isConnectedTo(const MObject& attribute, const MObjectHandle& handle)
+/**
+Evaluates if the supplied attribute is driven by the specified node.
+An invalid handle evaluates if the attribute has no incoming connection instead!
+
+@param attribute: The destination attribute.
+@param handle: The expected source node.
+@return: Is connected.
+*/
+{
+
+	MStatus status;
+
+	MPlug plug = MPlug(this->thisMObject(), attribute);
+	MPlug source = plug.source(&status);
+
+	bool isValid = handle.isValid() && handle.isAlive();
+
+	if (source.isNull())
+	{
+
+		return !isValid;
+
+	}
+	else
+	{
+
+		return isValid && source.node() == handle.object();
+
+	}
+
+};
+
+
+MStatus ExposeTransform::updateDeferredExposeMatrix(const MObject& node, Maxformations::BatchModifier& modifier)
+/**
+Deferred callback that queues the `exposeMatrix` edits for the supplied expose transform.
+See `Maxformations::deferUntilLoaded` for details.
+
+@param node: The expose transform node.
+@param modifier: The modifier to queue edits onto.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	MFnDependencyNode fnNode(node, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	ExposeTransform* exposeTransform = static_cast<ExposeTransform*>(fnNode.userNode(&status));
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Check if the loaded connections are already correct
+	// Scene files store these connections alongside the expose node so there is usually nothing left to do!
+	//
+	bool isConnected = exposeTransform->isConnectedTo(ExposeTransform::exposeMatrix, exposeTransform->exposeHandle);
+
+	if (isConnected)
+	{
+
+		return MS::kSuccess;
+
+	}
+
+	return exposeTransform->updateExposeMatrix(modifier);
+
+};
+
+
+MStatus ExposeTransform::updateDeferredLocalReferenceMatrix(const MObject& node, Maxformations::BatchModifier& modifier)
+/**
+Deferred callback that queues the `localReferenceMatrix` edits for the supplied expose transform.
+See `Maxformations::deferUntilLoaded` for details.
+
+@param node: The expose transform node.
+@param modifier: The modifier to queue edits onto.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	MFnDependencyNode fnNode(node, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	ExposeTransform* exposeTransform = static_cast<ExposeTransform*>(fnNode.userNode(&status));
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Check if the loaded connections are already correct
+	// A disconnected plug still has to be checked for a stale value, see `resetLocalReferenceMatrix` for details!
+	//
+	const MObjectHandle& handle = exposeTransform->parentEnabled ? exposeTransform->exposeHandle : exposeTransform->localReferenceHandle;
+	bool isConnected = exposeTransform->isConnectedTo(ExposeTransform::localReferenceMatrix, handle);
+
+	if (isConnected && handle.isAlive())
+	{
+
+		return MS::kSuccess;
+
+	}
+
+	return exposeTransform->updateLocalReferenceMatrix(modifier);
+
+};
+
+
+MStatus ExposeTransform::registerCallbacks()
+/**
+Registers the playback callback shared by every expose transform.
+This should only be called once from `initializePlugin`!
+
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	ExposeTransform::playbackCallbackId = MConditionMessage::addConditionCallback("playingBack", ExposeTransform::onPlayingBack, nullptr, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
 	return status;
 
 };
 
 
+MStatus ExposeTransform::deregisterCallbacks()
+/**
+Removes the playback callback shared by every expose transform.
+
+@return: Return status.
+*/
+{
+
+	MStatus status = MMessage::removeCallback(ExposeTransform::playbackCallbackId);
+
+	if (ExposeTransform::hasIdleCallback)
+	{
+
+		MMessage::removeCallback(ExposeTransform::idleCallbackId);
+		ExposeTransform::hasIdleCallback = false;
+
+	}
+
+	ExposeTransform::instances.clear();
+	ExposeTransform::pendingTrims.clear();
+
+	return status;
+
+};
+
+
+void ExposeTransform::onPlayingBack(bool state, void* clientData)
+/**
+Playback callback that updates the internal caches of every live expose transform.
+
+@param state: Is playing back.
+@param clientData: Unused.
+@return: Void.
+*/
+{
+
+	// Prune any deleted nodes
+	//
+	std::vector<MObjectHandle>& instances = ExposeTransform::instances;
+	instances.erase(std::remove_if(instances.begin(), instances.end(), [](const MObjectHandle& handle) { return !handle.isAlive(); }), instances.end());
+
+	// Check if internal caches require clearing
+	// Any edits made while stopped may have changed the matrices at other frames!
+	//
+	if (state)
+	{
+
+		ExposeTransform::pendingTrims.clear();
+
+		for (const MObjectHandle& handle : instances)
+		{
+
+			MFnDependencyNode fnNode(handle.objectRef());
+			static_cast<ExposeTransform*>(fnNode.userNode())->clearCachedMatrices();
+
+		}
+
+	}
+	else
+	{
+
+		// Queue the out-of-range trims
+		// These are processed in batches whenever maya is idle so stopping playback doesn't hitch!
+		//
+		ExposeTransform::trimStartFrame = round(MAnimControl::animationStartTime().value());
+		ExposeTransform::trimEndFrame = round(MAnimControl::animationEndTime().value());
+		ExposeTransform::pendingTrims = instances;
+
+		if (!ExposeTransform::hasIdleCallback && !ExposeTransform::pendingTrims.empty())
+		{
+
+			MStatus status;
+			ExposeTransform::idleCallbackId = MEventMessage::addEventCallback("idle", ExposeTransform::onIdle, nullptr, &status);
+
+			ExposeTransform::hasIdleCallback = status == MS::kSuccess;
+
+		}
+
+	}
+
+};
+
+
+void ExposeTransform::onIdle(void* clientData)
+/**
+Idle callback that trims the next batch of pending expose transform caches.
+
+@param clientData: Unused.
+@return: Void.
+*/
+{
+
+	std::vector<MObjectHandle>& pendingTrims = ExposeTransform::pendingTrims;
+
+	for (unsigned int i = 0; i < ExposeTransform::trimBatchSize && !pendingTrims.empty(); i++)
+	{
+
+		MObjectHandle handle = pendingTrims.back();
+		pendingTrims.pop_back();
+
+		if (!handle.isAlive())
+		{
+
+			continue;
+
+		}
+
+		MFnDependencyNode fnNode(handle.objectRef());
+		static_cast<ExposeTransform*>(fnNode.userNode())->clearOutOfRangeMatrices(ExposeTransform::trimStartFrame, ExposeTransform::trimEndFrame);
+
+	}
+
+	// Remove callback once all caches have been trimmed
+	//
+	if (pendingTrims.empty() && ExposeTransform::hasIdleCallback)
+	{
+
+		MMessage::removeCallback(ExposeTransform::idleCallbackId);
+		ExposeTransform::hasIdleCallback = false;
+
+	}
+
+};
+
+
 void* ExposeTransform::creator() 
 /**
 This function is called by Maya when a new instance is requested.
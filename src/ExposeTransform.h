@@ -36,12 +36,16 @@
 #include <maya/MDGContextGuard.h>
 #include <maya/MAnimControl.h>
 #include <maya/MConditionMessage.h>
+#include <maya/MEventMessage.h>
 #include <maya/MFileIO.h>
 #include <maya/MTypeId.h> 
 #include <maya/MGlobal.h>
 
 #include <math.h>
 #include <map>
+#include <vector>
+#include <algorithm>
+#include <mutex>
 
 
 class ExposeTransform : public Maxform
@@ -52,11 +56,16 @@ public:
 							ExposeTransform();
 	virtual					~ExposeTransform();
 
+	virtual	void			postConstructor();
 	virtual MStatus			compute(const MPlug& plug, MDataBlock& data);
+	virtual SchedulingType	schedulingType() const;
+	virtual void			getCacheSetup(const MEvaluationNode& evaluationNode, MNodeCacheDisablingInfo& disablingInfo, MNodeCacheSetupInfo& cacheSetupInfo, MObjectArray& monitoredAttributes) const;
 
 	virtual	bool			setInternalValue(const MPlug& plug, const MDataHandle& dataHandle);
 	virtual	MStatus			getCachedMatrices(const MTime& time, MMatrix& exposeMatrix, MMatrix& localReferenceMatrix);
+	virtual void			clearCachedMatrices();
 	virtual void			clearOutOfRangeMatrices();
+	virtual void			clearOutOfRangeMatrices(const unsigned int startFrame, const unsigned int endFrame);
 
 	virtual	MStatus			legalConnection(const MPlug& plug, const MPlug& otherPlug, bool asSrc, bool& isLegal);
 	virtual	MStatus			connectionMade(const MPlug& plug, const MPlug& otherPlug, bool asSrc);
@@ -65,6 +74,11 @@ public:
 	static  void*			creator();
 	static  MStatus			initialize();
 
+	static	MStatus			registerCallbacks();
+	static	MStatus			deregisterCallbacks();
+	static	void			onPlayingBack(bool state, void* clientData);
+	static	void			onIdle(void* clientData);
+
 public:
 	
 	static	MObject			exposeNode;
@@ -101,19 +115,37 @@ public:
 	static	MString			exposeCategory;
 
 	static	MTypeId			id;
+
+	static	const unsigned int	trimBatchSize;
 	
 private:
 
 	virtual	MStatus			updateExposeMatrix();
+	virtual	MStatus			updateExposeMatrix(Maxformations::BatchModifier& modifier);
 	virtual MStatus			updateLocalReferenceMatrix();
+	virtual MStatus			updateLocalReferenceMatrix(Maxformations::BatchModifier& modifier);
+	virtual MStatus			resetLocalReferenceMatrix(Maxformations::BatchModifier& modifier);
+
+	virtual	bool			isConnectedTo(const MObject& attribute, const MObjectHandle& handle);
+
+	static	MStatus			updateDeferredExposeMatrix(const MObject& node, Maxformations::BatchModifier& modifier);
+	static	MStatus			updateDeferredLocalReferenceMatrix(const MObject& node, Maxformations::BatchModifier& modifier);
 
 			MObjectHandle	exposeHandle;
 			MObjectHandle	localReferenceHandle;
 			bool			parentEnabled;
 
-			MCallbackId						callbackId;
 			std::map<unsigned int, MMatrix>	exposeMatrices;
 			std::map<unsigned int, MMatrix>	localReferenceMatrices;
+			std::mutex						cacheMutex;
+
+	static	std::vector<MObjectHandle>		instances;
+	static	std::vector<MObjectHandle>		pendingTrims;
+	static	unsigned int					trimStartFrame;
+	static	unsigned int					trimEndFrame;
+	static	MCallbackId						playbackCallbackId;
+	static	MCallbackId						idleCallbackId;
+	static	bool							hasIdleCallback;
 
 };
 
@@ -58,6 +58,8 @@ Only these values should be used when performing computations!
 
 	MStatus status;
 
+	MAXFORM_PROFILE_COMPUTE("IKChainControl::compute", this->thisMObject());
+
 	// Check requested attribute
 	//
 	MObject attribute = plug.attribute(&status);
@@ -196,7 +198,7 @@ Only these values should be used when performing computations!
 				offsetMatrices[i] = offsetRotateMatrix * worldMatrices[i];
 				parentMatrix = (i > 0) ? offsetMatrices[i - 1] : joints[0].parentMatrix;
 
-				matrices[i] = offsetMatrices[i] * parentMatrix.inverse();
+				matrices[i] = offsetMatrices[i] * Maxformations::invertMatrix(parentMatrix);
 
 			}
 
@@ -292,6 +294,8 @@ Returns an array of ik-control specs from the supplied array handle.
 */
 {
 
+	MAXFORM_PROFILE_SOLVER("IKChainControl::getJoints");
+
 	// Presize joint array
 	//
 	std::vector<IKControlSpec> joints = std::vector<IKControlSpec>();
@@ -587,7 +591,7 @@ The solution uses the default forward-x and up-y axixes in world-space!
 	MVector zAxis = (xAxis ^ upVector).normal();
 	MVector yAxis = (zAxis ^ xAxis).normal();
 
-	MMatrix swivelMatrix = Maxformations::createRotationMatrix(swivelAngle.asRadians(), 0.0, 0.0, Maxformations::AxisOrder::xyz);
+	MMatrix swivelMatrix = Maxformations::createRotationMatrix<Maxformations::AxisOrder::xyz>(swivelAngle.asRadians(), 0.0, 0.0);
 	MMatrix aimMatrix = Maxformations::composeMatrix(xAxis, yAxis, zAxis, MPoint(startPoint));
 
 	MMatrix startMatrix = swivelMatrix * aimMatrix;
@@ -620,16 +624,11 @@ The solution uses the default forward-x and up-y axixes in world-space!
 */
 {
 
-	// Calculate min/max limb length
+	// Calculate aim vector
 	//
 	double startLength = midJoint.length;
 	double endLength = endJoint.length;
 
-	double maxDistance = startLength + endLength;
-	double minDistance = std::fabs(endLength - startLength);
-
-	// Calculate aim vector
-	//
 	MVector origin = Maxformations::matrixToPosition(startJoint.worldMatrix);
 	MVector goalPoint = Maxformations::matrixToPosition(ikGoal);
 	MVector aimVector = goalPoint - origin;
@@ -639,28 +638,8 @@ The solution uses the default forward-x and up-y axixes in world-space!
 
 	// Calculate angles using law of cosines
 	//
-	double startRadian = 0.0;
-	double endRadian = 0.0;
-
-	if (distance < (minDistance + 1e-3)) // Collapsed
-	{
-
-		endRadian = 0.0; 
-
-	}
-	else if (distance > (maxDistance - 1e-3))  // Hyper-extended
-	{
-
-		endRadian = M_PI;
-
-	}
-	else  // Default
-	{
-
-		startRadian = acos((pow(startLength, 2.0) + pow(distance, 2.0) - pow(endLength, 2.0)) / (2.0 * startLength * distance));
-		endRadian = acos((pow(endLength, 2.0) + pow(startLength, 2.0) - pow(distance, 2.0)) / (2.0 * endLength * startLength));
-
-	}
+	double startRadian, endRadian;
+	MaxformCore::solveTriangle(startLength, endLength, distance, startRadian, endRadian);
 
 	// Calculate twist matrix
 	// Default orientation is: x = forward, y = up and z = right
@@ -669,13 +648,13 @@ The solution uses the default forward-x and up-y axixes in world-space!
 	MVector zAxis = (xAxis ^ upVector).normal();
 	MVector yAxis = (zAxis ^ xAxis).normal();
 
-	MMatrix swivelMatrix = Maxformations::createRotationMatrix(swivelAngle.asRadians(), 0.0, 0.0, Maxformations::AxisOrder::xyz);
+	MMatrix swivelMatrix = Maxformations::createRotationMatrix<Maxformations::AxisOrder::xyz>(swivelAngle.asRadians(), 0.0, 0.0);
 	MMatrix twistMatrix = swivelMatrix * Maxformations::composeMatrix(xAxis, yAxis, zAxis, MPoint(origin));
 
 	// Compose matrices
 	//
-	MMatrix startMatrix = Maxformations::createRotationMatrix(0.0, 0.0, startRadian, Maxformations::AxisOrder::xyz) * twistMatrix;
-	MMatrix midMatrix = Maxformations::createRotationMatrix(0.0, 0.0, -(M_PI - endRadian), Maxformations::AxisOrder::xyz) * Maxformations::createPositionMatrix(startLength, 0.0, 0.0) * startMatrix;
+	MMatrix startMatrix = Maxformations::createRotationMatrix<Maxformations::AxisOrder::xyz>(0.0, 0.0, startRadian) * twistMatrix;
+	MMatrix midMatrix = Maxformations::createRotationMatrix<Maxformations::AxisOrder::xyz>(0.0, 0.0, -(M_PI - endRadian)) * Maxformations::createPositionMatrix(startLength, 0.0, 0.0) * startMatrix;
 	MMatrix endMatrix = Maxformations::createPositionMatrix(endLength, 0.0, 0.0) * midMatrix;
 
 	// Populate matrix array
@@ -703,11 +682,7 @@ See the following: https://www.desmos.com/calculator/vx6lr2w13j
 */
 {
 
-	double a = p3.y / ((p3.x - p1.x) * (p3.x - p2.x));
-	double b = p2.y / ((p2.x - p1.x) * (p2.x - p3.x));
-	double c = p1.y / ((p1.x - p2.x) * (p1.x - p3.x));
-
-	return a * (x - p1.x) * (x - p2.x) + b * (x - p1.x) * (x - p3.x) + c * (x - p2.x) * (x - p3.x);
+	return MaxformCore::lagrange2d(x, p1.x, p1.y, p2.x, p2.y, p3.x, p3.y);
 
 };
 
@@ -715,6 +690,7 @@ See the following: https://www.desmos.com/calculator/vx6lr2w13j
 MPointArray IKChainControl::compressPoints(const MPointArray& points, const MVector& goal)
 /**
 Compresses the supplied points based on the distance change.
+See `MaxformCore::compressPoints` for details.
 
 @param points: The points to compress.
 @param effector: The current effector position.
@@ -722,140 +698,11 @@ Compresses the supplied points based on the distance change.
 */
 {
 
-	// Redundancy check
-	//
-	unsigned int pointCount = points.length();
-
-	if (!(pointCount >= 3))
-	{
-
-		return points;  // Minimum of 3 points required!
-
-	}
-
-	// Get bone specs from points
-	//
-	unsigned int boneCount = pointCount - 1;
-	unsigned int angleCount = pointCount - 2;
-
-	MDoubleArray lengths = MDoubleArray(boneCount);
-	MDoubleArray angles = MDoubleArray(angleCount);
-	
-	MVector startVector, endVector, rightVector;
-	double startLength, endLength;
-	double angle = 0.0, angleSum = 0.0;
-	double minDistance = 0.0, maxDistance = 0.0;
-	bool flipped = false, alternates = false;
-
-	for (unsigned int i = 0, j = 1, k = 2; k < pointCount; i++, j++, k++)
-	{
-
-		startVector = (points[i] - points[j]);
-		endVector = (points[k] - points[j]);
-
-		startLength = startVector.length();
-		endLength = endVector.length();
-		lengths[i] = startLength, lengths[j] = endLength;
-		minDistance = (i > 0) ? fabs(endLength - minDistance) : fabs(startLength - endLength);
-		maxDistance += (i > 0) ? endLength : startLength + endLength;
-
-		angle = startVector.angle(endVector);
-		angles[i] = angle;
-		angleSum += angle;
-
-		rightVector = (i == 0) ? (startVector ^ endVector).normal() : rightVector;
-		flipped = (i > 0) ? ((startVector ^ endVector).normal() * rightVector) <= 0.0 : false;
-		alternates = (flipped) ? true : alternates;
-
-	}
-
-	double minAngleSum = alternates ? 0.0 : ((double)boneCount - 2.0) * M_PI;
-	double maxAngleSum = M_PI * (double)angleCount;
-
-	// Compute angle weights
-	//
-	MDoubleArray weights = MDoubleArray(angleCount);
-
-	for (unsigned int i = 0; i < angleCount; i++)
-	{
-
-		weights[i] = angles[i] / angleSum;
-
-	}
-
-	// Compute new weighted angle sum
-	//
-	unsigned int lastIndex = pointCount - 1;
-	MPoint startPoint = points[0];
-	MPoint endPoint = points[lastIndex];
-
-	double distance = startPoint.distanceTo(endPoint);
-	double goalDistance = startPoint.distanceTo(goal);
-
-	double weightedAngleSum = 0.0;
-
-	if (goalDistance <= minDistance)
-	{
-
-		weightedAngleSum = minAngleSum;
-
-	}
-	else if (goalDistance >= maxDistance)
-	{
-
-		weightedAngleSum = maxAngleSum;
-
-	}
-	else
-	{
-
-		weightedAngleSum = IKChainControl::lagrange2d(goalDistance, MVector(minDistance, minAngleSum), MVector(distance, angleSum), MVector(maxDistance, maxAngleSum));  // x = distance; y = angle sum
-	
-	}
-
-	// Adjust points using weighted angles
-	//
-	MPointArray weightedPoints = MPointArray(points);
-	MVector restStartVector, restEndVector, axisVector, rotatedVector;
-	MQuaternion rotation;
-	double weightedAngle;
-
-	for (unsigned int i = 0, j = 1, k = 2; k < pointCount; i++, j++, k++)
-	{
-
-		// Derive rotation axis from vector pairs
-		//
-		restStartVector = (points[i] - points[j]).normal();
-		restEndVector = (points[k] - points[j]).normal();
-
-		axisVector = (restStartVector ^ restEndVector).normal();
-
-		// Check if start vector requires counter rotating
-		//
-		weightedAngle = weightedAngleSum * weights[i];
-		
-		if (i == 0)
-		{
-			
-			startVector = (weightedPoints[j] - weightedPoints[i]).normal();
-			rotation = MQuaternion((weightedAngle - angles[i]), -axisVector);
-			rotatedVector = startVector.rotateBy(rotation);
-
-			weightedPoints[j] = weightedPoints[i] + (rotatedVector * lengths[i]);
-			
-		}
-		
-		// Apply weighted rotation to vector
-		//
-		startVector = (weightedPoints[i] - weightedPoints[j]).normal();
-		rotation = MQuaternion(weightedAngle, axisVector);
-		rotatedVector = startVector.rotateBy(rotation);
-
-		weightedPoints[k] = weightedPoints[j] + (rotatedVector * lengths[j]);
+	MAXFORM_PROFILE_SOLVER("IKChainControl::compressPoints");
 
-	}
+	std::vector<MaxformCore::Vector3> weightedPoints = MaxformCore::compressPoints(Maxformations::toCoreVectors(points), Maxformations::toCoreVector(goal));
 
-	return weightedPoints;
+	return Maxformations::fromCoreVectors(weightedPoints);
 
 };
 
@@ -873,6 +720,8 @@ The solution uses the default forward-x and up-y axixes in world-space!
 */
 {
 
+	MAXFORM_PROFILE_SOLVER("IKChainControl::solveNBone");
+
 	// Collect points from joint chain
 	//
 	size_t jointCount = joints.size();
@@ -910,57 +759,11 @@ The solution uses the default forward-x and up-y axixes in world-space!
 
 	// Apply FABRIK to points
 	//
-	MPointArray previousPoints = MPointArray(adjustedPoints);
-	MPointArray nextPoints = MPointArray(adjustedPoints);
-
-	size_t headIndex, tailIndex;
-	MPoint headPoint, tailPoint, effectorPoint;
-	double length;
-	
-	for (unsigned int i = 0; i < iterations; i++)
-	{
-
-		// Backwards solve
-		//
-		for (size_t j = lastIndex; j > 0; j--)
-		{
-
-			headIndex = j;
-			tailIndex = j - 1;
-
-			headPoint = previousPoints[headIndex];
-			tailPoint = previousPoints[tailIndex];
-			effectorPoint = (headIndex == lastIndex) ? altGoal : nextPoints[headIndex];
-
-			length = (headPoint - tailPoint).length();
-			nextPoints[headIndex] = effectorPoint;
-			nextPoints[tailIndex] = effectorPoint + ((tailPoint - effectorPoint).normal() * length);
+	std::vector<MaxformCore::Vector3> solvedPoints = Maxformations::toCoreVectors(adjustedPoints);
+	MaxformCore::fabrik(solvedPoints, Maxformations::toCoreVector(origin), Maxformations::toCoreVector(altGoal), iterations);
+	MAXFORM_RECORD_ITERATIONS(iterations);
 
-		}
-
-		previousPoints = MPointArray(nextPoints);
-		
-		// Forwards solve
-		//
-		for (size_t j = 0; j < lastIndex; j++)
-		{
-
-			headIndex = j;
-			tailIndex = j + 1;
-
-			headPoint = previousPoints[headIndex];
-			tailPoint = previousPoints[tailIndex];
-			effectorPoint = (headIndex == 0) ? origin : nextPoints[headIndex];
-
-			length = (headPoint - tailPoint).length();
-			nextPoints[headIndex] = effectorPoint;
-			nextPoints[tailIndex] = effectorPoint + ((tailPoint - effectorPoint).normal() * length);
-
-		}
-
-		previousPoints = MPointArray(nextPoints);
-
-	}
+	MPointArray previousPoints = Maxformations::fromCoreVectors(solvedPoints);
 	
 	// Compose aim matrices from points
 	//
@@ -982,12 +785,14 @@ The solution uses the default forward-x and up-y axixes in world-space!
 	status = Maxformations::createAimMatrix(normalizedAimVector, 0, upVector, 1, origin, offsetMatrix);
 	CHECK_MSTATUS_AND_RETURN(status, matrices);
 
-	MMatrix swivelMatrix = Maxformations::createRotationMatrix(swivelAngle.asRadians(), 0.0, 0.0, Maxformations::AxisOrder::xyz);
+	MMatrix swivelMatrix = Maxformations::createRotationMatrix<Maxformations::AxisOrder::xyz>(swivelAngle.asRadians(), 0.0, 0.0);
+	MMatrix restInverseMatrix = Maxformations::rigidInverse(restMatrix);  // Aim matrices are always orthonormal!
+	MMatrix solveMatrix = swivelMatrix * offsetMatrix;
 
 	for (size_t i = 0; i < jointCount; i++)
 	{
 
-		matrices[i] = (aimMatrices[i] * restMatrix.inverse()) * (swivelMatrix * offsetMatrix);
+		matrices[i] = (aimMatrices[i] * restInverseMatrix) * solveMatrix;
 
 	}
 
@@ -51,6 +51,8 @@ Only these values should be used when performing computations!
 
 	MStatus status;
 
+	MAXFORM_PROFILE_COMPUTE("IKControl::compute", this->thisMObject());
+
 	// Check requested attribute
 	//
 	MObject attribute = plug.attribute(&status);
@@ -321,7 +323,7 @@ Provide node-specific setup info for the Cached Playback system.
 
 	// Call parent function
 	//
-	MPxNode::getCacheSetup(evaluationNode, disablingInfo, cacheSetupInfo, monitoredAttributes);
+	Matrix3Controller::getCacheSetup(evaluationNode, disablingInfo, cacheSetupInfo, monitoredAttributes);
 	assert(!disablingInfo.getCacheDisabled());
 
 	// Update caching preference
@@ -0,0 +1,299 @@
+//
+// File: ListController.cpp
+//
+// Author: Benjamin H. Singleton
+//
+
+#include "ListController.h"
+
+
+namespace ListBlend
+{
+
+	MVector Additive::identity()
+	/**
+	Returns the identity value for additive lists.
+
+	@return: Zero vector.
+	*/
+	{
+
+		return MVector::zero;
+
+	};
+
+	MVector Additive::accumulate(const std::vector<ListItem<MVector>>& items)
+	/**
+	Accumulates the supplied position items.
+	Absolute items are lerp'd towards while relative items are offset by their weighted value.
+
+	@param items: The position items to accumulate.
+	@return: The accumulated position.
+	*/
+	{
+
+		MVector average = MVector(MVector::zero);
+
+		for (const ListItem<MVector>& item : items)
+		{
+
+			// Evaluate which method to use
+			//
+			if (item.absolute)
+			{
+
+				average = Maxformations::lerp(average, item.value, item.weight);
+
+			}
+			else
+			{
+
+				average += (item.value * item.weight);
+
+			}
+
+		}
+
+		return average;
+
+	};
+
+	MQuaternion Spherical::identity()
+	/**
+	Returns the identity value for spherical lists.
+
+	@return: Identity quaternion.
+	*/
+	{
+
+		return MQuaternion::identity;
+
+	};
+
+	MQuaternion Spherical::accumulate(const std::vector<ListItem<MQuaternion>>& items) const
+	/**
+	Accumulates the supplied rotation items using this policy's slerp precision.
+	Absolute items are slerp'd towards while relative items are slerp'd from identity and then pre-multiplied.
+
+	@param items: The rotation items to accumulate.
+	@return: The accumulated rotation.
+	*/
+	{
+
+		MQuaternion average = MQuaternion(MQuaternion::identity);
+
+		for (const ListItem<MQuaternion>& item : items)
+		{
+
+			// Evaluate which method to use
+			//
+			if (item.absolute)
+			{
+
+				average = Maxformations::slerp(average, item.value, item.weight, this->precision);
+
+			}
+			else
+			{
+
+				average = Maxformations::slerp(MQuaternion::identity, item.value, item.weight, this->precision) * average;
+
+			}
+
+		}
+
+		return average;
+
+	};
+
+	MQuaternion Normalized::identity()
+	/**
+	Returns the identity value for normalized lists.
+
+	@return: Identity quaternion.
+	*/
+	{
+
+		return MQuaternion::identity;
+
+	};
+
+	MQuaternion Normalized::accumulate(const std::vector<ListItem<MQuaternion>>& items)
+	/**
+	Accumulates the supplied rotation items using nlerp in place of slerp.
+	The layer order is preserved and no trigonometry is required, see `Maxformations::nlerp` for the error bounds per layer.
+	Negative weights are mirrored through the conjugate so these bounds hold across the entire weight range, for example a 90 degree layer at -1 is exact rather than 33 degrees off!
+
+	@param items: The rotation items to accumulate.
+	@return: The accumulated rotation.
+	*/
+	{
+
+		MQuaternion average = MQuaternion(MQuaternion::identity);
+
+		for (const ListItem<MQuaternion>& item : items)
+		{
+
+			// Evaluate which method to use
+			//
+			if (item.absolute)
+			{
+
+				average = Maxformations::nlerp(average, item.value, item.weight);
+
+			}
+			else
+			{
+
+				average = Maxformations::nlerp(MQuaternion::identity, item.value, item.weight) * average;
+
+			}
+
+		}
+
+		return average;
+
+	};
+
+	MQuaternion Logarithmic::identity()
+	/**
+	Returns the identity value for logarithmic lists.
+
+	@return: Identity quaternion.
+	*/
+	{
+
+		return MQuaternion::identity;
+
+	};
+
+	MQuaternion Logarithmic::accumulate(const std::vector<ListItem<MQuaternion>>& items) const
+	/**
+	Accumulates the supplied rotation items in log-quaternion space.
+	Consecutive relative items are summed as weighted rotation vectors and only exponentiated once, absolute items are still slerp'd towards.
+	The logarithms require no trigonometry and are summed in vector registers, see `MaxformCore::sumLogMaps` for details.
+	Each logarithm deviates by at most ~0.0001 degrees so a run of relative items only requires a single sin/cos pair!
+	This is exact for a single relative item or items that share an axis, otherwise the error grows with the commutator of the layers.
+	For example two perpendicular layers deviate by roughly 0.9 degrees at 10 degrees each, 3.5 degrees at 20 degrees and 17 degrees at 45 degrees!
+
+	@param items: The rotation items to accumulate.
+	@return: The accumulated rotation.
+	*/
+	{
+
+		MQuaternion average = MQuaternion(MQuaternion::identity);
+
+		thread_local MaxformCore::QuaternionBatch quats;
+		thread_local std::vector<double> weights;
+
+		quats.clear();
+		weights.clear();
+
+		for (const ListItem<MQuaternion>& item : items)
+		{
+
+			// Evaluate which method to use
+			//
+			if (item.absolute)
+			{
+
+				// Flush any pending relative items
+				//
+				if (!quats.empty())
+				{
+
+					average = Maxformations::fromCoreQuaternion(MaxformCore::expMap(MaxformCore::sumLogMaps(quats, weights))) * average;
+
+					quats.clear();
+					weights.clear();
+
+				}
+
+				average = Maxformations::slerp(average, item.value, item.weight, this->precision);
+
+			}
+			else
+			{
+
+				// Queue relative item
+				// The shortest arc is resolved by the log kernel!
+				//
+				quats.push_back(Maxformations::toCoreQuaternion(item.value));
+				weights.push_back(item.weight);
+
+			}
+
+		}
+
+		// Flush any remaining relative items
+		//
+		if (!quats.empty())
+		{
+
+			average = Maxformations::fromCoreQuaternion(MaxformCore::expMap(MaxformCore::sumLogMaps(quats, weights))) * average;
+
+		}
+
+		return average;
+
+	};
+
+	MVector Multiplicative::identity()
+	/**
+	Returns the identity value for multiplicative lists.
+
+	@return: Unit vector.
+	*/
+	{
+
+		return MVector::one;
+
+	};
+
+	MVector Multiplicative::accumulate(const std::vector<ListItem<MVector>>& items)
+	/**
+	Accumulates the supplied scale items.
+	Absolute items are lerp'd towards while relative items are multiplied component-wise.
+
+	@param items: The scale items to accumulate.
+	@return: The accumulated scale.
+	*/
+	{
+
+		MVector average = MVector(MVector::one);
+		MVector scale;
+
+		for (const ListItem<MVector>& item : items)
+		{
+
+			// Evaluate which method to use
+			//
+			if (item.absolute)
+			{
+
+				average = Maxformations::lerp(average, item.value, item.weight);
+
+			}
+			else if (std::fabs(item.weight) > DBL_MIN)
+			{
+
+				scale = Maxformations::lerp(MVector::one, item.value, item.weight);
+				average.x *= scale.x;
+				average.y *= scale.y;
+				average.z *= scale.z;
+
+			}
+			else
+			{
+
+				continue;
+
+			}
+
+		}
+
+		return average;
+
+	};
+
+};
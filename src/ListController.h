@@ -0,0 +1,437 @@
+#ifndef _LIST_CONTROLLER
+#define _LIST_CONTROLLER
+//
+// File: ListController.h
+//
+// Author: Benjamin H. Singleton
+//
+
+#include "Maxformations.h"
+
+#include <vector>
+#include <cmath>
+#include <cfloat>
+
+#include <maya/MObject.h>
+#include <maya/MPlug.h>
+#include <maya/MPlugArray.h>
+#include <maya/MDataHandle.h>
+#include <maya/MArrayDataHandle.h>
+#include <maya/MVector.h>
+#include <maya/MQuaternion.h>
+#include <maya/MString.h>
+
+
+template<class T> struct ListItem
+{
+
+	MString	name = "";
+	float weight = 1.0;
+	bool absolute = false;
+	T value = T();
+
+};
+
+
+namespace ListBlend
+{
+
+	struct Additive
+	{
+
+		typedef MVector	ValueType;
+
+		static	MVector	identity();
+		static	MVector	accumulate(const std::vector<ListItem<MVector>>& items);
+
+	};
+
+	struct Spherical
+	{
+
+		typedef MQuaternion	ValueType;
+
+		Maxformations::SlerpPrecision	precision = Maxformations::getSlerpPrecision();
+
+		static	MQuaternion	identity();
+				MQuaternion	accumulate(const std::vector<ListItem<MQuaternion>>& items) const;
+
+	};
+
+	struct Normalized
+	{
+
+		typedef MQuaternion	ValueType;
+
+		static	MQuaternion	identity();
+		static	MQuaternion	accumulate(const std::vector<ListItem<MQuaternion>>& items);
+
+	};
+
+	struct Logarithmic
+	{
+
+		typedef MQuaternion	ValueType;
+
+		Maxformations::SlerpPrecision	precision = Maxformations::getSlerpPrecision();
+
+		static	MQuaternion	identity();
+				MQuaternion	accumulate(const std::vector<ListItem<MQuaternion>>& items) const;
+
+	};
+
+	struct Multiplicative
+	{
+
+		typedef MVector	ValueType;
+
+		static	MVector	identity();
+		static	MVector	accumulate(const std::vector<ListItem<MVector>>& items);
+
+	};
+
+};
+
+
+template<class Traits, class Policy = typename Traits::Blend> class ListController
+/**
+Shared core for the position, rotation and scale list nodes.
+The supplied traits define how list elements are read and which maxform plugs they drive while the policy, `Traits::Blend` by default, defines how the layers are accumulated.
+Policies may carry per-node settings, such as the slerp precision, which are passed along with each sum.
+*/
+{
+
+public:
+
+	typedef Policy						Blend;
+	typedef typename Blend::ValueType	ValueType;
+	typedef ListItem<ValueType>			Item;
+
+	static	ValueType	sum(MArrayDataHandle& handle, const bool normalizeWeights, MStatus* status);
+	static	ValueType	sum(MArrayDataHandle& handle, const bool normalizeWeights, const Blend& blend, MStatus* status);
+	static	ValueType	sum(MArrayDataHandle& handle, const unsigned int active, const bool normalizeWeights, MStatus* status);
+	static	ValueType	sum(MArrayDataHandle& handle, const unsigned int active, const bool normalizeWeights, const Blend& blend, MStatus* status);
+	static	ValueType	sum(std::vector<Item>& items, const bool normalizeWeights, const Blend& blend = Blend());
+	static	void		normalize(std::vector<Item>& items);
+
+	static	MStatus		pullController(const MObject& node, const MObject& transform, const unsigned int index, Maxformations::BatchModifier& modifier);
+	static	MStatus		pushController(const MObject& node, const MObject& transform, const unsigned int index, Maxformations::BatchModifier& modifier);
+
+};
+
+
+template<class Traits, class Policy> typename ListController<Traits, Policy>::ValueType ListController<Traits, Policy>::sum(MArrayDataHandle& handle, const unsigned int active, const bool normalizeWeights, MStatus* status)
+/**
+Returns the weighted average from the supplied array data handle using the default blend policy.
+
+@param handle: The array data handle to average from.
+@param active: The index to average up to.
+@param normalizeWeights: Determines if weights should be normalized.
+@param status: Returns status.
+@return: Weighted average.
+*/
+{
+
+	return ListController<Traits, Policy>::sum(handle, active, normalizeWeights, Blend(), status);
+
+};
+
+
+template<class Traits, class Policy> typename ListController<Traits, Policy>::ValueType ListController<Traits, Policy>::sum(MArrayDataHandle& handle, const unsigned int active, const bool normalizeWeights, const Blend& blend, MStatus* status)
+/**
+Returns the weighted average from the supplied array data handle.
+
+@param handle: The array data handle to average from.
+@param active: The index to average up to.
+@param normalizeWeights: Determines if weights should be normalized.
+@param blend: The blend policy to accumulate with.
+@param status: Returns status.
+@return: Weighted average.
+*/
+{
+
+	MAXFORM_PROFILE_SOLVER("ListController::sum");
+
+	// Check if active index is within range
+	//
+	unsigned int numElements = handle.elementCount(status);
+	CHECK_MSTATUS_AND_RETURN(*status, Blend::identity());
+
+	if (!(active < numElements))
+	{
+
+		return Blend::identity();
+
+	}
+
+	// Collect list entries
+	//
+	unsigned int numItems = active + 1;
+	std::vector<Item> items = std::vector<Item>(numItems);
+
+	MDataHandle elementHandle;
+
+	for (unsigned int i = 0; i < numItems; i++)
+	{
+
+		// Jump to array element
+		//
+		*status = handle.jumpToArrayElement(i);
+		CHECK_MSTATUS_AND_RETURN(*status, Blend::identity());
+
+		elementHandle = handle.inputValue(status);
+		CHECK_MSTATUS_AND_RETURN(*status, Blend::identity());
+
+		// Assign item to array
+		//
+		items[i] = Traits::getItem(elementHandle);
+
+	}
+
+	return ListController<Traits, Policy>::sum(items, normalizeWeights, blend);
+
+};
+
+
+template<class Traits, class Policy> typename ListController<Traits, Policy>::ValueType ListController<Traits, Policy>::sum(MArrayDataHandle& handle, const bool normalizeWeights, MStatus* status)
+/**
+Returns the weighted average from the supplied array data handle using the default blend policy.
+
+@param handle: The array data handle to average from.
+@param normalizeWeights: Determines if weights should be normalized.
+@param status: Returns status.
+@return: Weighted average.
+*/
+{
+
+	return ListController<Traits, Policy>::sum(handle, normalizeWeights, Blend(), status);
+
+};
+
+
+template<class Traits, class Policy> typename ListController<Traits, Policy>::ValueType ListController<Traits, Policy>::sum(MArrayDataHandle& handle, const bool normalizeWeights, const Blend& blend, MStatus* status)
+/**
+Returns the weighted average from the supplied array data handle.
+
+@param handle: The array data handle to average from.
+@param normalizeWeights: Determines if weights should be normalized.
+@param blend: The blend policy to accumulate with.
+@param status: Returns status.
+@return: Weighted average.
+*/
+{
+
+	// Check if there are enough elements
+	//
+	unsigned int elementCount = handle.elementCount();
+
+	if (elementCount > 0u)
+	{
+
+		return ListController<Traits, Policy>::sum(handle, (elementCount - 1), normalizeWeights, blend, status);
+
+	}
+	else
+	{
+
+		return Blend::identity();
+
+	}
+
+};
+
+
+template<class Traits, class Policy> typename ListController<Traits, Policy>::ValueType ListController<Traits, Policy>::sum(std::vector<Item>& items, const bool normalizeWeights, const Blend& blend)
+/**
+Returns the weighted average of the supplied list items.
+
+@param items: The list items to average.
+@param normalizeWeights: Determines if weights should be normalized.
+@param blend: The blend policy to accumulate with.
+@return: Weighted average.
+*/
+{
+
+	// Evaluate item count
+	//
+	if (items.empty())
+	{
+
+		return Blend::identity();
+
+	}
+
+	// Check if weights should be normalized
+	//
+	if (normalizeWeights)
+	{
+
+		ListController<Traits, Policy>::normalize(items);
+
+	}
+
+	// Accumulate items using blend policy
+	//
+	return blend.accumulate(items);
+
+};
+
+
+template<class Traits, class Policy> void ListController<Traits, Policy>::normalize(std::vector<Item>& items)
+/**
+Normalizes the passed weights so that the total sum equals 1.0.
+
+@param items: The items to normalize.
+@return: void
+*/
+{
+
+	// Get weight sum
+	//
+	size_t itemCount = items.size();
+	float sum = 0.0;
+
+	for (size_t i = 0; i < itemCount; i++)
+	{
+
+		sum += std::fabs(items[i].weight);
+
+	}
+
+	// Check for divide by zero errors!
+	//
+	if (sum == 0.0 || sum == 1.0)
+	{
+
+		return;
+
+	}
+
+	// Multiply weights by scale factor
+	//
+	float factor = 1.0f / sum;
+
+	for (size_t i = 0; i < itemCount; i++)
+	{
+
+		items[i].weight *= factor;
+
+	}
+
+};
+
+
+template<class Traits, class Policy> MStatus ListController<Traits, Policy>::pullController(const MObject& node, const MObject& transform, const unsigned int index, Maxformations::BatchModifier& modifier)
+/**
+Queues the transfer of any connections from the supplied maxform back to the specified list element.
+A `MS::kNotFound` status will be returned if the index is not in range!
+
+@param node: The list node.
+@param transform: The maxform node associated with the list.
+@param index: The index to transfer connections to.
+@param modifier: The modifier to queue edits onto.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Check if active index is in range
+	//
+	MPlug listPlug = MPlug(node, Traits::list());
+
+	unsigned int numElements = listPlug.numElements(&status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	if (!(index < numElements))
+	{
+
+		return MS::kNotFound;
+
+	}
+
+	// Get required plugs
+	//
+	MPlug listElement = listPlug.elementByLogicalIndex(index);
+	MPlugArray elementPlugs, transformPlugs;
+
+	Traits::getPlugs(listElement, transform, elementPlugs, transformPlugs);
+
+	// Pull connections from maxform
+	//
+	unsigned int numPlugs = elementPlugs.length();
+
+	for (unsigned int i = 0; i < numPlugs; i++)
+	{
+
+		status = modifier.breakConnections(elementPlugs[i], true, false);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = modifier.transferConnections(transformPlugs[i], elementPlugs[i]);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	return status;
+
+};
+
+
+template<class Traits, class Policy> MStatus ListController<Traits, Policy>::pushController(const MObject& node, const MObject& transform, const unsigned int index, Maxformations::BatchModifier& modifier)
+/**
+Queues the transfer of any connections from the specified list element to the supplied maxform.
+A `MS::kNotFound` status will be returned if the index is not in range!
+
+@param node: The list node.
+@param transform: The maxform node associated with the list.
+@param index: The index to transfer connections from.
+@param modifier: The modifier to queue edits onto.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Check if active index is in range
+	//
+	MPlug listPlug = MPlug(node, Traits::list());
+
+	unsigned int numElements = listPlug.numElements(&status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	if (!(index < numElements))
+	{
+
+		return MS::kNotFound;
+
+	}
+
+	// Get required plugs
+	//
+	MPlug listElement = listPlug.elementByLogicalIndex(index);
+	MPlugArray elementPlugs, transformPlugs;
+
+	Traits::getPlugs(listElement, transform, elementPlugs, transformPlugs);
+
+	// Push connections to maxform
+	//
+	unsigned int numPlugs = elementPlugs.length();
+
+	for (unsigned int i = 0; i < numPlugs; i++)
+	{
+
+		status = modifier.transferValues(elementPlugs[i], transformPlugs[i]);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = modifier.transferConnections(elementPlugs[i], transformPlugs[i]);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = modifier.connectPlugs(transformPlugs[i], elementPlugs[i], true);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	return status;
+
+};
+#endif
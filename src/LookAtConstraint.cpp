@@ -46,6 +46,7 @@ MObject LookAtConstraint::constraintInverseMatrix;
 MObject LookAtConstraint::constraintWorldMatrix;
 MObject LookAtConstraint::constraintWorldInverseMatrix;
 MObject LookAtConstraint::constraintParentInverseMatrix;
+MObject LookAtConstraint::evaluatedTargets;
 
 MString	LookAtConstraint::inputCategory("Input");
 MString	LookAtConstraint::offsetCategory("Offset");
@@ -78,6 +79,8 @@ Only these values should be used when performing computations!
 
 	MStatus status;
 
+	MAXFORM_PROFILE_COMPUTE("LookAtConstraint::compute", this->thisMObject());
+
 	// Check requested attribute
 	//
 	MObject attribute = plug.attribute(&status);
@@ -89,234 +92,415 @@ Only these values should be used when performing computations!
 	if (fnAttribute.hasCategory(LookAtConstraint::outputCategory))
 	{
 
-		// Get input data handles
+		// Get constraint matrices
+		// Any subsequent output requests within the same evaluation are derived from the cached matrices!
 		//
-		MDataHandle targetAxisHandle = data.inputValue(LookAtConstraint::targetAxis, &status);
+		MDGContext context = data.context(&status);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle targetAxisFlipHandle = data.inputValue(LookAtConstraint::targetAxisFlip, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		MMatrix constraintMatrix, constraintWorldMatrix;
+		bool isCached = this->cache.get(context, constraintMatrix, constraintWorldMatrix);
+		MAXFORM_RECORD_CACHE_ACCESS(isCached);
 
-		MDataHandle rollHandle = data.inputValue(LookAtConstraint::roll, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		if (!isCached)
+		{
 
-		MDataHandle sourceUpAxisHandle = data.inputValue(LookAtConstraint::sourceUpAxis, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			status = this->computeMatrices(data, constraintMatrix, constraintWorldMatrix);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle sourceUpAxisFlipHandle = data.inputValue(LookAtConstraint::sourceUpAxisFlip, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			this->cache.set(context, constraintMatrix, constraintWorldMatrix);
 
-		MDataHandle upNodeHandle = data.inputValue(LookAtConstraint::upNode, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		}
 
-		MDataHandle upNodeWorldHandle = data.inputValue(LookAtConstraint::upNodeWorld, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		// Update requested output
+		//
+		MObject output = plug.isChild() ? plug.parent().attribute() : attribute;
 
-		MDataHandle upNodeControlHandle = data.inputValue(LookAtConstraint::upNodeControl, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		if (output == LookAtConstraint::constraintRotate)
+		{
 
-		MDataHandle upNodeAxisHandle = data.inputValue(LookAtConstraint::upNodeAxis, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			MDataHandle constraintRotateOrderHandle = data.inputValue(LookAtConstraint::constraintRotateOrder, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle relativeHandle = data.inputValue(LookAtConstraint::relative, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			MDataHandle constraintRotateXHandle = data.outputValue(LookAtConstraint::constraintRotateX, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle offsetRotateHandle = data.inputValue(LookAtConstraint::offsetRotate, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			MDataHandle constraintRotateYHandle = data.outputValue(LookAtConstraint::constraintRotateY, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle enableRestPositionHandle = data.inputValue(LookAtConstraint::enableRestPosition, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			MDataHandle constraintRotateZHandle = data.outputValue(LookAtConstraint::constraintRotateZ, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle restRotateHandle = data.inputValue(LookAtConstraint::restRotate, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			MEulerRotation::RotationOrder constraintRotateOrder = MEulerRotation::RotationOrder(constraintRotateOrderHandle.asShort());
+			MEulerRotation constraintRotate = Maxformations::matrixToEulerRotation(constraintMatrix, constraintRotateOrder);
 
-		MDataHandle constraintTranslateHandle = data.inputValue(LookAtConstraint::constraintTranslate, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			constraintRotateXHandle.setMAngle(MAngle(constraintRotate.x, MAngle::kRadians));
+			constraintRotateYHandle.setMAngle(MAngle(constraintRotate.y, MAngle::kRadians));
+			constraintRotateZHandle.setMAngle(MAngle(constraintRotate.z, MAngle::kRadians));
 
-		MDataHandle constraintRotateOrderHandle = data.inputValue(LookAtConstraint::constraintRotateOrder, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			constraintRotateXHandle.setClean();
+			constraintRotateYHandle.setClean();
+			constraintRotateZHandle.setClean();
 
-		MDataHandle constraintParentInverseMatrixHandle = data.inputValue(LookAtConstraint::constraintParentInverseMatrix, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		}
+		else if (output == LookAtConstraint::constraintMatrix)
+		{
 
-		MArrayDataHandle targetArrayHandle = data.inputArrayValue(LookAtConstraint::target, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			MDataHandle constraintMatrixHandle = data.outputValue(LookAtConstraint::constraintMatrix, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		// Get values from handles
-		//
-		int targetAxis = targetAxisHandle.asShort();
-		bool targetAxisFlip = targetAxisFlipHandle.asBool();
-		MAngle roll = rollHandle.asAngle();
-		int sourceUpAxis = sourceUpAxisHandle.asShort();
-		bool sourceUpAxisFlip = sourceUpAxisFlipHandle.asBool();
-		bool upNodeWorld = upNodeWorldHandle.asBool();
-		int upNodeControl = upNodeControlHandle.asShort();
-		MMatrix upNodeMatrix = upNodeHandle.asMatrix();
-		int upNodeAxis = upNodeAxisHandle.asShort();
-		UpNodeSettings upNodeSettings = { upNodeMatrix, upNodeWorld, upNodeControl, upNodeAxis };
-		
-		MEulerRotation::RotationOrder constraintRotateOrder = MEulerRotation::RotationOrder(constraintRotateOrderHandle.asShort());
-		MMatrix constraintParentInverseMatrix = constraintParentInverseMatrixHandle.asMatrix();
-		MMatrix constraintParentMatrix = constraintParentInverseMatrix.inverse();
-		MVector constraintTranslate = constraintTranslateHandle.asVector();
-		MMatrix constraintTranslateMatrix = Maxformations::createPositionMatrix(constraintTranslate);
-		MVector constraintOrigin = Maxformations::matrixToPosition(constraintTranslateMatrix * constraintParentMatrix);
-		
-		bool relative = relativeHandle.asBool();
-		MVector offsetRotate = offsetRotateHandle.asVector();
-		MMatrix offsetRotateMatrix = Maxformations::createRotationMatrix(offsetRotate);
-		MMatrix offsetMatrix = relative ? offsetRotateMatrix : MMatrix::identity;
-
-		bool restEnabled = enableRestPositionHandle.asBool();
-		MVector restRotate = restRotateHandle.asVector();
-		MMatrix restRotateMatrix = Maxformations::createRotationMatrix(restRotate, constraintRotateOrder);
-		MMatrix restMatrix = restEnabled ? restRotateMatrix : MMatrix::identity;
-		MMatrix restWorldMatrix = restMatrix * constraintParentMatrix;
-
-		// Calculate up-vector
-		//
-		MVector upVector;
+			constraintMatrixHandle.setMMatrix(constraintMatrix);
+			constraintMatrixHandle.setClean();
 
-		status = LookAtConstraint::getUpVector(upNodeSettings, constraintOrigin, upVector);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		}
+		else if (output == LookAtConstraint::constraintInverseMatrix)
+		{
 
-		// Compose roll matrix
-		//
-		MMatrix rollMatrix;
+			MDataHandle constraintInverseMatrixHandle = data.outputValue(LookAtConstraint::constraintInverseMatrix, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		status = Maxformations::createTwistMatrix(targetAxis, roll, rollMatrix);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			constraintInverseMatrixHandle.setMMatrix(Maxformations::invertMatrix(constraintMatrix));
+			constraintInverseMatrixHandle.setClean();
 
-		// Collect target matrices
-		//
-		unsigned int targetCount = targetArrayHandle.elementCount();
-		MFloatArray targetWeights = MFloatArray(targetCount);
-		MMatrixArray targetMatrices = MMatrixArray(targetCount);
+		}
+		else if (output == LookAtConstraint::constraintWorldMatrix)
+		{
+
+			MDataHandle constraintWorldMatrixHandle = data.outputValue(LookAtConstraint::constraintWorldMatrix, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle targetHandle, targetWeightHandle, targetMatrixHandle, targetParentMatrixHandle;
-		MMatrix targetMatrix, targetParentMatrix, targetWorldMatrix;
+			constraintWorldMatrixHandle.setMMatrix(constraintWorldMatrix);
+			constraintWorldMatrixHandle.setClean();
 
-		for (unsigned int i = 0; i < targetCount; i++)
+		}
+		else if (output == LookAtConstraint::constraintWorldInverseMatrix)
 		{
 
-			// Jump to array element
-			//
-			status = targetArrayHandle.jumpToArrayElement(i);
+			MDataHandle constraintWorldInverseMatrixHandle = data.outputValue(LookAtConstraint::constraintWorldInverseMatrix, &status);
 			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-			targetHandle = targetArrayHandle.inputValue(&status);
-			CHECK_MSTATUS_AND_RETURN_IT(status);
+			constraintWorldInverseMatrixHandle.setMMatrix(Maxformations::invertMatrix(constraintWorldMatrix));
+			constraintWorldInverseMatrixHandle.setClean();
 
-			// Get target data handles
-			//
-			targetWeightHandle = targetHandle.child(LookAtConstraint::targetWeight);
-			targetMatrixHandle = targetHandle.child(LookAtConstraint::targetMatrix);
-			targetParentMatrixHandle = targetHandle.child(LookAtConstraint::targetParentMatrix);
+		}
+		else if (output == LookAtConstraint::evaluatedTargets)
+		{
 
-			// Get target weight
+			// The evaluated target count is written alongside the constraint matrices
 			//
-			targetWeights[i] = Maxformations::clamp(targetWeightHandle.asFloat(), 0.0f, 100.0f) / 100.0f;
+			MDataHandle evaluatedTargetsHandle = data.outputValue(LookAtConstraint::evaluatedTargets, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-			// Get target matrices
-			//
-			targetMatrix = targetMatrixHandle.asMatrix();
-			targetParentMatrix = targetParentMatrixHandle.asMatrix();
-			targetWorldMatrix = targetMatrix * targetParentMatrix;
+			evaluatedTargetsHandle.setClean();
 
-			targetMatrices[i] = targetWorldMatrix;
+		}
+		else
+		{
+
+			return MS::kUnknownParameter;
 
 		}
 
-		// Calculate aim matrix
-		// If there are no weights then default back to rest matrix!
+		// Mark data block as clean
 		//
-		float weightSum = Maxformations::sum(targetWeights);
-		MMatrix constraintWorldMatrix, constraintMatrix;
+		status = data.setClean(plug);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		if (weightSum > 0.0)
-		{
+		return MS::kSuccess;
 
-			MMatrix blendMatrix = Maxformations::blendMatrices(restWorldMatrix, targetMatrices, targetWeights);
-			MVector targetPoint = Maxformations::matrixToPosition(blendMatrix);
-			MVector forwardVector = (targetPoint - constraintOrigin).normal();
+	}
+	else
+	{
 
-			MMatrix aimMatrix;
+		return MS::kUnknownParameter;
 
-			status = Maxformations::createAimMatrix(forwardVector, targetAxis, targetAxisFlip, upVector, sourceUpAxis, sourceUpAxisFlip, constraintOrigin, aimMatrix);
-			CHECK_MSTATUS_AND_RETURN_IT(status);
+	}
 
-			constraintWorldMatrix = offsetMatrix * (rollMatrix * aimMatrix);
-			constraintMatrix = constraintWorldMatrix * constraintParentInverseMatrix;
+};
 
-		}
-		else
-		{
 
-			constraintWorldMatrix = restWorldMatrix;
-			constraintMatrix = constraintWorldMatrix * constraintParentInverseMatrix;
+MStatus LookAtConstraint::computeMatrices(MDataBlock& data, MMatrix& constraintMatrix, MMatrix& constraintWorldMatrix)
+/**
+Computes the blended constraint matrices from the node's inputs.
+This is only called once per evaluation, see `compute` for how the individual outputs are derived.
 
-		}
+@param data: Data block containing storage for the node's attributes.
+@param constraintMatrix: The passed matrix to populate.
+@param constraintWorldMatrix: The passed world matrix to populate.
+@return: Return status.
+*/
+{
 
-		// Get output data handles
-		//
-		MDataHandle constraintRotateXHandle = data.outputValue(LookAtConstraint::constraintRotateX, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+	MStatus status;
 
-		MDataHandle constraintRotateYHandle = data.outputValue(LookAtConstraint::constraintRotateY, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+	// Get input data handles
+	//
+	MDataHandle targetAxisHandle = data.inputValue(LookAtConstraint::targetAxis, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle constraintRotateZHandle = data.outputValue(LookAtConstraint::constraintRotateZ, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+	MDataHandle targetAxisFlipHandle = data.inputValue(LookAtConstraint::targetAxisFlip, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle constraintMatrixHandle = data.outputValue(LookAtConstraint::constraintMatrix, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+	MDataHandle rollHandle = data.inputValue(LookAtConstraint::roll, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle constraintInverseMatrixHandle = data.outputValue(LookAtConstraint::constraintInverseMatrix, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+	MDataHandle sourceUpAxisHandle = data.inputValue(LookAtConstraint::sourceUpAxis, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle sourceUpAxisFlipHandle = data.inputValue(LookAtConstraint::sourceUpAxisFlip, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle upNodeHandle = data.inputValue(LookAtConstraint::upNode, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle upNodeWorldHandle = data.inputValue(LookAtConstraint::upNodeWorld, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle upNodeControlHandle = data.inputValue(LookAtConstraint::upNodeControl, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle upNodeAxisHandle = data.inputValue(LookAtConstraint::upNodeAxis, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle relativeHandle = data.inputValue(LookAtConstraint::relative, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle offsetRotateHandle = data.inputValue(LookAtConstraint::offsetRotate, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle enableRestPositionHandle = data.inputValue(LookAtConstraint::enableRestPosition, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle restRotateHandle = data.inputValue(LookAtConstraint::restRotate, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle constraintTranslateHandle = data.inputValue(LookAtConstraint::constraintTranslate, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle constraintRotateOrderHandle = data.inputValue(LookAtConstraint::constraintRotateOrder, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle constraintParentInverseMatrixHandle = data.inputValue(LookAtConstraint::constraintParentInverseMatrix, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle constraintWorldMatrixHandle = data.outputValue(LookAtConstraint::constraintWorldMatrix, &status);
+	MArrayDataHandle targetArrayHandle = data.inputArrayValue(LookAtConstraint::target, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Get values from handles
+	//
+	int targetAxis = targetAxisHandle.asShort();
+	bool targetAxisFlip = targetAxisFlipHandle.asBool();
+	MAngle roll = rollHandle.asAngle();
+	int sourceUpAxis = sourceUpAxisHandle.asShort();
+	bool sourceUpAxisFlip = sourceUpAxisFlipHandle.asBool();
+	bool upNodeWorld = upNodeWorldHandle.asBool();
+	int upNodeControl = upNodeControlHandle.asShort();
+	MMatrix upNodeMatrix = upNodeHandle.asMatrix();
+	int upNodeAxis = upNodeAxisHandle.asShort();
+	UpNodeSettings upNodeSettings = { upNodeMatrix, upNodeWorld, upNodeControl, upNodeAxis };
+	
+	MEulerRotation::RotationOrder constraintRotateOrder = MEulerRotation::RotationOrder(constraintRotateOrderHandle.asShort());
+	MMatrix constraintParentInverseMatrix = constraintParentInverseMatrixHandle.asMatrix();
+	MMatrix constraintParentMatrix = Maxformations::invertMatrix(constraintParentInverseMatrix);
+	MVector constraintTranslate = constraintTranslateHandle.asVector();
+	MMatrix constraintTranslateMatrix = Maxformations::createPositionMatrix(constraintTranslate);
+	MVector constraintOrigin = Maxformations::matrixToPosition(constraintTranslateMatrix * constraintParentMatrix);
+	
+	bool relative = relativeHandle.asBool();
+	MVector offsetRotate = offsetRotateHandle.asVector();
+	MMatrix offsetRotateMatrix = Maxformations::createRotationMatrix(offsetRotate);
+	MMatrix offsetMatrix = relative ? offsetRotateMatrix : MMatrix::identity;
+
+	bool restEnabled = enableRestPositionHandle.asBool();
+	MVector restRotate = restRotateHandle.asVector();
+	MMatrix restRotateMatrix = Maxformations::createRotationMatrix(restRotate, constraintRotateOrder);
+	MMatrix restMatrix = restEnabled ? restRotateMatrix : MMatrix::identity;
+	MMatrix restWorldMatrix = restMatrix * constraintParentMatrix;
+
+	// Calculate up-vector
+	//
+	MVector upVector;
+
+	status = LookAtConstraint::getUpVector(upNodeSettings, constraintOrigin, upVector);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Compose roll matrix
+	//
+	MMatrix rollMatrix;
+
+	status = Maxformations::createTwistMatrix(targetAxis, roll, rollMatrix);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Collect target matrices
+	//
+	unsigned int targetCount = targetArrayHandle.elementCount();
+	MFloatArray targetWeights;
+	MMatrixArray targetMatrices;
+
+	float weight;
+
+	MDataHandle targetHandle, targetWeightHandle, targetMatrixHandle, targetParentMatrixHandle;
+	MMatrix targetMatrix, targetParentMatrix, targetWorldMatrix;
+
+	for (unsigned int i = 0; i < targetCount; i++)
+	{
+
+		// Jump to array element
+		//
+		status = targetArrayHandle.jumpToArrayElement(i);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle constraintWorldInverseMatrixHandle = data.outputValue(LookAtConstraint::constraintWorldInverseMatrix, &status);
+		targetHandle = targetArrayHandle.inputValue(&status);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		// Update output data handles
+		// Get target data handles
+		//
+		targetWeightHandle = targetHandle.child(LookAtConstraint::targetWeight);
+		targetMatrixHandle = targetHandle.child(LookAtConstraint::targetMatrix);
+		targetParentMatrixHandle = targetHandle.child(LookAtConstraint::targetParentMatrix);
+
+		// Get target weight
 		//
-		MEulerRotation constraintRotate = Maxformations::matrixToEulerRotation(constraintMatrix, constraintRotateOrder);
+		weight = Maxformations::clamp(targetWeightHandle.asFloat(), 0.0f, 100.0f) / 100.0f;
 
-		constraintRotateXHandle.setMAngle(MAngle(constraintRotate.x, MAngle::kRadians));
-		constraintRotateYHandle.setMAngle(MAngle(constraintRotate.y, MAngle::kRadians));
-		constraintRotateZHandle.setMAngle(MAngle(constraintRotate.z, MAngle::kRadians));
+		if (weight == 0.0f)
+		{
 
-		constraintRotateXHandle.setClean();
-		constraintRotateYHandle.setClean();
-		constraintRotateZHandle.setClean();
+			continue;  // Skip targets that don't contribute!
 
-		constraintMatrixHandle.setMMatrix(constraintMatrix);
-		constraintInverseMatrixHandle.setMMatrix(constraintMatrix.inverse());
-		constraintWorldMatrixHandle.setMMatrix(constraintWorldMatrix);
-		constraintWorldInverseMatrixHandle.setMMatrix(constraintWorldMatrix.inverse());
+		}
 
-		constraintMatrixHandle.setClean();
-		constraintInverseMatrixHandle.setClean();
-		constraintWorldMatrixHandle.setClean();
-		constraintWorldInverseMatrixHandle.setClean();
+		targetWeights.append(weight);
 
-		// Mark data block as clean
+		// Get target matrices
 		//
-		status = data.setClean(plug);
+		targetMatrix = targetMatrixHandle.asMatrix();
+		targetParentMatrix = targetParentMatrixHandle.asMatrix();
+		targetWorldMatrix = targetMatrix * targetParentMatrix;
+
+		targetMatrices.append(targetWorldMatrix);
+
+	}
+
+	// Update evaluated target count
+	//
+	MDataHandle evaluatedTargetsHandle = data.outputValue(LookAtConstraint::evaluatedTargets, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	evaluatedTargetsHandle.setInt(int(targetWeights.length()));
+	evaluatedTargetsHandle.setClean();
+
+	// Calculate aim matrix
+	// If there are no weights then default back to rest matrix!
+	//
+	float weightSum = Maxformations::sum(targetWeights);
+
+	if (weightSum > 0.0)
+	{
+
+		MMatrix blendMatrix = Maxformations::blendMatrices(restWorldMatrix, targetMatrices, targetWeights);
+		MVector targetPoint = Maxformations::matrixToPosition(blendMatrix);
+		MVector forwardVector = (targetPoint - constraintOrigin).normal();
+
+		MMatrix aimMatrix;
+
+		status = Maxformations::createAimMatrix(forwardVector, targetAxis, targetAxisFlip, upVector, sourceUpAxis, sourceUpAxisFlip, constraintOrigin, aimMatrix);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		return MS::kSuccess;
+		constraintWorldMatrix = offsetMatrix * (rollMatrix * aimMatrix);
+		constraintMatrix = constraintWorldMatrix * constraintParentInverseMatrix;
 
 	}
 	else
 	{
 
-		return MS::kUnknownParameter;
+		constraintWorldMatrix = restWorldMatrix;
+		constraintMatrix = constraintWorldMatrix * constraintParentInverseMatrix;
 
 	}
 
+	return MS::kSuccess;
+
+};
+
+
+MStatus LookAtConstraint::setDependentsDirty(const MPlug& plug, MPlugArray& plugArray)
+/**
+This method can be overridden in user defined nodes to specify which plugs should be set dirty based upon an input plug which Maya is marking dirty.
+Any input change invalidates the cached constraint matrices.
+
+@param plug: Plug which is being set dirty by Maya.
+@param plugArray: The programmer should add any plugs which they want to set dirty to this list.
+@return: Return status.
+*/
+{
+
+	this->cache.invalidate();
+
+	return MPxConstraint::setDependentsDirty(plug, plugArray);
+
+};
+
+
+MStatus LookAtConstraint::preEvaluation(const MDGContext& context, const MEvaluationNode& evaluationNode)
+/**
+Prepares the node for evaluation by the evaluation manager.
+Dirty propagation is skipped in this case so the cached constraint matrices are invalidated here instead.
+
+@param context: Context in which the evaluation will happen.
+@param evaluationNode: Evaluation node which contains information about the dirty plugs that are about to be evaluated.
+@return: Return status.
+*/
+{
+
+	if (context.isNormal())
+	{
+
+		this->cache.invalidate();
+
+	}
+
+	return MPxConstraint::preEvaluation(context, evaluationNode);
+
+};
+
+
+MPxNode::SchedulingType LookAtConstraint::schedulingType() const
+/**
+When overridden this method controls the degree of parallelism supported by the node during threaded evaluation.
+The cached constraint matrices are guarded by their own lock so this constraint can evaluate in parallel!
+
+@return: The scheduling type.
+*/
+{
+
+	return MPxNode::kParallel;
+
+};
+
+
+void LookAtConstraint::getCacheSetup(const MEvaluationNode& evaluationNode, MNodeCacheDisablingInfo& disablingInfo, MNodeCacheSetupInfo& cacheSetupInfo, MObjectArray& monitoredAttributes) const
+/**
+Provide node-specific setup info for the Cached Playback system.
+The cached constraint matrices are only trusted for normal contexts so background evaluations always recompute them!
+
+@param evaluationNode: This node's evaluation node, contains animated plug information.
+@param disablingInfo: Information about why the node disables Cached Playback to be reported to the user.
+@param cacheSetupInfo: Preferences and requirements this node has for Cached Playback.
+@param monitoredAttributes: Attributes impacting the behavior of this method that will be monitored for change.
+@return: void.
+*/
+{
+
+	// Call parent function
+	//
+	MPxConstraint::getCacheSetup(evaluationNode, disablingInfo, cacheSetupInfo, monitoredAttributes);
+	assert(!disablingInfo.getCacheDisabled());
+
+	// Update caching preference
+	//
+	cacheSetupInfo.setPreference(MNodeCacheSetupInfo::kWantToCacheByDefault, true);
+
 };
 
 
@@ -782,6 +966,15 @@ Use this function to define any static attributes.
 	CHECK_MSTATUS(fnMatrixAttr.setStorable(false));
 	CHECK_MSTATUS(fnMatrixAttr.addToCategory(LookAtConstraint::outputCategory));
 
+	// ".evaluatedTargets" attribute
+	//
+	LookAtConstraint::evaluatedTargets = fnNumericAttr.create("evaluatedTargets", "evt", MFnNumericData::kInt, 0, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnNumericAttr.setWritable(false));
+	CHECK_MSTATUS(fnNumericAttr.setStorable(false));
+	CHECK_MSTATUS(fnNumericAttr.addToCategory(LookAtConstraint::outputCategory));
+
 	// Add attributes
 	//
 	CHECK_MSTATUS(LookAtConstraint::addAttribute(LookAtConstraint::targetAxis));
@@ -805,31 +998,117 @@ Use this function to define any static attributes.
 	CHECK_MSTATUS(LookAtConstraint::addAttribute(LookAtConstraint::constraintWorldMatrix));
 	CHECK_MSTATUS(LookAtConstraint::addAttribute(LookAtConstraint::constraintWorldInverseMatrix));
 	CHECK_MSTATUS(LookAtConstraint::addAttribute(LookAtConstraint::constraintParentInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::addAttribute(LookAtConstraint::evaluatedTargets));
 
 	// Define attribute relationships
 	//
-	MObjectArray inputs, outputs;
-
-	status = Maxformations::getAttributesByCategory(LookAtConstraint::id, LookAtConstraint::inputCategory, inputs);
-	CHECK_MSTATUS_AND_RETURN_IT(status);
-
-	status = Maxformations::getAttributesByCategory(LookAtConstraint::id, LookAtConstraint::outputCategory, outputs);
-	CHECK_MSTATUS_AND_RETURN_IT(status);
-
-	unsigned int inputCount = inputs.length();
-	unsigned int outputCount = outputs.length();
-
-	for (unsigned int i = 0; i < inputCount; i++)
-	{
-
-		for (unsigned int j = 0; j < outputCount; j++)
-		{
-
-			CHECK_MSTATUS(LookAtConstraint::attributeAffects(inputs[i], outputs[j]));
-
-		}
-
-	}
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetAxis, LookAtConstraint::constraintRotate));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetAxisFlip, LookAtConstraint::constraintRotate));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::roll, LookAtConstraint::constraintRotate));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::sourceUpAxis, LookAtConstraint::constraintRotate));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::sourceUpAxisFlip, LookAtConstraint::constraintRotate));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::upNode, LookAtConstraint::constraintRotate));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::upNodeWorld, LookAtConstraint::constraintRotate));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::upNodeControl, LookAtConstraint::constraintRotate));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::upNodeAxis, LookAtConstraint::constraintRotate));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::relative, LookAtConstraint::constraintRotate));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::offsetRotate, LookAtConstraint::constraintRotate));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::enableRestPosition, LookAtConstraint::constraintRotate));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::restRotate, LookAtConstraint::constraintRotate));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::constraintTranslate, LookAtConstraint::constraintRotate));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::constraintRotateOrder, LookAtConstraint::constraintRotate));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::constraintParentInverseMatrix, LookAtConstraint::constraintRotate));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::target, LookAtConstraint::constraintRotate));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetWeight, LookAtConstraint::constraintRotate));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetMatrix, LookAtConstraint::constraintRotate));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetParentMatrix, LookAtConstraint::constraintRotate));
+
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetAxis, LookAtConstraint::constraintMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetAxisFlip, LookAtConstraint::constraintMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::roll, LookAtConstraint::constraintMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::sourceUpAxis, LookAtConstraint::constraintMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::sourceUpAxisFlip, LookAtConstraint::constraintMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::upNode, LookAtConstraint::constraintMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::upNodeWorld, LookAtConstraint::constraintMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::upNodeControl, LookAtConstraint::constraintMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::upNodeAxis, LookAtConstraint::constraintMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::relative, LookAtConstraint::constraintMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::offsetRotate, LookAtConstraint::constraintMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::enableRestPosition, LookAtConstraint::constraintMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::restRotate, LookAtConstraint::constraintMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::constraintTranslate, LookAtConstraint::constraintMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::constraintRotateOrder, LookAtConstraint::constraintMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::constraintParentInverseMatrix, LookAtConstraint::constraintMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::target, LookAtConstraint::constraintMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetWeight, LookAtConstraint::constraintMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetMatrix, LookAtConstraint::constraintMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetParentMatrix, LookAtConstraint::constraintMatrix));
+
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetAxis, LookAtConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetAxisFlip, LookAtConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::roll, LookAtConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::sourceUpAxis, LookAtConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::sourceUpAxisFlip, LookAtConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::upNode, LookAtConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::upNodeWorld, LookAtConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::upNodeControl, LookAtConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::upNodeAxis, LookAtConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::relative, LookAtConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::offsetRotate, LookAtConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::enableRestPosition, LookAtConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::restRotate, LookAtConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::constraintTranslate, LookAtConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::constraintRotateOrder, LookAtConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::constraintParentInverseMatrix, LookAtConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::target, LookAtConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetWeight, LookAtConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetMatrix, LookAtConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetParentMatrix, LookAtConstraint::constraintInverseMatrix));
+
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetAxis, LookAtConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetAxisFlip, LookAtConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::roll, LookAtConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::sourceUpAxis, LookAtConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::sourceUpAxisFlip, LookAtConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::upNode, LookAtConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::upNodeWorld, LookAtConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::upNodeControl, LookAtConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::upNodeAxis, LookAtConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::relative, LookAtConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::offsetRotate, LookAtConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::enableRestPosition, LookAtConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::restRotate, LookAtConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::constraintTranslate, LookAtConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::constraintRotateOrder, LookAtConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::constraintParentInverseMatrix, LookAtConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::target, LookAtConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetWeight, LookAtConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetMatrix, LookAtConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetParentMatrix, LookAtConstraint::constraintWorldMatrix));
+
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetAxis, LookAtConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetAxisFlip, LookAtConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::roll, LookAtConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::sourceUpAxis, LookAtConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::sourceUpAxisFlip, LookAtConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::upNode, LookAtConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::upNodeWorld, LookAtConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::upNodeControl, LookAtConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::upNodeAxis, LookAtConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::relative, LookAtConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::offsetRotate, LookAtConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::enableRestPosition, LookAtConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::restRotate, LookAtConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::constraintTranslate, LookAtConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::constraintRotateOrder, LookAtConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::constraintParentInverseMatrix, LookAtConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::target, LookAtConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetWeight, LookAtConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetMatrix, LookAtConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetParentMatrix, LookAtConstraint::constraintWorldInverseMatrix));
+
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::target, LookAtConstraint::evaluatedTargets));
+	CHECK_MSTATUS(LookAtConstraint::attributeAffects(LookAtConstraint::targetWeight, LookAtConstraint::evaluatedTargets));
 
 	return MS::kSuccess;
 
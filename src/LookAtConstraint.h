@@ -13,6 +13,12 @@
 #include <maya/MTypeId.h>
 #include <maya/MObject.h>
 #include <maya/MPlug.h>
+#include <maya/MPlugArray.h>
+#include <maya/MDGContext.h>
+#include <maya/MEvaluationNode.h>
+#include <maya/MNodeCacheDisablingInfo.h>
+#include <maya/MNodeCacheSetupInfo.h>
+#include <maya/MObjectArray.h>
 #include <maya/MDataBlock.h>
 #include <maya/MDataHandle.h>
 #include <maya/MArrayDataHandle.h>
@@ -36,6 +42,8 @@
 
 #include "Maxformations.h"
 
+#include <assert.h>
+
 
 struct UpNodeSettings
 {
@@ -57,6 +65,12 @@ public:
 	virtual				~LookAtConstraint();
 
 	virtual MStatus		compute(const MPlug& plug, MDataBlock& data);
+	virtual	MStatus		setDependentsDirty(const MPlug& plug, MPlugArray& plugArray);
+	virtual	MStatus		preEvaluation(const MDGContext& context, const MEvaluationNode& evaluationNode);
+	virtual	SchedulingType	schedulingType() const;
+	virtual	void		getCacheSetup(const MEvaluationNode& evaluationNode, MNodeCacheDisablingInfo& disablingInfo, MNodeCacheSetupInfo& cacheSetupInfo, MObjectArray& monitoredAttributes) const;
+
+			MStatus		computeMatrices(MDataBlock& data, MMatrix& constraintMatrix, MMatrix& constraintWorldMatrix);
 
 	static  void*		creator();
 	static  MStatus		initialize();
@@ -107,6 +121,7 @@ public:
 	static	MObject		constraintWorldMatrix;
 	static	MObject		constraintWorldInverseMatrix;
 	static	MObject		constraintParentInverseMatrix;
+	static	MObject		evaluatedTargets;
 
 public:
 
@@ -120,5 +135,9 @@ public:
 
 	static	MTypeId		id;
 
+protected:
+
+	Maxformations::ConstraintCache	cache;
+
 };
 #endif
\ No newline at end of file
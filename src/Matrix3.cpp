@@ -17,6 +17,8 @@ Constructor.
 { 
 	
 	this->matrixValue = MTransformationMatrix::identity; 
+	this->composedMatrix = MMatrix::identity;
+	this->isTransformation = true;
 
 };
 
@@ -134,7 +136,50 @@ Copies the the supplied transformation matrix.
 */
 {
 
-	this->matrixValue = src;  // Strictly used by `Maxform::computeLocalTransformation` method!
+	this->matrixValue = src;
+	this->composedMatrix = src.asMatrix();
+	this->isTransformation = true;
+
+};
+
+
+MStatus Matrix3::copyValues(const MObject& matrixData)
+/**
+Copies the matrix from the supplied matrix data object.
+Transformation data is copied along with its components while plain matrices are stored as is and only decomposed when a component is requested!
+Strictly used by the `Maxform::computeLocalTransformation` and `Maxform::validateAndSetValue` methods.
+
+@param matrixData: The matrix data object.
+@return: Status code.
+*/
+{
+
+	MStatus status;
+
+	MFnMatrixData fnMatrixData(matrixData, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	this->isTransformation = fnMatrixData.isTransformation(&status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	if (this->isTransformation)
+	{
+
+		this->matrixValue = fnMatrixData.transformation(&status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		this->composedMatrix = this->matrixValue.asMatrix();
+
+	}
+	else
+	{
+
+		this->composedMatrix = fnMatrixData.matrix(&status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	return status;
 
 };
 
@@ -150,7 +195,7 @@ The rotate orientation orients the local rotation space.
 */
 {
 
-	return this->matrixValue.rotationOrientation();
+	return this->isTransformation ? this->matrixValue.rotationOrientation() : MQuaternion::identity;  // Decomposed matrices never have a rotate orientation!
 
 };
 
@@ -163,7 +208,7 @@ Returns the rotate section of the transformation matrix.
 */
 {
 
-	return Maxformations::createPositionMatrix(this->matrixValue.asMatrix());
+	return Maxformations::createPositionMatrix(this->composedMatrix);
 
 };
 
@@ -176,7 +221,7 @@ Returns the rotate section of the transformation matrix.
 */
 {
 
-	return this->matrixValue.asRotateMatrix();
+	return this->isTransformation ? this->matrixValue.asRotateMatrix() : MTransformationMatrix(this->composedMatrix).asRotateMatrix();
 
 };
 
@@ -190,7 +235,7 @@ The scale matrix takes points from object space to the space immediately followi
 */
 {
 	
-	return this->matrixValue.asScaleMatrix();
+	return this->isTransformation ? this->matrixValue.asScaleMatrix() : MTransformationMatrix(this->composedMatrix).asScaleMatrix();
 
 };
 
@@ -203,7 +248,7 @@ Returns the four by four matrix that describes this transformation.
 */
 {
 
-	return this->matrixValue.asMatrix();
+	return this->composedMatrix;
 
 };
 
@@ -216,6 +261,6 @@ Returns the custom transformation matrix as a standard MTransformationMatrix.
 */
 {
 
-	return MTransformationMatrix(this->matrixValue);
+	return this->isTransformation ? MTransformationMatrix(this->matrixValue) : MTransformationMatrix(this->composedMatrix);
 
 };
\ No newline at end of file
@@ -14,6 +14,7 @@
 #include <maya/MEulerRotation.h>
 #include <maya/MMatrix.h>
 #include <maya/MTransformationMatrix.h>
+#include <maya/MFnMatrixData.h>
 #include <maya/MTypeId.h> 
 #include <maya/MGlobal.h>
 #include <math.h>
@@ -34,6 +35,7 @@ public:
 	virtual	MPxTransformationMatrix&	operator=(const MTransformationMatrix& src);
 	virtual	void						copyValues(MPxTransformationMatrix* src);
 	virtual	void						copyValues(MTransformationMatrix& src);
+	virtual	MStatus						copyValues(const MObject& matrixData);
 
 	virtual	MQuaternion					preRotation() const override;
 	virtual	MMatrix						asMatrix() const override;
@@ -47,6 +49,8 @@ public:
 protected:
 			
 			MTransformationMatrix		matrixValue;
+			MMatrix						composedMatrix;
+			bool						isTransformation;
 
 };
 #endif
\ No newline at end of file
@@ -5,6 +5,9 @@
 //
 
 #include "Matrix3Controller.h"
+#include "PositionController.h"
+#include "RotationController.h"
+#include "ScaleController.h"
 
 MObject	Matrix3Controller::value;
 MString	Matrix3Controller::valueCategory("Value");
@@ -15,7 +18,7 @@ MTypeId	Matrix3Controller::id(0x0013b1d1);
 MObject Matrix3Controller::IDENTITY_MATRIX_DATA;
 
 
-Matrix3Controller::Matrix3Controller() { this->matrix3Controller = MObjectHandle(); this->maxform = MObjectHandle(); };
+Matrix3Controller::Matrix3Controller() { this->matrix3Controller = MObjectHandle(); this->maxform = MObjectHandle(); this->associatedTransform = nullptr; this->isAssociatedTransformCached = false; };
 Matrix3Controller::~Matrix3Controller() { this->matrix3Controller = MObjectHandle(); this->maxform = MObjectHandle(); };
 
 
@@ -38,6 +41,44 @@ Only these values should be used when performing computations!
 };
 
 
+MPxNode::SchedulingType Matrix3Controller::schedulingType() const
+/**
+When overridden this method controls the degree of parallelism supported by the node during threaded evaluation.
+Any global queries, such as the scene up-axis, are read from the cached values in Maxformations so these controllers can evaluate in parallel!
+
+@return: The scheduling type.
+*/
+{
+
+	return MPxNode::kParallel;
+
+};
+
+
+void Matrix3Controller::getCacheSetup(const MEvaluationNode& evaluationNode, MNodeCacheDisablingInfo& disablingInfo, MNodeCacheSetupInfo& cacheSetupInfo, MObjectArray& monitoredAttributes) const
+/**
+Provide node-specific setup info for the Cached Playback system.
+
+@param evaluationNode: This node's evaluation node, contains animated plug information.
+@param disablingInfo: Information about why the node disables Cached Playback to be reported to the user.
+@param cacheSetupInfo: Preferences and requirements this node has for Cached Playback.
+@param monitoredAttributes: Attributes impacting the behavior of this method that will be monitored for change.
+@return: void.
+*/
+{
+
+	// Call parent function
+	//
+	MPxNode::getCacheSetup(evaluationNode, disablingInfo, cacheSetupInfo, monitoredAttributes);
+	assert(!disablingInfo.getCacheDisabled());
+
+	// Update caching preference
+	//
+	cacheSetupInfo.setPreference(MNodeCacheSetupInfo::kWantToCacheByDefault, true);
+
+};
+
+
 MStatus Matrix3Controller::connectionMade(const MPlug& plug, const MPlug& otherPlug, bool asSrc)
 /**
 This method gets called when connections are made to attributes of this node.
@@ -57,6 +98,10 @@ You should return kUnknownParameter to specify that maya should handle this conn
 	if (plug == Matrix3Controller::value && asSrc)
 	{
 
+		// Invalidate any cached transforms along this chain
+		//
+		Matrix3Controller::invalidateAssociatedTransforms(this->thisMObject());
+
 		// Evaluate other node's classification
 		//
 		MObject otherNode = otherPlug.node();
@@ -108,6 +153,10 @@ You should return kUnknownParameter to specify that maya should handle this conn
 	if (plug == Matrix3Controller::value && asSrc)
 	{
 
+		// Invalidate any cached transforms along this chain
+		//
+		Matrix3Controller::invalidateAssociatedTransforms(this->thisMObject());
+
 		// Evaluate other node's classification
 		//
 		MObject otherNode = otherPlug.node();
@@ -173,6 +222,39 @@ Maxform* Matrix3Controller::getAssociatedTransform(MStatus* status)
 Returns the maxform node associated with this matrix3 controller.
 If no maxform node exists then a null pointer is returned instead!
 
+@return: Maxform pointer.
+*/
+{
+
+	// Check if cached transform is still valid
+	// The cache is only invalidated when this chain is rewired so nested controllers only resolve once!
+	//
+	if (this->isAssociatedTransformCached)
+	{
+
+		return this->associatedTransform;
+
+	}
+
+	// Resolve transform
+	//
+	Maxform* maxform = this->resolveAssociatedTransform(status);
+	CHECK_MSTATUS_AND_RETURN(*status, nullptr);
+
+	this->associatedTransform = maxform;
+	this->isAssociatedTransformCached = true;
+
+	return maxform;
+
+};
+
+
+Maxform* Matrix3Controller::resolveAssociatedTransform(MStatus* status)
+/**
+Resolves the maxform node associated with this matrix3 controller by walking up the controller hierarchy.
+If no maxform node exists then a null pointer is returned instead!
+
+@param status: Return status.
 @return: Maxform pointer.
 */
 {
@@ -216,6 +298,131 @@ If no maxform node exists then a null pointer is returned instead!
 
 };
 
+bool Matrix3Controller::invalidateAssociatedTransform()
+/**
+Clears the cached maxform node so the next request resolves the controller hierarchy again.
+See `Matrix3Controller::invalidateAssociatedTransforms` for details.
+
+@return: Was the cached maxform node valid.
+*/
+{
+
+	bool wasCached = this->isAssociatedTransformCached;
+
+	this->associatedTransform = nullptr;
+	this->isAssociatedTransformCached = false;
+
+	return wasCached;
+
+};
+
+
+MStatus Matrix3Controller::invalidateAssociatedTransforms(const MObject& node)
+/**
+Clears the cached maxform node on the supplied controller and every controller upstream of it.
+Only the rewired chain is invalidated so any unrelated controllers keep their cached transforms!
+The walk stops at controllers that are already invalidated since everything upstream of them was cleared along with them.
+This also keeps shared branches from being walked twice and cycles from recursing forever.
+
+@param node: The controller that was rewired.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Invalidate controller
+	// Any non-controller nodes end the walk since they cannot be part of a controller chain!
+	//
+	MFnDependencyNode fnNode(node, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MPxNode* userNode = fnNode.userNode(&status);
+
+	if (userNode == nullptr)
+	{
+
+		return MS::kSuccess;
+
+	}
+
+	bool wasCached = false;
+
+	if (Matrix3Controller* controller = dynamic_cast<Matrix3Controller*>(userNode))
+	{
+
+		wasCached = controller->invalidateAssociatedTransform();
+
+	}
+	else if (PositionController* controller = dynamic_cast<PositionController*>(userNode))
+	{
+
+		wasCached = controller->invalidateAssociatedTransform();
+
+	}
+	else if (RotationController* controller = dynamic_cast<RotationController*>(userNode))
+	{
+
+		wasCached = controller->invalidateAssociatedTransform();
+
+	}
+	else if (ScaleController* controller = dynamic_cast<ScaleController*>(userNode))
+	{
+
+		wasCached = controller->invalidateAssociatedTransform();
+
+	}
+
+	if (!wasCached)
+	{
+
+		return MS::kSuccess;
+
+	}
+
+	// Walk incoming controller values
+	// Any other inputs, such as time or weights, cannot be part of a controller chain!
+	//
+	MPlugArray plugs;
+
+	status = fnNode.getConnections(plugs);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	unsigned int numPlugs = plugs.length();
+
+	for (unsigned int i = 0; i < numPlugs; i++)
+	{
+
+		MPlug source = plugs[i].source(&status);
+
+		if (source.isNull())
+		{
+
+			continue;
+
+		}
+
+		MObject attribute = source.isChild() ? source.parent().attribute() : source.attribute();
+
+		bool isValue = (attribute == Matrix3Controller::value) || (attribute == PositionController::value) || (attribute == RotationController::value) || (attribute == ScaleController::value);
+
+		if (!isValue)
+		{
+
+			continue;
+
+		}
+
+		status = Matrix3Controller::invalidateAssociatedTransforms(source.node());
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	return MS::kSuccess;
+
+};
+
+
 
 MStatus Matrix3Controller::initialize()
 /**
@@ -27,6 +27,8 @@ public:
 	virtual				~Matrix3Controller();
 
 	virtual	MStatus		compute(const MPlug& plug, MDataBlock& data);
+	virtual	SchedulingType	schedulingType() const;
+	virtual	void		getCacheSetup(const MEvaluationNode& evaluationNode, MNodeCacheDisablingInfo& disablingInfo, MNodeCacheSetupInfo& cacheSetupInfo, MObjectArray& monitoredAttributes) const;
 
 	virtual	MStatus		connectionMade(const MPlug& plug, const MPlug& otherPlug, bool asSrc);
 	virtual	MStatus		connectionBroken(const MPlug& plug, const MPlug& otherPlug, bool asSrc);
@@ -36,6 +38,9 @@ public:
 	static  MStatus		initialize();
 
 	virtual	Maxform*	getAssociatedTransform(MStatus* status);
+	virtual	Maxform*	resolveAssociatedTransform(MStatus* status);
+	virtual	bool		invalidateAssociatedTransform();
+	static	MStatus		invalidateAssociatedTransforms(const MObject& node);
 
 public:
 
@@ -51,6 +56,8 @@ protected:
 			
 			MObjectHandle	matrix3Controller;
 			MObjectHandle	maxform;
+			Maxform*		associatedTransform;
+			bool			isAssociatedTransformCached;
 
 };
 
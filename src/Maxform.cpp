@@ -23,7 +23,7 @@ MString	Maxform::classification("drawdb/geometry/transform/maxform");
 MTypeId	Maxform::id(0x0013b1cc);
 
 
-Maxform::Maxform() {};
+Maxform::Maxform() : MPxTransform() { this->hasDecomposedTransform = false; };
 Maxform::~Maxform() {};
 
 
@@ -43,6 +43,8 @@ Only these values should be used when performing computations!
 
 	MStatus status;
 
+	MAXFORM_PROFILE_COMPUTE("Maxform::compute", this->thisMObject());
+
 	// Evaluate requested plug
 	//
 	MObject attribute = plug.attribute(&status);
@@ -73,33 +75,35 @@ Only these values should be used when performing computations!
 	else if (isMatrixPart)
 	{
 
-		// Get transformation matrix
+		// Get transformation matrix data
 		//
 		MDataHandle matrixHandle = data.inputValue(Maxform::matrix, &status);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MTransformationMatrix transform = Maxformations::getTransformData(matrixHandle.data());
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		MObject matrixData = matrixHandle.data();
 
-		// Update data handles
+		// Update requested matrix part
+		// Only the rotation and scale parts require decomposing the matrix!
 		//
-		MDataHandle translationPartHandle = data.outputValue(Maxform::translationPart, &status);
+		MDataHandle partHandle = data.outputValue(plug, &status);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle rotationPartHandle = data.outputValue(Maxform::rotationPart, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		if (plug == Maxform::translationPart)
+		{
 
-		MDataHandle scalePartHandle = data.outputValue(Maxform::scalePart, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			MMatrix matrix = Maxformations::getMatrixData(matrixData);
+			partHandle.setMMatrix(Maxformations::createPositionMatrix(matrix));
+
+		}
+		else
+		{
 
-		translationPartHandle.setMMatrix(Maxformations::createPositionMatrix(transform.asMatrix()));  // Why is there no `asTranslateMatrix` function?
-		translationPartHandle.setClean();
+			MTransformationMatrix transform = this->getDecomposedTransform(matrixData);
+			partHandle.setMMatrix((plug == Maxform::rotationPart) ? transform.asRotateMatrix() : transform.asScaleMatrix());
 
-		rotationPartHandle.setMMatrix(transform.asRotateMatrix());
-		rotationPartHandle.setClean();
+		}
 
-		scalePartHandle.setMMatrix(transform.asScaleMatrix());
-		scalePartHandle.setClean();
+		partHandle.setClean();
 
 		// Mark plug as clean
 		//
@@ -119,6 +123,48 @@ Only these values should be used when performing computations!
 };
 
 
+
+MTransformationMatrix Maxform::getDecomposedTransform(const MObject& matrixData)
+/**
+Returns the transformation matrix from the supplied matrix data.
+The last decomposition is cached so the rotation and scale parts only decompose the matrix once per evaluation!
+
+@param matrixData: The matrix data object.
+@return: The transformation matrix.
+*/
+{
+
+	MMatrix matrix = Maxformations::getMatrixData(matrixData);
+
+	std::lock_guard<std::mutex> lock(this->decomposedMutex);
+
+	if (!this->hasDecomposedTransform || matrix != this->decomposedMatrix)
+	{
+
+		this->decomposedMatrix = matrix;
+		this->decomposedTransform = Maxformations::getTransformData(matrixData);
+		this->hasDecomposedTransform = true;
+
+	}
+
+	return this->decomposedTransform;
+
+};
+
+MPxNode::SchedulingType Maxform::schedulingType() const
+/**
+When overridden this method controls the degree of parallelism supported by the node during threaded evaluation.
+Maxform only reads from its own data block so it is safe to evaluate in parallel!
+
+@return: The scheduling type.
+*/
+{
+
+	return MPxNode::kParallel;
+
+};
+
+
 MStatus Maxform::computeLocalTransformation(MPxTransformationMatrix* xform, MDataBlock& data)
 /**
 This method computes the transformation matrix for a passed data block and places the output into a passed transformation matrix.
@@ -132,37 +178,23 @@ The caller needs to allocate space for the passed transformation matrix.
 
 	MStatus status;
 
+	MAXFORM_PROFILE_COMPUTE("Maxform::computeLocalTransformation", this->thisMObject());
+
 	// Call parent function
+	// This keeps the translate, rotate and scale components up to date for manipulators and the channel box!
 	//
 	status = MPxTransform::computeLocalTransformation(xform, data);
 	CHECK_MSTATUS_AND_RETURN_IT(status);
 
-	// Check if `Matrix3` was passed
+	// Update internal transformation matrix
+	// Maxform always creates a `Matrix3`, see `Maxform::createTransformationMatrix` for details!
 	//
-	Matrix3* matrix3 = dynamic_cast<Matrix3*>(xform);
-
-	if (matrix3 != nullptr)
-	{
-
-		// Update internal transformation matrix
-		//
-		MDataHandle transformHandle = data.inputValue(Maxform::transform, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
-
-		MObject transformData = transformHandle.data();
-		MTransformationMatrix transform = Maxformations::getTransformData(transformData);
-
-		matrix3->copyValues(transform);
-
-		return MS::kSuccess;
-
-	}
-	else
-	{
+	MDataHandle transformHandle = data.inputValue(Maxform::transform, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		return MS::kFailure;
+	Matrix3* matrix3 = static_cast<Matrix3*>(xform);
 
-	}
+	return matrix3->copyValues(transformHandle.data());
 
 };
 
@@ -246,13 +278,6 @@ If you have specialty code that calls this method directly you'll have to ensure
 
 		}
 
-		// Recompute local transformation matrix
-		//
-		MPxTransformationMatrix* xform = this->transformationMatrixPtr();
-
-		status = this->computeLocalTransformation(xform, data);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
-
 		// Copy transform data to output handle
 		//
 		MDataHandle outputHandle = data.outputValue(plug, &status);
@@ -264,6 +289,21 @@ If you have specialty code that calls this method directly you'll have to ensure
 		outputHandle.setClean();
 		data.setClean(plug);
 
+		// Update cached transformation matrix
+		// The incoming data is stored directly rather than recomputing the local transformation from the data block!
+		//
+		bool isNormal = MDGContext::current().isNormal();
+
+		if (isNormal)
+		{
+
+			Matrix3* matrix3 = static_cast<Matrix3*>(this->transformationMatrixPtr());
+
+			status = matrix3->copyValues(outputHandle.data());
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		}
+
 		// Mark matrix as dirty to force DAG update
 		//
 		status = this->dirtyMatrix();
@@ -13,6 +13,7 @@
 
 #include <assert.h>
 #include <map>
+#include <mutex>
 
 #include <maya/MPxTransform.h>
 #include <maya/MPxTransformationMatrix.h>
@@ -53,7 +54,9 @@ public:
 	virtual					~Maxform();
 
 	virtual MStatus			compute(const MPlug& plug, MDataBlock& data);
+	virtual SchedulingType	schedulingType() const;
 	virtual	MStatus			computeLocalTransformation(MPxTransformationMatrix* xform, MDataBlock& data);
+			MTransformationMatrix	getDecomposedTransform(const MObject& matrixData);
 	virtual bool			treatAsTransform() const;
 
 	virtual	void			getCacheSetup(const MEvaluationNode& evaluationNode, MNodeCacheDisablingInfo& disablingInfo, MNodeCacheSetupInfo& cacheSetupInfo, MObjectArray& monitoredAttributes) const;
@@ -80,5 +83,12 @@ public:
 	static	MString			classification;
 	static	MTypeId			id;
 
+protected:
+
+			bool					hasDecomposedTransform;
+			MMatrix					decomposedMatrix;
+			MTransformationMatrix	decomposedTransform;
+			std::mutex				decomposedMutex;
+
 };
 #endif
\ No newline at end of file
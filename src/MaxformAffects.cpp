@@ -0,0 +1,230 @@
+//
+// File: MaxformAffects.cpp
+//
+// MEL Command: maxformAffects
+//
+// Author: Benjamin H. Singleton
+//
+
+#include "MaxformAffects.h"
+
+MString MaxformAffects::commandName("maxformAffects");
+
+MString MaxformAffects::nodeTypes[] = {
+	"maxform",
+	"exposeTm",
+	"matrix3Controller",
+	"prs",
+	"ikChainControl",
+	"splineIKChainControl",
+	"ikControl",
+	"positionController",
+	"positionList",
+	"springPosition",
+	"rotationController",
+	"rotationList",
+	"scaleController",
+	"scaleList",
+	"positionConstraint",
+	"orientationConstraint",
+	"lookAtConstraint",
+	"pathConstraint",
+	"attachmentConstraint"
+};
+
+unsigned int MaxformAffects::nodeTypeCount = sizeof(MaxformAffects::nodeTypes) / sizeof(MString);
+
+
+MaxformAffects::MaxformAffects() {}
+MaxformAffects::~MaxformAffects() {};
+
+
+MStatus MaxformAffects::doIt(const MArgList& args)
+/**
+Reports the number of attribute affects edges for each of the supplied node types.
+If no node types are supplied then every node type registered by this plug-in is reported!
+The edge counts are returned in the same order as the node types.
+
+@param args: The command arguments.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Collect requested node types
+	//
+	MArgDatabase argDatabase(MaxformAffects::newSyntax(), args, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MStringArray typeNames;
+
+	status = argDatabase.getObjects(typeNames);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	if (typeNames.length() == 0)
+	{
+
+		for (unsigned int i = 0; i < MaxformAffects::nodeTypeCount; i++)
+		{
+
+			typeNames.append(MaxformAffects::nodeTypes[i]);
+
+		}
+
+	}
+
+	// Count edges per node type
+	//
+	unsigned int typeCount = typeNames.length();
+	MIntArray edgeCounts = MIntArray(typeCount, 0);
+
+	int edgeCount, totalCount = 0;
+	MString message;
+
+	for (unsigned int i = 0; i < typeCount; i++)
+	{
+
+		status = MaxformAffects::countEdges(typeNames[i], edgeCount);
+
+		if (!status)
+		{
+
+			MGlobal::displayError("Unable to count affects edges on: " + typeNames[i]);
+			return status;
+
+		}
+
+		message = typeNames[i];
+		message += ": ";
+		message += edgeCount;
+		message += " affects edges";
+
+		MGlobal::displayInfo(message);
+
+		edgeCounts[i] = edgeCount;
+		totalCount += edgeCount;
+
+	}
+
+	message = "Total: ";
+	message += totalCount;
+	message += " affects edges";
+
+	MGlobal::displayInfo(message);
+
+	MaxformAffects::setResult(edgeCounts);
+
+	return status;
+
+};
+
+
+bool MaxformAffects::isUndoable() const
+/**
+This method is used to specify whether or not the command is undoable.
+
+@return: bool
+*/
+{
+
+	return false;
+
+};
+
+
+bool MaxformAffects::hasSyntax() const
+/**
+This method specifies whether or not the command has a syntax object.
+
+@return: bool
+*/
+{
+
+	return true;
+
+};
+
+
+MStatus MaxformAffects::countEdges(const MString& typeName, int& edgeCount)
+/**
+Counts the attribute affects edges declared by the supplied node type.
+Each attribute is queried through the `affects` command so the count reflects the relationships Maya propagates dirty state along.
+
+@param typeName: The node type to inspect.
+@param edgeCount: The passed int to populate.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Iterate through node class attributes
+	//
+	MNodeClass nodeClass(typeName);
+
+	unsigned int attributeCount = nodeClass.attributeCount(&status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	edgeCount = 0;
+
+	MObject attribute;
+	MFnAttribute fnAttribute;
+	MStringArray affected;
+
+	for (unsigned int i = 0; i < attributeCount; i++)
+	{
+
+		// Get attribute name
+		//
+		attribute = nodeClass.attribute(i, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = fnAttribute.setObject(attribute);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		// Query attributes affected by this attribute
+		//
+		affected.clear();
+
+		status = MGlobal::executeCommand("affects -by -type \"" + typeName + "\" \"" + fnAttribute.name() + "\"", affected);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		edgeCount += affected.length();
+
+	}
+
+	return status;
+
+};
+
+
+void* MaxformAffects::creator()
+/**
+This function is called by Maya when a new instance is requested.
+See pluginMain.cpp for details.
+
+@return: MaxformAffects
+*/
+{
+
+	return new MaxformAffects();
+
+};
+
+
+MSyntax MaxformAffects::newSyntax()
+/**
+Returns the syntax object for this command.
+Any number of node type names can be supplied as objects.
+
+@return: MSyntax
+*/
+{
+
+	MSyntax syntax;
+	syntax.setObjectType(MSyntax::kStringObjects, 0);
+
+	return syntax;
+
+};
@@ -0,0 +1,48 @@
+#ifndef _MAXFORM_AFFECTS_COMMAND
+#define _MAXFORM_AFFECTS_COMMAND
+//
+// File: MaxformAffects.h
+//
+// MEL Command: maxformAffects
+//
+// Author: Benjamin H. Singleton
+//
+
+#include <maya/MPxCommand.h>
+#include <maya/MObject.h>
+#include <maya/MArgList.h>
+#include <maya/MArgDatabase.h>
+#include <maya/MSyntax.h>
+#include <maya/MString.h>
+#include <maya/MStringArray.h>
+#include <maya/MIntArray.h>
+#include <maya/MNodeClass.h>
+#include <maya/MFnAttribute.h>
+#include <maya/MGlobal.h>
+
+
+class MaxformAffects : public MPxCommand
+{
+
+public:
+
+						MaxformAffects();
+	virtual				~MaxformAffects();
+
+	virtual	MStatus		doIt(const MArgList& args);
+	virtual	bool		isUndoable() const;
+	virtual	bool		hasSyntax() const;
+
+	static	void*		creator();
+	static	MSyntax		newSyntax();
+
+	static	MStatus		countEdges(const MString& typeName, int& edgeCount);
+
+public:
+
+	static	MString		commandName;
+	static	MString		nodeTypes[];
+	static	unsigned int	nodeTypeCount;
+
+};
+#endif
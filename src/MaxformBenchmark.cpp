@@ -0,0 +1,1077 @@
+//
+// File: MaxformBenchmark.cpp
+//
+// MEL Command: maxformBenchmark
+//
+// Author: Benjamin H. Singleton
+//
+
+#include "MaxformBenchmark.h"
+
+MString MaxformBenchmark::commandName("maxformBenchmark");
+
+const char* MaxformBenchmark::iterationsFlag = "-i";
+const char* MaxformBenchmark::iterationsLongFlag = "-iterations";
+const char* MaxformBenchmark::outputFlag = "-o";
+const char* MaxformBenchmark::outputLongFlag = "-output";
+const char* MaxformBenchmark::baselineFlag = "-b";
+const char* MaxformBenchmark::baselineLongFlag = "-baseline";
+const char* MaxformBenchmark::thresholdFlag = "-t";
+const char* MaxformBenchmark::thresholdLongFlag = "-threshold";
+const char* MaxformBenchmark::sceneFlag = "-s";
+const char* MaxformBenchmark::sceneLongFlag = "-scene";
+const char* MaxformBenchmark::depthFlag = "-d";
+const char* MaxformBenchmark::depthLongFlag = "-depth";
+const char* MaxformBenchmark::controlsFlag = "-c";
+const char* MaxformBenchmark::controlsLongFlag = "-controls";
+
+const unsigned int MaxformBenchmark::seed = 1296133222;
+const unsigned int MaxformBenchmark::fixtureCount = 64;
+const unsigned int MaxformBenchmark::chainLength = 16;
+const unsigned int MaxformBenchmark::frameCount = 100;
+
+
+MaxformBenchmark::MaxformBenchmark() {}
+MaxformBenchmark::~MaxformBenchmark() {};
+
+
+MStatus MaxformBenchmark::doIt(const MArgList& args)
+/**
+Times the hot Maxformations kernels and returns the results as a JSON string.
+The results can be written to disk using the output flag and later supplied as a baseline.
+When a baseline is supplied the command fails if any kernel is slower than its baseline multiplied by the threshold!
+When a scene is supplied the time taken to open it, including any deferred wiring, is also recorded!
+When a depth is supplied the controller resolution is timed through that many nested position lists.
+When a control count is supplied playback is timed with and without the maxform evaluator.
+
+@param args: The command arguments.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Parse command arguments
+	//
+	MArgDatabase argDatabase(MaxformBenchmark::newSyntax(), args, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	int iterations = 100000;
+	int depth = 0;
+	int controlCount = 0;
+	double threshold = 1.1;
+	MString outputPath, baselinePath, scenePath;
+
+	if (argDatabase.isFlagSet(MaxformBenchmark::iterationsFlag))
+	{
+
+		status = argDatabase.getFlagArgument(MaxformBenchmark::iterationsFlag, 0, iterations);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		iterations = (iterations > 0) ? iterations : 1;
+
+	}
+
+	if (argDatabase.isFlagSet(MaxformBenchmark::thresholdFlag))
+	{
+
+		status = argDatabase.getFlagArgument(MaxformBenchmark::thresholdFlag, 0, threshold);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	if (argDatabase.isFlagSet(MaxformBenchmark::outputFlag))
+	{
+
+		status = argDatabase.getFlagArgument(MaxformBenchmark::outputFlag, 0, outputPath);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	if (argDatabase.isFlagSet(MaxformBenchmark::baselineFlag))
+	{
+
+		status = argDatabase.getFlagArgument(MaxformBenchmark::baselineFlag, 0, baselinePath);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	if (argDatabase.isFlagSet(MaxformBenchmark::depthFlag))
+	{
+
+		status = argDatabase.getFlagArgument(MaxformBenchmark::depthFlag, 0, depth);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	if (argDatabase.isFlagSet(MaxformBenchmark::controlsFlag))
+	{
+
+		status = argDatabase.getFlagArgument(MaxformBenchmark::controlsFlag, 0, controlCount);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	if (argDatabase.isFlagSet(MaxformBenchmark::sceneFlag))
+	{
+
+		status = argDatabase.getFlagArgument(MaxformBenchmark::sceneFlag, 0, scenePath);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	// Time kernels
+	//
+	MStringArray names;
+	MDoubleArray timings;
+
+	status = MaxformBenchmark::runKernels(static_cast<unsigned int>(iterations), names, timings);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	if (depth > 0)
+	{
+
+		status = MaxformBenchmark::timeControllers(static_cast<unsigned int>(iterations), static_cast<unsigned int>(depth), names, timings);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	if (controlCount > 0)
+	{
+
+		status = MaxformBenchmark::timeEvaluator(static_cast<unsigned int>(controlCount), names, timings);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	if (scenePath.length() > 0)
+	{
+
+		status = MaxformBenchmark::timeScene(scenePath, names, timings);
+
+		if (!status)
+		{
+
+			MGlobal::displayError("Unable to open benchmark scene: " + scenePath);
+			return status;
+
+		}
+
+	}
+
+	MString json = MaxformBenchmark::toJSON(static_cast<unsigned int>(iterations), names, timings);
+
+	// Write results to disk
+	//
+	if (outputPath.length() > 0)
+	{
+
+		std::ofstream file(outputPath.asChar());
+
+		if (!file.is_open())
+		{
+
+			MGlobal::displayError("Unable to write benchmark results to: " + outputPath);
+			return MS::kFailure;
+
+		}
+
+		file << json.asChar();
+		file.close();
+
+	}
+
+	MaxformBenchmark::setResult(json);
+
+	// Compare results against baseline
+	//
+	if (baselinePath.length() == 0)
+	{
+
+		return MS::kSuccess;
+
+	}
+
+	MStringArray baselineNames;
+	MDoubleArray baselineTimings;
+
+	status = MaxformBenchmark::readBaseline(baselinePath, baselineNames, baselineTimings);
+
+	if (!status)
+	{
+
+		MGlobal::displayError("Unable to read benchmark baseline from: " + baselinePath);
+		return status;
+
+	}
+
+	unsigned int nameCount = names.length();
+	unsigned int baselineCount = baselineNames.length();
+	unsigned int regressionCount = 0;
+
+	MString message;
+
+	for (unsigned int i = 0; i < nameCount; i++)
+	{
+
+		for (unsigned int j = 0; j < baselineCount; j++)
+		{
+
+			if (names[i] != baselineNames[j])
+			{
+
+				continue;
+
+			}
+
+			if (timings[i] > (baselineTimings[j] * threshold))
+			{
+
+				message = names[i];
+				message += ": ";
+				message += timings[i];
+				message += "ns per call exceeds baseline of ";
+				message += baselineTimings[j];
+				message += "ns";
+
+				MGlobal::displayWarning(message);
+				regressionCount++;
+
+			}
+
+			break;
+
+		}
+
+	}
+
+	if (regressionCount > 0)
+	{
+
+		message = "";
+		message += regressionCount;
+		message += " kernel(s) regressed past the baseline threshold!";
+
+		MGlobal::displayError(message);
+		return MS::kFailure;
+
+	}
+
+	return MS::kSuccess;
+
+};
+
+
+bool MaxformBenchmark::isUndoable() const
+/**
+This method is used to specify whether or not the command is undoable.
+
+@return: bool
+*/
+{
+
+	return false;
+
+};
+
+
+bool MaxformBenchmark::hasSyntax() const
+/**
+This method specifies whether or not the command has a syntax object.
+
+@return: bool
+*/
+{
+
+	return true;
+
+};
+
+
+template<class Kernel> double MaxformBenchmark::timeKernel(const unsigned int iterations, Kernel kernel)
+/**
+Returns the average number of nanoseconds the supplied kernel takes per call.
+Every result is folded into a volatile checksum so the calls cannot be optimized away!
+
+@param iterations: The number of calls to time.
+@param kernel: The kernel to invoke with the iteration index.
+@return: The nanoseconds per call.
+*/
+{
+
+	volatile double checksum = 0.0;
+
+	// Warm up caches before timing
+	//
+	for (unsigned int i = 0; i < MaxformBenchmark::fixtureCount; i++)
+	{
+
+		checksum = checksum + kernel(i);
+
+	}
+
+	// Time kernel
+	//
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	for (unsigned int i = 0; i < iterations; i++)
+	{
+
+		checksum = checksum + kernel(i);
+
+	}
+
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	double elapsed = std::chrono::duration<double, std::nano>(end - start).count();
+
+	return elapsed / static_cast<double>(iterations);
+
+};
+
+
+double MaxformBenchmark::random(std::mt19937& generator, const double min, const double max)
+/**
+Returns a random number between the specified range.
+The raw generator output is scaled manually since the standard distributions are not guaranteed to be stable across platforms!
+
+@param generator: The seeded generator.
+@param min: The minimum value.
+@param max: The maximum value.
+@return: The random number.
+*/
+{
+
+	double fraction = static_cast<double>(generator()) / static_cast<double>(std::mt19937::max());
+	return Maxformations::lerp(min, max, fraction);
+
+};
+
+
+MStatus MaxformBenchmark::runKernels(const unsigned int iterations, MStringArray& names, MDoubleArray& timings)
+/**
+Times each kernel using fixtures generated from a fixed seed.
+
+@param iterations: The number of calls to time per kernel.
+@param names: The passed array to populate with kernel names.
+@param timings: The passed array to populate with nanoseconds per call.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	names.clear();
+	timings.clear();
+
+	// Generate fixtures
+	//
+	std::mt19937 generator(MaxformBenchmark::seed);
+
+	const unsigned int count = MaxformBenchmark::fixtureCount;
+
+	MVectorArray angles = MVectorArray(count);
+	MMatrixArray matrices = MMatrixArray(count);
+	MMatrixArray rigidMatrices = MMatrixArray(count);
+	std::vector<MQuaternion> quats = std::vector<MQuaternion>(count);
+
+	MMatrix rotateMatrix, scaleMatrix, translateMatrix;
+
+	for (unsigned int i = 0; i < count; i++)
+	{
+
+		angles[i] = MVector(MaxformBenchmark::random(generator, -M_PI, M_PI), MaxformBenchmark::random(generator, -M_PI, M_PI), MaxformBenchmark::random(generator, -M_PI, M_PI));
+
+		rotateMatrix = Maxformations::createRotationMatrix(angles[i], Maxformations::AxisOrder::xyz);
+		scaleMatrix = Maxformations::createScaleMatrix(MaxformBenchmark::random(generator, 0.5, 2.0), MaxformBenchmark::random(generator, 0.5, 2.0), MaxformBenchmark::random(generator, 0.5, 2.0));
+		translateMatrix = Maxformations::createPositionMatrix(MaxformBenchmark::random(generator, -100.0, 100.0), MaxformBenchmark::random(generator, -100.0, 100.0), MaxformBenchmark::random(generator, -100.0, 100.0));
+
+		matrices[i] = scaleMatrix * rotateMatrix * translateMatrix;
+		rigidMatrices[i] = rotateMatrix * translateMatrix;
+		quats[i] = Maxformations::matrixToQuaternion(rotateMatrix);
+
+	}
+
+	MPointArray points = MPointArray(MaxformBenchmark::chainLength);
+	MPoint point = MPoint(MPoint::origin);
+
+	for (unsigned int i = 0; i < MaxformBenchmark::chainLength; i++)
+	{
+
+		point += MVector(MaxformBenchmark::random(generator, 5.0, 10.0), MaxformBenchmark::random(generator, -2.0, 2.0), MaxformBenchmark::random(generator, -2.0, 2.0));
+		points[i] = point;
+
+	}
+
+	MMatrixArray chain;
+
+	status = Maxformations::createAimMatrix(points, 0, false, MVector::yAxis, 1, false, chain);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Time rotation kernels for every axis order
+	//
+	const char* orderNames[] = { "xyz", "xzy", "yzx", "yxz", "zxy", "zyx", "xyx", "yzy", "zxz" };
+	Maxformations::AxisOrder axisOrder;
+
+	for (unsigned int i = 0; i < 9; i++)
+	{
+
+		axisOrder = Maxformations::AxisOrder(i + 1);
+
+		names.append(MString("createRotationMatrix.") + orderNames[i]);
+		timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { return Maxformations::createRotationMatrix(angles[index % count], axisOrder)(0, 0); }));
+
+		names.append(MString("matrixToEulerAngles.") + orderNames[i]);
+		timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { return Maxformations::matrixToEulerAngles(matrices[index % count], axisOrder).x; }));
+
+	}
+
+	// Time interpolation kernels
+	//
+	names.append("slerp.quaternion");
+	timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { return Maxformations::slerp(quats[index % count], quats[(index + 1) % count], 0.35f).w; }));
+
+	const Maxformations::SlerpPrecision precisions[3] = { Maxformations::SlerpPrecision::Exact, Maxformations::SlerpPrecision::Polynomial, Maxformations::SlerpPrecision::Nlerp };
+	const char* precisionNames[3] = { "exact", "polynomial", "nlerp" };
+
+	for (unsigned int i = 0; i < 3; i++)
+	{
+
+		Maxformations::SlerpPrecision precision = precisions[i];
+
+		names.append(MString("slerp.") + precisionNames[i]);
+		timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { return Maxformations::slerp(quats[index % count], quats[(index + 1) % count], 0.35f, precision).w; }));
+
+	}
+
+	names.append("slerp.matrix");
+	timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { return Maxformations::slerp(matrices[index % count], matrices[(index + 1) % count], 0.35f)(0, 0); }));
+
+	// Time rotation layer accumulation for every list accumulation method
+	// The logarithmic kernel replaces the slerp chain for relative layers, see `ListBlend::Logarithmic` for its error bounds!
+	//
+	std::vector<ListItem<MQuaternion>> layers;
+	MString layerName;
+
+	for (unsigned int layerCount = 2; layerCount <= 32; layerCount *= 2)
+	{
+
+		layers.resize(layerCount);
+
+		for (unsigned int i = 0; i < layerCount; i++)
+		{
+
+			layers[i].value = quats[i % count];
+			layers[i].weight = static_cast<float>(MaxformBenchmark::random(generator, 0.1, 1.0));
+
+		}
+
+		layerName = "";
+		layerName += layerCount;
+
+		names.append("accumulate.slerp." + layerName);
+		timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { return ListBlend::Spherical{ Maxformations::SlerpPrecision::Exact }.accumulate(layers).w; }));
+
+		names.append("accumulate.nlerp." + layerName);
+		timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { return ListBlend::Normalized::accumulate(layers).w; }));
+
+		names.append("accumulate.logarithmic." + layerName);
+		timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { return ListBlend::Logarithmic{ Maxformations::SlerpPrecision::Exact }.accumulate(layers).w; }));
+
+	}
+
+	MMatrixArray targets;
+	MFloatArray weights;
+	MString name;
+
+	for (unsigned int targetCount = 1; targetCount <= 32; targetCount *= 2)
+	{
+
+		targets.setLength(targetCount);
+		weights.setLength(targetCount);
+
+		for (unsigned int i = 0; i < targetCount; i++)
+		{
+
+			targets[i] = matrices[i % count];
+			weights[i] = static_cast<float>(MaxformBenchmark::random(generator, 0.1, 1.0));
+
+		}
+
+		name = "blendMatrices.";
+		name += targetCount;
+
+		names.append(name);
+		timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { return Maxformations::blendMatrices(matrices[index % count], targets, weights)(3, 0); }));
+
+		name = "blendDualQuaternions.";
+		name += targetCount;
+
+		names.append(name);
+		timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { return Maxformations::blendDualQuaternions(matrices[index % count], targets, weights)(3, 0); }));
+
+	}
+
+	// Time rotation averaging kernels
+	// These cover the target counts where orientation constraints switch from chained slerps onto the eigenvector average!
+	//
+	for (unsigned int targetCount = 2; targetCount <= 64; targetCount *= 2)
+	{
+
+		targets.setLength(targetCount);
+		weights.setLength(targetCount);
+
+		for (unsigned int i = 0; i < targetCount; i++)
+		{
+
+			targets[i] = rigidMatrices[i % count];
+			weights[i] = static_cast<float>(MaxformBenchmark::random(generator, 0.1, 1.0));
+
+		}
+
+		name = "averageQuaternions.";
+		name += targetCount;
+
+		names.append(name);
+		timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { return Maxformations::averageQuaternions(targets, weights).w; }));
+
+	}
+
+	// Time chain kernels
+	//
+	names.append("createAimMatrix.points");
+	timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { MMatrixArray aimMatrices; Maxformations::createAimMatrix(points, 0, false, MVector::yAxis, 1, false, aimMatrices); return aimMatrices[index % aimMatrices.length()](0, 0); }));
+
+	names.append("twistMatrices");
+	timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { MMatrixArray twistedMatrices = MMatrixArray(chain); Maxformations::twistMatrices(twistedMatrices, 0, MAngle(0.1), MAngle(1.2)); return twistedMatrices[index % twistedMatrices.length()](0, 0); }));
+
+	names.append("reorientMatrices");
+	timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { MMatrixArray reorientedMatrices = MMatrixArray(chain); Maxformations::reorientMatrices(reorientedMatrices, 0, false, 1, false); return reorientedMatrices[index % reorientedMatrices.length()](0, 0); }));
+
+	// Time batch kernels
+	// Each kernel writes into a reused array so only the core batch processing is measured
+	//
+	MMatrixArray localChain, worldChain;
+	MVectorArray positions;
+
+	Maxformations::staggerMatrices(chain, localChain);
+
+	names.append("staggerMatrices");
+	timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { Maxformations::staggerMatrices(chain, localChain); return localChain[index % localChain.length()](3, 0); }));
+
+	names.append("expandMatrices");
+	timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { Maxformations::expandMatrices(localChain, worldChain); return worldChain[index % worldChain.length()](3, 0); }));
+
+	names.append("matrixToPosition.array");
+	timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { Maxformations::matrixToPosition(chain, positions); return positions[index % positions.length()].x; }));
+
+	// Time decomposition kernels
+	//
+	names.append("decomposeMatrix");
+	timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { MPoint position; MQuaternion rotation; MVector scale; Maxformations::decomposeMatrix(matrices[index % count], position, rotation, scale); return position.x + rotation.w + scale.x; }));
+
+	names.append("normalizeMatrix");
+	timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { return Maxformations::normalizeMatrix(matrices[index % count])(0, 0); }));
+
+	// Time inversion kernels
+	// The structural checks in `invertMatrix` are measured against calling the known inverse directly
+	//
+	names.append("invertMatrix.rigid");
+	timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { return Maxformations::invertMatrix(rigidMatrices[index % count])(3, 0); }));
+
+	names.append("invertMatrix.affine");
+	timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { return Maxformations::invertMatrix(matrices[index % count])(3, 0); }));
+
+	names.append("rigidInverse");
+	timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { return Maxformations::rigidInverse(rigidMatrices[index % count])(3, 0); }));
+
+	names.append("affineInverse");
+	timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { return Maxformations::affineInverse(matrices[index % count])(3, 0); }));
+
+	names.append("MMatrix.inverse");
+	timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { return matrices[index % count].inverse()(3, 0); }));
+
+	// Time maxform update kernels
+	// These mirror `Maxform::computeLocalTransformation` for both PRS transformation data and plain matrix data
+	//
+	MObject transformationData = Maxformations::createMatrixData(MTransformationMatrix(matrices[0]));
+	MObject matrixData = Maxformations::createMatrixData(matrices[0]);
+
+	Matrix3 matrix3;
+
+	names.append("matrix3.copyValues.transformation");
+	timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { matrix3.copyValues(transformationData); return matrix3.asMatrix()(3, index % 3); }));
+
+	names.append("matrix3.copyValues.matrix");
+	timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { matrix3.copyValues(matrixData); return matrix3.asMatrix()(3, index % 3); }));
+
+	return MS::kSuccess;
+
+};
+
+
+MStatus MaxformBenchmark::timeScene(const MString& filePath, MStringArray& names, MDoubleArray& timings)
+/**
+Times opening the supplied scene file, such as a synthetic rig, without prompting to save any changes.
+The deferred wiring is flushed before the timer stops so the reported time covers the entire load!
+
+@param filePath: The scene file to open.
+@param names: The passed array to append the kernel name to.
+@param timings: The passed array to append the nanoseconds taken to.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	status = MFileIO::open(filePath, nullptr, true);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = Maxformations::flushDeferred(true);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+	names.append("scene.open");
+	timings.append(std::chrono::duration<double, std::nano>(end - start).count());
+
+	return MS::kSuccess;
+
+};
+
+
+MStatus MaxformBenchmark::timeControllers(const unsigned int iterations, const unsigned int depth, MStringArray& names, MDoubleArray& timings)
+/**
+Times resolving the associated maxform from the bottom of a nested controller hierarchy.
+The hierarchy is built as: maxform <- prs <- positionList <- ... <- positionList, and removed again afterwards.
+The cached lookup, invalidating an already invalidated chain from the prs, which stops at the prs, and a full resolution after invalidating are recorded.
+
+@param iterations: The number of calls to time per kernel.
+@param depth: The number of nested position lists.
+@param names: The passed array to append the kernel names to.
+@param timings: The passed array to append the nanoseconds per call to.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Create maxform
+	//
+	MDagModifier dagModifier;
+
+	MObject maxform = dagModifier.createNode("maxform", MObject::kNullObj, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = dagModifier.doIt();
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Create nested controllers
+	//
+	MDGModifier modifier;
+
+	MObject prs = modifier.createNode("prs", &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = modifier.connect(MPlug(prs, Matrix3Controller::value), MPlug(maxform, Maxform::transform));
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MPlug destination = MPlug(prs, PRS::position);
+	MObject controller;
+
+	for (unsigned int i = 0; i < depth; i++)
+	{
+
+		controller = modifier.createNode("positionList", &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = modifier.connect(MPlug(controller, PositionController::value), destination);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		MPlug element = MPlug(controller, PositionList::list).elementByLogicalIndex(0, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		destination = element.child(PositionList::position, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	status = modifier.doIt();
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Time lookups from the deepest controller
+	//
+	MFnDependencyNode fnNode(controller, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	PositionList* list = static_cast<PositionList*>(fnNode.userNode(&status));
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MString prefix = "getAssociatedTransform.depth";
+	prefix += depth;
+
+	names.append(prefix + ".cached");
+	timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { MStatus kernelStatus; return list->getAssociatedTransform(&kernelStatus) != nullptr ? 1.0 : 0.0; }));
+
+	names.append(prefix + ".invalidated");
+	timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { return Matrix3Controller::invalidateAssociatedTransforms(prs) ? 1.0 : 0.0; }));
+
+	names.append(prefix + ".resolved");
+	timings.append(MaxformBenchmark::timeKernel(iterations, [&](unsigned int index) { MStatus kernelStatus; Matrix3Controller::invalidateAssociatedTransforms(prs); return list->getAssociatedTransform(&kernelStatus) != nullptr ? 1.0 : 0.0; }));
+
+	// Remove hierarchy
+	//
+	status = modifier.undoIt();
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = dagModifier.undoIt();
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	return MS::kSuccess;
+
+};
+
+
+MStatus MaxformBenchmark::timeEvaluator(const unsigned int controlCount, MStringArray& names, MDoubleArray& timings)
+/**
+Times playing back the supplied number of controls with the stock evaluation and with the maxform evaluator fusing their controller stacks.
+Each control is built as: maxform <- prs <- positionList, rotationList and scaleList, with every list driven by time, and removed again afterwards.
+The evaluation manager is switched into parallel mode while timing, the previous mode, evaluator state and time are restored afterwards!
+
+@param controlCount: The number of controls to play back.
+@param names: The passed array to append the kernel names to.
+@param timings: The passed array to append the nanoseconds per frame to.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Create maxforms
+	//
+	MDagModifier dagModifier;
+	MObjectArray maxforms;
+
+	for (unsigned int i = 0; i < controlCount; i++)
+	{
+
+		MObject maxform = dagModifier.createNode("maxform", MObject::kNullObj, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		maxforms.append(maxform);
+
+	}
+
+	status = dagModifier.doIt();
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Create controller stacks
+	// Time is connected through commands so the required unit conversions are inserted!
+	//
+	MDGModifier modifier;
+
+	for (unsigned int i = 0; i < controlCount; i++)
+	{
+
+		MObject prs = modifier.createNode("prs", &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		MObject positionList = modifier.createNode("positionList", &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		MObject rotationList = modifier.createNode("rotationList", &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		MObject scaleList = modifier.createNode("scaleList", &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = modifier.connect(MPlug(prs, Matrix3Controller::value), MPlug(maxforms[i], Maxform::transform));
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = modifier.connect(MPlug(positionList, PositionController::value), MPlug(prs, PRS::position));
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = modifier.connect(MPlug(rotationList, RotationController::value), MPlug(prs, PRS::rotation));
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = modifier.connect(MPlug(scaleList, ScaleController::value), MPlug(prs, PRS::scale));
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = modifier.doIt();
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		MPlug positionPlug = MPlug(positionList, PositionList::list).elementByLogicalIndex(0).child(PositionList::position).child(PositionList::x_position);
+		MPlug rotationPlug = MPlug(rotationList, RotationList::list).elementByLogicalIndex(0).child(RotationList::rotation).child(RotationList::y_rotation);
+		MPlug scalePlug = MPlug(scaleList, ScaleList::list).elementByLogicalIndex(0).child(ScaleList::scale).child(ScaleList::z_scale);
+
+		status = modifier.commandToExecute("connectAttr -force time1.outTime " + positionPlug.name());
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = modifier.commandToExecute("connectAttr -force time1.outTime " + rotationPlug.name());
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = modifier.commandToExecute("connectAttr -force time1.outTime " + scalePlug.name());
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	status = modifier.doIt();
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Store evaluation state
+	//
+	MStringArray evaluationModes;
+
+	status = MGlobal::executeCommand("evaluationManager -query -mode", evaluationModes);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	int isEnabled = 0;
+
+	status = MGlobal::executeCommand("evaluator -query -enable -name " + MaxformEvaluator::evaluatorName, isEnabled);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MTime currentTime = MAnimControl::currentTime();
+
+	status = MGlobal::executeCommand("evaluationManager -mode \"parallel\"");
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Time playback with and without the evaluator
+	// The first frames are skipped since they rebuild the evaluation graph and discover each cluster!
+	//
+	const char* modeNames[2] = { "stock", "fused" };
+	MString name;
+
+	for (unsigned int mode = 0; mode < 2; mode++)
+	{
+
+		MString command = "evaluator -enable ";
+		command += mode;
+		command += " -name " + MaxformEvaluator::evaluatorName;
+
+		status = MGlobal::executeCommand(command);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		MAnimControl::setCurrentTime(MTime(0.0));
+		MAnimControl::setCurrentTime(MTime(1.0));
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+		for (unsigned int frame = 2; frame < (MaxformBenchmark::frameCount + 2); frame++)
+		{
+
+			MAnimControl::setCurrentTime(MTime(static_cast<double>(frame)));
+
+		}
+
+		std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+		name = "evaluator.";
+		name += modeNames[mode];
+		name += ".";
+		name += controlCount;
+
+		names.append(name);
+		timings.append(std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(MaxformBenchmark::frameCount));
+
+	}
+
+	// Restore evaluation state
+	//
+	MString command = "evaluator -enable ";
+	command += isEnabled;
+	command += " -name " + MaxformEvaluator::evaluatorName;
+
+	status = MGlobal::executeCommand(command);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	if (evaluationModes.length() > 0)
+	{
+
+		status = MGlobal::executeCommand("evaluationManager -mode \"" + evaluationModes[0] + "\"");
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	MAnimControl::setCurrentTime(currentTime);
+
+	// Remove controls
+	//
+	status = modifier.undoIt();
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = dagModifier.undoIt();
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	return MS::kSuccess;
+
+};
+
+
+MString MaxformBenchmark::toJSON(const unsigned int iterations, const MStringArray& names, const MDoubleArray& timings)
+/**
+Serializes the supplied kernel timings into a JSON string.
+The timings are stored in nanoseconds per call.
+
+@param iterations: The number of calls timed per kernel.
+@param names: The kernel names.
+@param timings: The kernel timings.
+@return: The JSON string.
+*/
+{
+
+	MString json, value;
+	json += "{\n\t\"iterations\": ";
+	json += iterations;
+	json += ",\n\t\"kernels\": {\n";
+
+	unsigned int nameCount = names.length();
+
+	for (unsigned int i = 0; i < nameCount; i++)
+	{
+
+		value.set(timings[i], 3);
+
+		json += "\t\t\"";
+		json += names[i];
+		json += "\": ";
+		json += value;
+		json += ((i + 1) < nameCount) ? ",\n" : "\n";
+
+	}
+
+	json += "\t}\n}\n";
+
+	return json;
+
+};
+
+
+MStatus MaxformBenchmark::readBaseline(const MString& filePath, MStringArray& names, MDoubleArray& timings)
+/**
+Reads the kernel timings from a JSON file previously written by this command.
+Only the flat "kernels" object is parsed so this is not a general purpose JSON reader!
+
+@param filePath: The baseline file to read.
+@param names: The passed array to populate with kernel names.
+@param timings: The passed array to populate with nanoseconds per call.
+@return: Return status.
+*/
+{
+
+	names.clear();
+	timings.clear();
+
+	// Read file contents
+	//
+	std::ifstream file(filePath.asChar());
+
+	if (!file.is_open())
+	{
+
+		return MS::kFailure;
+
+	}
+
+	std::stringstream stream;
+	stream << file.rdbuf();
+
+	std::string contents = stream.str();
+
+	// Locate kernels object
+	//
+	size_t position = contents.find("\"kernels\"");
+
+	if (position == std::string::npos)
+	{
+
+		return MS::kFailure;
+
+	}
+
+	position = contents.find('{', position);
+
+	if (position == std::string::npos)
+	{
+
+		return MS::kFailure;
+
+	}
+
+	// Collect name/value pairs
+	//
+	size_t closing = contents.find('}', position);
+	size_t nameStart, nameEnd, valueStart;
+	char* valueEnd;
+	double timing;
+
+	while (true)
+	{
+
+		nameStart = contents.find('"', position);
+
+		if (nameStart == std::string::npos || nameStart > closing)
+		{
+
+			break;
+
+		}
+
+		nameEnd = contents.find('"', nameStart + 1);
+		valueStart = contents.find(':', nameEnd);
+
+		if (nameEnd == std::string::npos || valueStart == std::string::npos)
+		{
+
+			return MS::kFailure;
+
+		}
+
+		timing = std::strtod(contents.c_str() + valueStart + 1, &valueEnd);
+
+		names.append(contents.substr(nameStart + 1, nameEnd - nameStart - 1).c_str());
+		timings.append(timing);
+
+		position = static_cast<size_t>(valueEnd - contents.c_str());
+
+	}
+
+	return MS::kSuccess;
+
+};
+
+
+void* MaxformBenchmark::creator()
+/**
+This function is called by Maya when a new instance is requested.
+See pluginMain.cpp for details.
+
+@return: MaxformBenchmark
+*/
+{
+
+	return new MaxformBenchmark();
+
+};
+
+
+MSyntax MaxformBenchmark::newSyntax()
+/**
+Returns the syntax object for this command.
+
+@return: MSyntax
+*/
+{
+
+	MSyntax syntax;
+	syntax.addFlag(MaxformBenchmark::iterationsFlag, MaxformBenchmark::iterationsLongFlag, MSyntax::kLong);
+	syntax.addFlag(MaxformBenchmark::outputFlag, MaxformBenchmark::outputLongFlag, MSyntax::kString);
+	syntax.addFlag(MaxformBenchmark::baselineFlag, MaxformBenchmark::baselineLongFlag, MSyntax::kString);
+	syntax.addFlag(MaxformBenchmark::thresholdFlag, MaxformBenchmark::thresholdLongFlag, MSyntax::kDouble);
+	syntax.addFlag(MaxformBenchmark::sceneFlag, MaxformBenchmark::sceneLongFlag, MSyntax::kString);
+	syntax.addFlag(MaxformBenchmark::depthFlag, MaxformBenchmark::depthLongFlag, MSyntax::kLong);
+	syntax.addFlag(MaxformBenchmark::controlsFlag, MaxformBenchmark::controlsLongFlag, MSyntax::kLong);
+
+	return syntax;
+
+};
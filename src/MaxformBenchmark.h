@@ -0,0 +1,105 @@
+#ifndef _MAXFORM_BENCHMARK_COMMAND
+#define _MAXFORM_BENCHMARK_COMMAND
+//
+// File: MaxformBenchmark.h
+//
+// MEL Command: maxformBenchmark
+//
+// Author: Benjamin H. Singleton
+//
+
+#include <maya/MPxCommand.h>
+#include <maya/MObject.h>
+#include <maya/MArgList.h>
+#include <maya/MArgDatabase.h>
+#include <maya/MSyntax.h>
+#include <maya/MString.h>
+#include <maya/MStringArray.h>
+#include <maya/MDoubleArray.h>
+#include <maya/MFloatArray.h>
+#include <maya/MVector.h>
+#include <maya/MVectorArray.h>
+#include <maya/MPoint.h>
+#include <maya/MPointArray.h>
+#include <maya/MQuaternion.h>
+#include <maya/MMatrix.h>
+#include <maya/MMatrixArray.h>
+#include <maya/MAngle.h>
+#include <maya/MGlobal.h>
+#include <maya/MFileIO.h>
+#include <maya/MDGModifier.h>
+#include <maya/MDagModifier.h>
+#include <maya/MFnDependencyNode.h>
+#include <maya/MObjectArray.h>
+#include <maya/MAnimControl.h>
+#include <maya/MTime.h>
+
+#include <vector>
+#include <random>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cstdlib>
+
+#include "Maxformations.h"
+#include "Matrix3.h"
+#include "Maxform.h"
+#include "PRS.h"
+#include "PositionList.h"
+#include "RotationList.h"
+#include "ScaleList.h"
+#include "MaxformEvaluator.h"
+
+
+class MaxformBenchmark : public MPxCommand
+{
+
+public:
+
+							MaxformBenchmark();
+	virtual					~MaxformBenchmark();
+
+	virtual	MStatus			doIt(const MArgList& args);
+	virtual	bool			isUndoable() const;
+	virtual	bool			hasSyntax() const;
+
+	static	void*			creator();
+	static	MSyntax			newSyntax();
+
+	static	MStatus			runKernels(const unsigned int iterations, MStringArray& names, MDoubleArray& timings);
+	static	MStatus			timeScene(const MString& filePath, MStringArray& names, MDoubleArray& timings);
+	static	MStatus			timeControllers(const unsigned int iterations, const unsigned int depth, MStringArray& names, MDoubleArray& timings);
+	static	MStatus			timeEvaluator(const unsigned int controlCount, MStringArray& names, MDoubleArray& timings);
+	static	MString			toJSON(const unsigned int iterations, const MStringArray& names, const MDoubleArray& timings);
+	static	MStatus			readBaseline(const MString& filePath, MStringArray& names, MDoubleArray& timings);
+
+	template<class Kernel> static	double	timeKernel(const unsigned int iterations, Kernel kernel);
+	static	double			random(std::mt19937& generator, const double min, const double max);
+
+public:
+
+	static	MString			commandName;
+
+	static	const char*		iterationsFlag;
+	static	const char*		iterationsLongFlag;
+	static	const char*		outputFlag;
+	static	const char*		outputLongFlag;
+	static	const char*		baselineFlag;
+	static	const char*		baselineLongFlag;
+	static	const char*		thresholdFlag;
+	static	const char*		thresholdLongFlag;
+	static	const char*		sceneFlag;
+	static	const char*		sceneLongFlag;
+	static	const char*		depthFlag;
+	static	const char*		depthLongFlag;
+	static	const char*		controlsFlag;
+	static	const char*		controlsLongFlag;
+
+	static	const unsigned int	seed;
+	static	const unsigned int	fixtureCount;
+	static	const unsigned int	chainLength;
+	static	const unsigned int	frameCount;
+
+};
+#endif
@@ -0,0 +1,2199 @@
+//
+// File: MaxformCore.cpp
+//
+// Author: Benjamin H. Singleton
+//
+
+#include "MaxformCore.h"
+
+
+namespace MaxformCore
+{
+
+	// Eberly's polynomial coefficients, see `MaxformCore::slerpWeights` for details
+	//
+	const double SLERP_MU = 1.85298109240830;
+	const double SLERP_U[8] = { 1.0 / (1.0 * 3.0), 1.0 / (2.0 * 5.0), 1.0 / (3.0 * 7.0), 1.0 / (4.0 * 9.0), 1.0 / (5.0 * 11.0), 1.0 / (6.0 * 13.0), 1.0 / (7.0 * 15.0), SLERP_MU / (8.0 * 17.0) };
+	const double SLERP_V[8] = { 1.0 / 3.0, 2.0 / 5.0, 3.0 / 7.0, 4.0 / 9.0, 5.0 / 11.0, 6.0 / 13.0, 7.0 / 15.0, SLERP_MU * 8.0 / 17.0 };
+	const double SLERP_TOLERANCE = 1e-3;
+
+	// Chebyshev fit of `theta / sin(theta)` in terms of `1 - cos(theta)`, see `MaxformCore::logMap` for details
+	//
+	const double LOG_COEFFICIENTS[8] = { 0.99999961171592688, 0.33338284748778402, 0.1323133706248939, 0.06500341893842343, -0.0036365426799420675, 0.067604498134748781, -0.050508776827001611, 0.026637151437057582 };
+
+	Vector3 add(const Vector3& vector, const Vector3& otherVector)
+	/**
+	Returns the sum of the two supplied vectors.
+
+	@param vector: The first vector.
+	@param otherVector: The second vector.
+	@return: The sum.
+	*/
+	{
+
+		return Vector3{ vector.x + otherVector.x, vector.y + otherVector.y, vector.z + otherVector.z };
+
+	};
+
+	Vector3 subtract(const Vector3& vector, const Vector3& otherVector)
+	/**
+	Returns the difference between the two supplied vectors.
+
+	@param vector: The first vector.
+	@param otherVector: The vector to subtract.
+	@return: The difference.
+	*/
+	{
+
+		return Vector3{ vector.x - otherVector.x, vector.y - otherVector.y, vector.z - otherVector.z };
+
+	};
+
+	Vector3 scale(const Vector3& vector, const double factor)
+	/**
+	Returns the supplied vector scaled by the specified factor.
+
+	@param vector: The vector to scale.
+	@param factor: The scale factor.
+	@return: The scaled vector.
+	*/
+	{
+
+		return Vector3{ vector.x * factor, vector.y * factor, vector.z * factor };
+
+	};
+
+	Vector3 negate(const Vector3& vector)
+	/**
+	Returns the supplied vector pointing in the opposite direction.
+
+	@param vector: The vector to negate.
+	@return: The negated vector.
+	*/
+	{
+
+		return Vector3{ -vector.x, -vector.y, -vector.z };
+
+	};
+
+	double dot(const Vector3& vector, const Vector3& otherVector)
+	/**
+	Returns the dot product of the two supplied vectors.
+
+	@param vector: The first vector.
+	@param otherVector: The second vector.
+	@return: The dot product.
+	*/
+	{
+
+		return (vector.x * otherVector.x) + (vector.y * otherVector.y) + (vector.z * otherVector.z);
+
+	};
+
+	Vector3 cross(const Vector3& vector, const Vector3& otherVector)
+	/**
+	Returns the cross product of the two supplied vectors.
+
+	@param vector: The first vector.
+	@param otherVector: The second vector.
+	@return: The cross product.
+	*/
+	{
+
+		return Vector3{
+			(vector.y * otherVector.z) - (vector.z * otherVector.y),
+			(vector.z * otherVector.x) - (vector.x * otherVector.z),
+			(vector.x * otherVector.y) - (vector.y * otherVector.x)
+		};
+
+	};
+
+	double length(const Vector3& vector)
+	/**
+	Returns the length of the supplied vector.
+
+	@param vector: The vector to measure.
+	@return: The length.
+	*/
+	{
+
+		return std::sqrt(MaxformCore::dot(vector, vector));
+
+	};
+
+	Vector3 normal(const Vector3& vector)
+	/**
+	Returns the normalized copy of the supplied vector.
+	Zero length vectors are returned as-is!
+
+	@param vector: The vector to normalize.
+	@return: The normalized vector.
+	*/
+	{
+
+		double vectorLength = MaxformCore::length(vector);
+
+		if (vectorLength == 0.0)
+		{
+
+			return vector;
+
+		}
+
+		return MaxformCore::scale(vector, 1.0 / vectorLength);
+
+	};
+
+	double distanceBetween(const Vector3& point, const Vector3& otherPoint)
+	/**
+	Returns the distance between the two supplied points.
+
+	@param point: The first point.
+	@param otherPoint: The second point.
+	@return: The distance.
+	*/
+	{
+
+		return MaxformCore::length(MaxformCore::subtract(otherPoint, point));
+
+	};
+
+	double angleBetween(const Vector3& vector, const Vector3& otherVector)
+	/**
+	Returns the unsigned angle between the two supplied vectors.
+
+	@param vector: The first vector.
+	@param otherVector: The second vector.
+	@return: The angle in radians.
+	*/
+	{
+
+		double lengthProduct = MaxformCore::length(vector) * MaxformCore::length(otherVector);
+
+		if (lengthProduct == 0.0)
+		{
+
+			return 0.0;
+
+		}
+
+		double cosine = MaxformCore::dot(vector, otherVector) / lengthProduct;
+		cosine = (cosine < -1.0) ? -1.0 : (cosine > 1.0) ? 1.0 : cosine;
+
+		return std::acos(cosine);
+
+	};
+
+	Vector3 rotate(const Vector3& vector, const Vector3& axis, const double angle)
+	/**
+	Rotates the supplied vector around the specified axis using Rodrigues' rotation formula.
+	The axis is expected to be normalized, zero length axes leave the vector untouched!
+
+	@param vector: The vector to rotate.
+	@param axis: The axis to rotate around.
+	@param angle: The angle in radians.
+	@return: The rotated vector.
+	*/
+	{
+
+		if (MaxformCore::dot(axis, axis) == 0.0)
+		{
+
+			return vector;
+
+		}
+
+		double cosine = std::cos(angle);
+		double sine = std::sin(angle);
+
+		Vector3 parallel = MaxformCore::scale(axis, MaxformCore::dot(axis, vector) * (1.0 - cosine));
+		Vector3 perpendicular = MaxformCore::scale(MaxformCore::cross(axis, vector), sine);
+
+		return MaxformCore::add(MaxformCore::add(MaxformCore::scale(vector, cosine), perpendicular), parallel);
+
+	};
+
+	Quaternion multiply(const Quaternion& quat, const Quaternion& otherQuat)
+	/**
+	Returns the product of the two supplied quaternions, matching the `MQuaternion` product order.
+	The resulting rotation applies the first quaternion followed by the second!
+
+	@param quat: The first rotation.
+	@param otherQuat: The second rotation.
+	@return: The product.
+	*/
+	{
+
+		const Quaternion& a = otherQuat;
+		const Quaternion& b = quat;
+
+		return Quaternion{
+			(a.w * b.x) + (a.x * b.w) + (a.y * b.z) - (a.z * b.y),
+			(a.w * b.y) - (a.x * b.z) + (a.y * b.w) + (a.z * b.x),
+			(a.w * b.z) + (a.x * b.y) - (a.y * b.x) + (a.z * b.w),
+			(a.w * b.w) - (a.x * b.x) - (a.y * b.y) - (a.z * b.z)
+		};
+
+	};
+
+	Quaternion conjugate(const Quaternion& quat)
+	/**
+	Returns the conjugate of the supplied quaternion.
+	For unit quaternions this is also the inverse rotation.
+
+	@param quat: The quaternion to conjugate.
+	@return: The conjugate.
+	*/
+	{
+
+		return Quaternion{ -quat.x, -quat.y, -quat.z, quat.w };
+
+	};
+
+	double dot(const Quaternion& quat, const Quaternion& otherQuat)
+	/**
+	Returns the 4D dot product of the two supplied quaternions.
+
+	@param quat: The first quaternion.
+	@param otherQuat: The second quaternion.
+	@return: The dot product.
+	*/
+	{
+
+		return (quat.x * otherQuat.x) + (quat.y * otherQuat.y) + (quat.z * otherQuat.z) + (quat.w * otherQuat.w);
+
+	};
+
+	Quaternion normal(const Quaternion& quat)
+	/**
+	Returns the normalized copy of the supplied quaternion.
+	Zero length quaternions are returned as the identity!
+
+	@param quat: The quaternion to normalize.
+	@return: The normalized quaternion.
+	*/
+	{
+
+		double quatLength = std::sqrt(MaxformCore::dot(quat, quat));
+
+		if (quatLength == 0.0)
+		{
+
+			return Quaternion{ 0.0, 0.0, 0.0, 1.0 };
+
+		}
+
+		double factor = 1.0 / quatLength;
+
+		return Quaternion{ quat.x * factor, quat.y * factor, quat.z * factor, quat.w * factor };
+
+	};
+
+	Quaternion axisAngle(const Vector3& axis, const double angle)
+	/**
+	Returns the quaternion that rotates around the supplied axis by the specified angle.
+	The axis is expected to be normalized!
+
+	@param axis: The axis to rotate around.
+	@param angle: The angle in radians.
+	@return: The rotation.
+	*/
+	{
+
+		double halfAngle = angle * 0.5;
+		double sine = std::sin(halfAngle);
+
+		return Quaternion{ axis.x * sine, axis.y * sine, axis.z * sine, std::cos(halfAngle) };
+
+	};
+
+	Vector3 rotate(const Vector3& vector, const Quaternion& quat)
+	/**
+	Rotates the supplied vector by the unit quaternion.
+
+	@param vector: The vector to rotate.
+	@param quat: The rotation.
+	@return: The rotated vector.
+	*/
+	{
+
+		Vector3 axis = Vector3{ quat.x, quat.y, quat.z };
+		Vector3 offset = MaxformCore::scale(MaxformCore::cross(axis, vector), 2.0);
+
+		return MaxformCore::add(MaxformCore::add(vector, MaxformCore::scale(offset, quat.w)), MaxformCore::cross(axis, offset));
+
+	};
+
+	void quaternionToMatrix(const Quaternion& quat, Matrix4& matrix)
+	/**
+	Converts the supplied unit quaternion into a row-major rotation matrix, matching `MQuaternion::asMatrix`.
+
+	@param quat: The rotation.
+	@param matrix: The passed matrix to populate.
+	@return: Void.
+	*/
+	{
+
+		double xx = quat.x * quat.x, yy = quat.y * quat.y, zz = quat.z * quat.z;
+		double xy = quat.x * quat.y, xz = quat.x * quat.z, yz = quat.y * quat.z;
+		double wx = quat.w * quat.x, wy = quat.w * quat.y, wz = quat.w * quat.z;
+
+		matrix = Matrix4{{
+			{ 1.0 - 2.0 * (yy + zz), 2.0 * (xy + wz), 2.0 * (xz - wy), 0.0 },
+			{ 2.0 * (xy - wz), 1.0 - 2.0 * (xx + zz), 2.0 * (yz + wx), 0.0 },
+			{ 2.0 * (xz + wy), 2.0 * (yz - wx), 1.0 - 2.0 * (xx + yy), 0.0 },
+			{ 0.0, 0.0, 0.0, 1.0 }
+		}};
+
+	};
+
+	Quaternion matrixToQuaternion(const Matrix4& matrix)
+	/**
+	Converts the upper 3x3 of the supplied row-major rotation matrix into a unit quaternion.
+	The largest diagonal term is used to pick the most stable branch.
+
+	@param matrix: The rotation matrix.
+	@return: The rotation.
+	*/
+	{
+
+		const double (&m)[4][4] = matrix.rows;
+		double trace = m[0][0] + m[1][1] + m[2][2];
+
+		Quaternion quat;
+
+		if (trace > 0.0)
+		{
+
+			double s = 0.5 / std::sqrt(trace + 1.0);
+			quat = Quaternion{ (m[1][2] - m[2][1]) * s, (m[2][0] - m[0][2]) * s, (m[0][1] - m[1][0]) * s, 0.25 / s };
+
+		}
+		else if (m[0][0] > m[1][1] && m[0][0] > m[2][2])
+		{
+
+			double s = 2.0 * std::sqrt(1.0 + m[0][0] - m[1][1] - m[2][2]);
+			quat = Quaternion{ 0.25 * s, (m[1][0] + m[0][1]) / s, (m[2][0] + m[0][2]) / s, (m[1][2] - m[2][1]) / s };
+
+		}
+		else if (m[1][1] > m[2][2])
+		{
+
+			double s = 2.0 * std::sqrt(1.0 + m[1][1] - m[0][0] - m[2][2]);
+			quat = Quaternion{ (m[1][0] + m[0][1]) / s, 0.25 * s, (m[2][1] + m[1][2]) / s, (m[2][0] - m[0][2]) / s };
+
+		}
+		else
+		{
+
+			double s = 2.0 * std::sqrt(1.0 + m[2][2] - m[0][0] - m[1][1]);
+			quat = Quaternion{ (m[2][0] + m[0][2]) / s, (m[2][1] + m[1][2]) / s, 0.25 * s, (m[0][1] - m[1][0]) / s };
+
+		}
+
+		return MaxformCore::normal(quat);
+
+	};
+
+	void slerpWeights(const double dot, const double weight, const SlerpPrecision precision, double& startWeight, double& endWeight)
+	/**
+	Evaluates the weights that blend two quaternions along the arc between them.
+	The supplied dot product is expected to be positive, the end quaternion should be negated beforehand otherwise!
+	Unlike the other precisions the nlerp weights still require the blended quaternion to be normalized.
+	Weights outside of [0, 1] always use the exact weights since the approximations are only fitted to that range!
+
+	@param dot: The dot product between the two quaternions.
+	@param weight: The amount to interpolate.
+	@param precision: The precision to interpolate with.
+	@param startWeight: The passed start weight to populate.
+	@param endWeight: The passed end weight to populate.
+	@return: Void.
+	*/
+	{
+
+		bool isExtrapolated = (weight < 0.0) || (weight > 1.0);
+
+		switch (isExtrapolated ? SlerpPrecision::Exact : precision)
+		{
+
+			case SlerpPrecision::Polynomial:
+			{
+
+				// Evaluate sine ratios using Eberly's polynomial approximation
+				// Both ratios only differ by their weight so they share a single register on x86-64!
+				//
+				double xm1 = dot - 1.0;
+				double d = 1.0 - weight;
+
+#if defined(MAXFORM_CORE_AVX) || defined(MAXFORM_CORE_SSE2)
+
+				alignas(16) double ratios[2];
+
+				__m128d one = _mm_set1_pd(1.0);
+				__m128d x = _mm_set1_pd(xm1);
+				__m128d sqr = _mm_set_pd(weight * weight, d * d);
+				__m128d ratio = one;
+
+				for (int i = 7; i >= 0; i--)
+				{
+
+					ratio = _mm_add_pd(one, _mm_mul_pd(_mm_mul_pd(_mm_sub_pd(_mm_mul_pd(_mm_set1_pd(SLERP_U[i]), sqr), _mm_set1_pd(SLERP_V[i])), x), ratio));
+
+				}
+
+				_mm_store_pd(ratios, _mm_mul_pd(ratio, _mm_set_pd(weight, d)));
+
+				startWeight = ratios[0];
+				endWeight = ratios[1];
+
+#else
+
+				double sqrT = weight * weight;
+				double sqrD = d * d;
+
+				startWeight = 1.0;
+				endWeight = 1.0;
+
+				for (int i = 7; i >= 0; i--)
+				{
+
+					startWeight = 1.0 + ((SLERP_U[i] * sqrD) - SLERP_V[i]) * xm1 * startWeight;
+					endWeight = 1.0 + ((SLERP_U[i] * sqrT) - SLERP_V[i]) * xm1 * endWeight;
+
+				}
+
+				startWeight *= d;
+				endWeight *= weight;
+
+#endif
+
+			}
+			break;
+
+			case SlerpPrecision::Nlerp:
+			{
+
+				// Correct weight to compensate for the nlerp's non-constant velocity
+				//
+				double a = 1.0904 + dot * (-3.2452 + dot * (3.55645 - dot * 1.43519));
+				double b = 0.848013 + dot * (-1.06021 + dot * 0.215638);
+				double k = a * (weight - 0.5) * (weight - 0.5) + b;
+				double t = weight + weight * (weight - 0.5) * (weight - 1.0) * k;
+
+				startWeight = 1.0 - t;
+				endWeight = t;
+
+			}
+			break;
+
+			default:
+			{
+
+				double theta = std::acos(std::min(dot, 1.0));
+				double sinTheta = std::sin(theta);
+
+				if (sinTheta > 1e-3)
+				{
+
+					startWeight = std::sin((1.0 - weight) * theta) / sinTheta;
+					endWeight = std::sin(weight * theta) / sinTheta;
+
+				}
+				else
+				{
+
+					startWeight = 1.0 - weight;
+					endWeight = weight;
+
+				}
+
+			}
+			break;
+
+		}
+
+	};
+
+	Quaternion slerp(const Quaternion& startQuat, const Quaternion& endQuat, const double weight, const SlerpPrecision precision)
+	/**
+	Spherical interpolates two quaternions along the shortest arc using the specified precision.
+	See the following for details: https://www.euclideanspace.com/maths/algebra/realNormedAlgebra/quaternions/slerp/index.htm
+
+	The approximate precisions avoid all trigonometry, the maximum angular errors for arcs up to 180 degrees are:
+	Polynomial: ~0.001 degrees, using Eberly's "A Fast and Accurate Algorithm for Computing SLERP".
+	Nlerp: ~0.045 degrees, using a nlerp with a cubic correction applied to the weight.
+	These bounds only hold for weights within [0, 1], extrapolated weights fall back onto the exact precision.
+
+	@param startQuat: Start Quaternion.
+	@param endQuat: End Quaternion.
+	@param weight: The amount to interpolate.
+	@param precision: The precision to interpolate with.
+	@return: The interpolated quaternion.
+	*/
+	{
+
+		// Check if quaternions require blending
+		//
+		if (std::fabs(weight) <= SLERP_TOLERANCE)
+		{
+
+			return startQuat;
+
+		}
+		else if (std::fabs(1.0 - weight) <= SLERP_TOLERANCE)
+		{
+
+			return endQuat;
+
+		}
+
+		// Blend along the shortest arc
+		//
+		double dot = MaxformCore::dot(startQuat, endQuat);
+		double sign = (dot < 0.0) ? -1.0 : 1.0;
+
+		double startWeight, endWeight;
+		MaxformCore::slerpWeights(dot * sign, weight, precision, startWeight, endWeight);
+
+		endWeight *= sign;
+
+		Quaternion quat = Quaternion{
+			(startQuat.x * startWeight) + (endQuat.x * endWeight),
+			(startQuat.y * startWeight) + (endQuat.y * endWeight),
+			(startQuat.z * startWeight) + (endQuat.z * endWeight),
+			(startQuat.w * startWeight) + (endQuat.w * endWeight)
+		};
+
+		return (precision == SlerpPrecision::Nlerp) ? MaxformCore::normal(quat) : quat;
+
+	};
+
+	Vector3 logMap(const Quaternion& quat)
+	/**
+	Returns the logarithm of the supplied unit quaternion along its shortest arc, as a rotation vector of half angles.
+	The ratio between the half angle and its sine is evaluated using a polynomial in `1 - |w|` rather than `acos`.
+	This is fitted for rotations up to 180 degrees and deviates from the exact logarithm by at most ~0.0001 degrees!
+
+	@param quat: The unit quaternion.
+	@return: The rotation vector.
+	*/
+	{
+
+		double sign = std::copysign(1.0, quat.w);
+		double x = 1.0 - (quat.w * sign);
+		double ratio = LOG_COEFFICIENTS[7];
+
+		for (int i = 6; i >= 0; i--)
+		{
+
+			ratio = (ratio * x) + LOG_COEFFICIENTS[i];
+
+		}
+
+		ratio *= sign;
+
+		return Vector3{ quat.x * ratio, quat.y * ratio, quat.z * ratio };
+
+	};
+
+	Quaternion expMap(const Vector3& vector)
+	/**
+	Returns the unit quaternion represented by the supplied rotation vector of half angles.
+	This is the inverse of `MaxformCore::logMap` and the only step that still requires trigonometry.
+
+	@param vector: The rotation vector.
+	@return: The unit quaternion.
+	*/
+	{
+
+		double halfAngle = MaxformCore::length(vector);
+
+		if (halfAngle < 1e-12)
+		{
+
+			return Quaternion{ vector.x, vector.y, vector.z, 1.0 };
+
+		}
+
+		double factor = std::sin(halfAngle) / halfAngle;
+
+		return Quaternion{ vector.x * factor, vector.y * factor, vector.z * factor, std::cos(halfAngle) };
+
+	};
+
+	bool blendDualQuaternions(const QuaternionBatch& rotations, const std::vector<Vector3>& positions, const std::vector<double>& weights, Quaternion& rotation, Vector3& position)
+	/**
+	Blends the supplied rigid transforms using dual quaternion linear blending.
+	Every transform is converted into a unit dual quaternion, summed by weight and normalized once at the end.
+	Rotations are kept in the same hemisphere as the first transform so the weights are expected to be normalized beforehand!
+
+	@param rotations: The rotation of each transform.
+	@param positions: The position of each transform.
+	@param weights: The weight of each transform.
+	@param rotation: The passed quaternion to populate.
+	@param position: The passed position to populate.
+	@return: Were the transforms blendable.
+	*/
+	{
+
+		size_t transformCount = std::min(std::min(rotations.size(), positions.size()), weights.size());
+
+		if (transformCount == 0)
+		{
+
+			return false;
+
+		}
+
+		// Accumulate weighted dual quaternions
+		// The real part is stored as (x, y, z, w) and the dual part as half the translation multiplied by the real part
+		//
+		Quaternion real = Quaternion{ 0.0, 0.0, 0.0, 0.0 };
+		Quaternion dual = Quaternion{ 0.0, 0.0, 0.0, 0.0 };
+
+		double weight;
+
+		for (size_t i = 0; i < transformCount; i++)
+		{
+
+			const Quaternion& quat = rotations[i];
+			const Vector3& point = positions[i];
+
+			weight = (MaxformCore::dot(rotations[0], quat) < 0.0) ? -weights[i] : weights[i];
+
+			real.x += weight * quat.x;
+			real.y += weight * quat.y;
+			real.z += weight * quat.z;
+			real.w += weight * quat.w;
+
+			dual.x += weight * 0.5 * ((point.x * quat.w) + (point.y * quat.z) - (point.z * quat.y));
+			dual.y += weight * 0.5 * ((point.y * quat.w) + (point.z * quat.x) - (point.x * quat.z));
+			dual.z += weight * 0.5 * ((point.z * quat.w) + (point.x * quat.y) - (point.y * quat.x));
+			dual.w += weight * 0.5 * -((point.x * quat.x) + (point.y * quat.y) + (point.z * quat.z));
+
+		}
+
+		// Normalize blended dual quaternion
+		//
+		double length = std::sqrt(MaxformCore::dot(real, real));
+
+		if (length == 0.0)
+		{
+
+			return false;
+
+		}
+
+		rotation = Quaternion{ real.x / length, real.y / length, real.z / length, real.w / length };
+		dual = Quaternion{ dual.x / length, dual.y / length, dual.z / length, dual.w / length };
+
+		// Recover translation from the dual part
+		//
+		position = Vector3{
+			2.0 * ((dual.x * rotation.w) - (dual.w * rotation.x) + (dual.z * rotation.y) - (dual.y * rotation.z)),
+			2.0 * ((dual.y * rotation.w) - (dual.w * rotation.y) + (dual.x * rotation.z) - (dual.z * rotation.x)),
+			2.0 * ((dual.z * rotation.w) - (dual.w * rotation.z) + (dual.y * rotation.x) - (dual.x * rotation.y))
+		};
+
+		return true;
+
+	};
+
+	void solveTriangle(const double startLength, const double endLength, const double distance, double& startRadian, double& endRadian)
+	/**
+	Solves the start and end angles of a 2-bone system using the law of cosines.
+	See the following for details: https://www.mathsisfun.com/algebra/trig-solving-sss-triangles.html
+
+	@param startLength: The length of the start bone.
+	@param endLength: The length of the end bone.
+	@param distance: The distance between the start joint and the goal.
+	@param startRadian: The passed start angle to populate.
+	@param endRadian: The passed end angle to populate.
+	@return: Void.
+	*/
+	{
+
+		// Calculate min/max limb length
+		//
+		double maxDistance = startLength + endLength;
+		double minDistance = std::fabs(endLength - startLength);
+
+		// Calculate angles using law of cosines
+		//
+		startRadian = 0.0;
+		endRadian = 0.0;
+
+		if (distance < (minDistance + 1e-3)) // Collapsed
+		{
+
+			endRadian = 0.0;
+
+		}
+		else if (distance > (maxDistance - 1e-3))  // Hyper-extended
+		{
+
+			endRadian = MaxformCore::PI;
+
+		}
+		else  // Default
+		{
+
+			startRadian = std::acos((std::pow(startLength, 2.0) + std::pow(distance, 2.0) - std::pow(endLength, 2.0)) / (2.0 * startLength * distance));
+			endRadian = std::acos((std::pow(endLength, 2.0) + std::pow(startLength, 2.0) - std::pow(distance, 2.0)) / (2.0 * endLength * startLength));
+
+		}
+
+	};
+
+	double lagrange2d(const double x, const double x1, const double y1, const double x2, const double y2, const double x3, const double y3)
+	/**
+	Returns the result of a lagrange2d polynomial that goes through the specified points.
+	See the following: https://www.desmos.com/calculator/vx6lr2w13j
+
+	@param x: The value to interpolate
+	@param x1: The first point's x value.
+	@param y1: The first point's y value.
+	@param x2: The second point's x value.
+	@param y2: The second point's y value.
+	@param x3: The third point's x value.
+	@param y3: The third point's y value.
+	@return: The interpolated value.
+	*/
+	{
+
+		double a = y3 / ((x3 - x1) * (x3 - x2));
+		double b = y2 / ((x2 - x1) * (x2 - x3));
+		double c = y1 / ((x1 - x2) * (x1 - x3));
+
+		return a * (x - x1) * (x - x2) + b * (x - x1) * (x - x3) + c * (x - x2) * (x - x3);
+
+	};
+
+	std::vector<Vector3> compressPoints(const std::vector<Vector3>& points, const Vector3& goal)
+	/**
+	Compresses the supplied points based on the distance change.
+
+	@param points: The points to compress.
+	@param goal: The current effector position.
+	@return: Compressed points.
+	*/
+	{
+
+		// Redundancy check
+		//
+		size_t pointCount = points.size();
+
+		if (!(pointCount >= 3))
+		{
+
+			return points;  // Minimum of 3 points required!
+
+		}
+
+		// Get bone specs from points
+		//
+		size_t boneCount = pointCount - 1;
+		size_t angleCount = pointCount - 2;
+
+		std::vector<double> lengths = std::vector<double>(boneCount);
+		std::vector<double> angles = std::vector<double>(angleCount);
+
+		Vector3 startVector, endVector, rightVector = Vector3{ 0.0, 0.0, 0.0 };
+		double startLength, endLength;
+		double angle = 0.0, angleSum = 0.0;
+		double minDistance = 0.0, maxDistance = 0.0;
+		bool flipped = false, alternates = false;
+
+		for (size_t i = 0, j = 1, k = 2; k < pointCount; i++, j++, k++)
+		{
+
+			startVector = MaxformCore::subtract(points[i], points[j]);
+			endVector = MaxformCore::subtract(points[k], points[j]);
+
+			startLength = MaxformCore::length(startVector);
+			endLength = MaxformCore::length(endVector);
+			lengths[i] = startLength, lengths[j] = endLength;
+			minDistance = (i > 0) ? std::fabs(endLength - minDistance) : std::fabs(startLength - endLength);
+			maxDistance += (i > 0) ? endLength : startLength + endLength;
+
+			angle = MaxformCore::angleBetween(startVector, endVector);
+			angles[i] = angle;
+			angleSum += angle;
+
+			rightVector = (i == 0) ? MaxformCore::normal(MaxformCore::cross(startVector, endVector)) : rightVector;
+			flipped = (i > 0) ? MaxformCore::dot(MaxformCore::normal(MaxformCore::cross(startVector, endVector)), rightVector) <= 0.0 : false;
+			alternates = (flipped) ? true : alternates;
+
+		}
+
+		double minAngleSum = alternates ? 0.0 : ((double)boneCount - 2.0) * MaxformCore::PI;
+		double maxAngleSum = MaxformCore::PI * (double)angleCount;
+
+		// Compute angle weights
+		//
+		std::vector<double> weights = std::vector<double>(angleCount);
+
+		for (size_t i = 0; i < angleCount; i++)
+		{
+
+			weights[i] = angles[i] / angleSum;
+
+		}
+
+		// Compute new weighted angle sum
+		//
+		size_t lastIndex = pointCount - 1;
+
+		double distance = MaxformCore::distanceBetween(points[0], points[lastIndex]);
+		double goalDistance = MaxformCore::distanceBetween(points[0], goal);
+
+		double weightedAngleSum = 0.0;
+
+		if (goalDistance <= minDistance)
+		{
+
+			weightedAngleSum = minAngleSum;
+
+		}
+		else if (goalDistance >= maxDistance)
+		{
+
+			weightedAngleSum = maxAngleSum;
+
+		}
+		else
+		{
+
+			weightedAngleSum = MaxformCore::lagrange2d(goalDistance, minDistance, minAngleSum, distance, angleSum, maxDistance, maxAngleSum);  // x = distance; y = angle sum
+
+		}
+
+		// Adjust points using weighted angles
+		//
+		std::vector<Vector3> weightedPoints = std::vector<Vector3>(points);
+		Vector3 restStartVector, restEndVector, axisVector, rotatedVector;
+		double weightedAngle;
+
+		for (size_t i = 0, j = 1, k = 2; k < pointCount; i++, j++, k++)
+		{
+
+			// Derive rotation axis from vector pairs
+			//
+			restStartVector = MaxformCore::normal(MaxformCore::subtract(points[i], points[j]));
+			restEndVector = MaxformCore::normal(MaxformCore::subtract(points[k], points[j]));
+
+			axisVector = MaxformCore::normal(MaxformCore::cross(restStartVector, restEndVector));
+
+			// Check if start vector requires counter rotating
+			//
+			weightedAngle = weightedAngleSum * weights[i];
+
+			if (i == 0)
+			{
+
+				startVector = MaxformCore::normal(MaxformCore::subtract(weightedPoints[j], weightedPoints[i]));
+				rotatedVector = MaxformCore::rotate(startVector, MaxformCore::negate(axisVector), (weightedAngle - angles[i]));
+
+				weightedPoints[j] = MaxformCore::add(weightedPoints[i], MaxformCore::scale(rotatedVector, lengths[i]));
+
+			}
+
+			// Apply weighted rotation to vector
+			//
+			startVector = MaxformCore::normal(MaxformCore::subtract(weightedPoints[i], weightedPoints[j]));
+			rotatedVector = MaxformCore::rotate(startVector, axisVector, weightedAngle);
+
+			weightedPoints[k] = MaxformCore::add(weightedPoints[j], MaxformCore::scale(rotatedVector, lengths[j]));
+
+		}
+
+		return weightedPoints;
+
+	};
+
+	void fabrik(std::vector<Vector3>& points, const Vector3& origin, const Vector3& goal, const unsigned int iterations)
+	/**
+	Applies the FABRIK solver to the supplied points in place.
+	Each iteration solves backwards from the goal followed by forwards from the origin.
+
+	@param points: The points to solve.
+	@param origin: The fixed start of the chain.
+	@param goal: The goal for the end of the chain.
+	@param iterations: The number of iterations to perform.
+	@return: Void.
+	*/
+	{
+
+		size_t pointCount = points.size();
+
+		if (pointCount < 2)
+		{
+
+			return;
+
+		}
+
+		size_t lastIndex = pointCount - 1;
+
+		std::vector<Vector3> previousPoints = std::vector<Vector3>(points);
+		std::vector<Vector3> nextPoints = std::vector<Vector3>(points);
+
+		size_t headIndex, tailIndex;
+		Vector3 headPoint, tailPoint, effectorPoint;
+		double boneLength;
+
+		for (unsigned int i = 0; i < iterations; i++)
+		{
+
+			// Backwards solve
+			//
+			for (size_t j = lastIndex; j > 0; j--)
+			{
+
+				headIndex = j;
+				tailIndex = j - 1;
+
+				headPoint = previousPoints[headIndex];
+				tailPoint = previousPoints[tailIndex];
+				effectorPoint = (headIndex == lastIndex) ? goal : nextPoints[headIndex];
+
+				boneLength = MaxformCore::length(MaxformCore::subtract(headPoint, tailPoint));
+				nextPoints[headIndex] = effectorPoint;
+				nextPoints[tailIndex] = MaxformCore::add(effectorPoint, MaxformCore::scale(MaxformCore::normal(MaxformCore::subtract(tailPoint, effectorPoint)), boneLength));
+
+			}
+
+			previousPoints = nextPoints;
+
+			// Forwards solve
+			//
+			for (size_t j = 0; j < lastIndex; j++)
+			{
+
+				headIndex = j;
+				tailIndex = j + 1;
+
+				headPoint = previousPoints[headIndex];
+				tailPoint = previousPoints[tailIndex];
+				effectorPoint = (headIndex == 0) ? origin : nextPoints[headIndex];
+
+				boneLength = MaxformCore::length(MaxformCore::subtract(headPoint, tailPoint));
+				nextPoints[headIndex] = effectorPoint;
+				nextPoints[tailIndex] = MaxformCore::add(effectorPoint, MaxformCore::scale(MaxformCore::normal(MaxformCore::subtract(tailPoint, effectorPoint)), boneLength));
+
+			}
+
+			previousPoints = nextPoints;
+
+		}
+
+		points = previousPoints;
+
+	};
+
+	unsigned int lineSphereIntersection(const Vector3& startPoint, const Vector3& endPoint, const Vector3& center, const double radius, Vector3(&hits)[2])
+	/**
+	Returns the collision points between the supplied line and sphere.
+	See the following for details: https://stackoverflow.com/questions/6533856/ray-sphere-intersection
+
+	@param startPoint: The start of the line.
+	@param endPoint: The end of the line.
+	@param center: The center of the sphere.
+	@param radius: The radius of the sphere.
+	@param hits: The passed array to populate.
+	@return: The number of collisions.
+	*/
+	{
+
+		// Calculate the discriminant
+		//
+		Vector3 direction = MaxformCore::subtract(endPoint, startPoint);
+		Vector3 offset = MaxformCore::subtract(startPoint, center);
+
+		double a = MaxformCore::dot(direction, direction);
+		double b = 2.0 * MaxformCore::dot(direction, offset);
+		double c = MaxformCore::dot(offset, offset) - (radius * radius);
+
+		double discriminant = (b * b) - (4.0 * a * c);
+
+		if (discriminant < 0.0)
+		{
+
+			return 0;
+
+		}
+
+		// Evaluate discriminant
+		// This determines how many points of contact there are
+		//
+		double root = std::sqrt(discriminant);
+		double t1 = (-b - root) / (2.0 * a);
+		double t2 = (-b + root) / (2.0 * a);
+
+		unsigned int hitCount = 0;
+
+		if (0.0 <= t1 && t1 <= 1.0)
+		{
+
+			hits[hitCount++] = MaxformCore::add(startPoint, MaxformCore::scale(direction, t1));
+
+		}
+
+		if (0.0 <= t2 && t2 <= 1.0)
+		{
+
+			hits[hitCount++] = MaxformCore::add(startPoint, MaxformCore::scale(direction, t2));
+
+		}
+
+		return hitCount;
+
+	};
+
+	std::vector<Vector3> fitChain(const std::vector<Vector3>& points, const std::vector<double>& lengths)
+	/**
+	Finds a solution that fits a chain with the supplied bone lengths to the sample points.
+	The first length is ignored since the first joint always sits on the first sample point!
+
+	@param points: The sample points to align the joints to.
+	@param lengths: The length of each bone leading up to its joint.
+	@return: The joint positions.
+	*/
+	{
+
+		size_t jointCount = lengths.size();
+		std::vector<Vector3> solutions = std::vector<Vector3>(jointCount, Vector3{ 0.0, 0.0, 0.0 });
+
+		if (jointCount == 0 || points.empty())
+		{
+
+			return solutions;
+
+		}
+
+		solutions[0] = points[0];
+
+		// Iterate through joints
+		//
+		size_t lastSegment = points.size() - 1;
+		size_t segment = 0;
+
+		Vector3 origin, startPoint, endPoint;
+		Vector3 hits[2];
+		double endDistance, boneLength;
+		unsigned int hitCount;
+
+		for (size_t i = 1; i < jointCount; i++)
+		{
+
+			// Iterate through point samples
+			//
+			boneLength = lengths[i];
+			origin = solutions[i - 1];
+
+			for (size_t j = segment; j < lastSegment; j++)
+			{
+
+				// Check if bone is in range
+				//
+				startPoint = points[j];
+				endPoint = points[j + 1];
+				endDistance = MaxformCore::distanceBetween(origin, endPoint);
+
+				if (!(boneLength <= endDistance))
+				{
+
+					continue;
+
+				}
+
+				// Calculate point in segment
+				//
+				hitCount = MaxformCore::lineSphereIntersection(startPoint, endPoint, origin, boneLength, hits);
+
+				if (hitCount > 0)
+				{
+
+					solutions[i] = hits[hitCount - 1];
+					segment = ((j + 1) < lastSegment) ? (j + 1) : segment;  // Move starting segment in point array
+
+					break;
+
+				}
+
+			}
+
+		}
+
+		return solutions;
+
+	};
+
+	void multiply(const Matrix4& matrix, const Matrix4& otherMatrix, Matrix4& product)
+	/**
+	Multiplies the two supplied row-major matrices, matching the `MMatrix` product order.
+	The product is accumulated in a temporary so it is safe for it to alias either operand!
+
+	@param matrix: The left-hand matrix.
+	@param otherMatrix: The right-hand matrix.
+	@param product: The passed matrix to populate.
+	@return: Void.
+	*/
+	{
+
+		Matrix4 result;
+
+#if defined(MAXFORM_CORE_AVX)
+
+		// Broadcast each left-hand element across the right-hand rows
+		//
+		__m256d row0 = _mm256_load_pd(otherMatrix.rows[0]);
+		__m256d row1 = _mm256_load_pd(otherMatrix.rows[1]);
+		__m256d row2 = _mm256_load_pd(otherMatrix.rows[2]);
+		__m256d row3 = _mm256_load_pd(otherMatrix.rows[3]);
+
+		__m256d sum;
+
+		for (unsigned int i = 0; i < 4; i++)
+		{
+
+			sum = _mm256_mul_pd(_mm256_broadcast_sd(&matrix.rows[i][0]), row0);
+			sum = _mm256_add_pd(sum, _mm256_mul_pd(_mm256_broadcast_sd(&matrix.rows[i][1]), row1));
+			sum = _mm256_add_pd(sum, _mm256_mul_pd(_mm256_broadcast_sd(&matrix.rows[i][2]), row2));
+			sum = _mm256_add_pd(sum, _mm256_mul_pd(_mm256_broadcast_sd(&matrix.rows[i][3]), row3));
+
+			_mm256_store_pd(result.rows[i], sum);
+
+		}
+
+#elif defined(MAXFORM_CORE_SSE2)
+
+		// Split each right-hand row into low and high pairs
+		//
+		__m128d lows[4], highs[4];
+
+		for (unsigned int k = 0; k < 4; k++)
+		{
+
+			lows[k] = _mm_load_pd(&otherMatrix.rows[k][0]);
+			highs[k] = _mm_load_pd(&otherMatrix.rows[k][2]);
+
+		}
+
+		__m128d scalar, low, high;
+
+		for (unsigned int i = 0; i < 4; i++)
+		{
+
+			low = _mm_setzero_pd();
+			high = _mm_setzero_pd();
+
+			for (unsigned int k = 0; k < 4; k++)
+			{
+
+				scalar = _mm_set1_pd(matrix.rows[i][k]);
+				low = _mm_add_pd(low, _mm_mul_pd(scalar, lows[k]));
+				high = _mm_add_pd(high, _mm_mul_pd(scalar, highs[k]));
+
+			}
+
+			_mm_store_pd(&result.rows[i][0], low);
+			_mm_store_pd(&result.rows[i][2], high);
+
+		}
+
+#else
+
+		for (unsigned int i = 0; i < 4; i++)
+		{
+
+			for (unsigned int j = 0; j < 4; j++)
+			{
+
+				result.rows[i][j] = (matrix.rows[i][0] * otherMatrix.rows[0][j]) + (matrix.rows[i][1] * otherMatrix.rows[1][j]) + (matrix.rows[i][2] * otherMatrix.rows[2][j]) + (matrix.rows[i][3] * otherMatrix.rows[3][j]);
+
+			}
+
+		}
+
+#endif
+
+		product = result;
+
+	};
+
+	bool affineInverse(const Matrix4& matrix, Matrix4& inverse)
+	/**
+	Inverts the supplied affine matrix by cofactors of its upper 3x3.
+	Each inverse row is built from the rotated columns of the 3x3, that way the cofactors are calculated a row at a time.
+	Projective or singular matrices are rejected so the caller can fall back onto a general inverse!
+
+	@param matrix: The matrix to invert.
+	@param inverse: The passed matrix to populate.
+	@return: Was inverted.
+	*/
+	{
+
+		// Check if matrix is affine
+		//
+		const double (&m)[4][4] = matrix.rows;
+		bool isAffine = m[0][3] == 0.0 && m[1][3] == 0.0 && m[2][3] == 0.0 && m[3][3] == 1.0;
+
+		if (!isAffine)
+		{
+
+			return false;
+
+		}
+
+		Matrix4 result;
+
+#if defined(MAXFORM_CORE_AVX)
+
+		// Rotate each column of the upper 3x3 forwards and backwards
+		//
+		__m256d x1 = _mm256_set_pd(0.0, m[0][0], m[2][0], m[1][0]);
+		__m256d x2 = _mm256_set_pd(0.0, m[1][0], m[0][0], m[2][0]);
+		__m256d y1 = _mm256_set_pd(0.0, m[0][1], m[2][1], m[1][1]);
+		__m256d y2 = _mm256_set_pd(0.0, m[1][1], m[0][1], m[2][1]);
+		__m256d z1 = _mm256_set_pd(0.0, m[0][2], m[2][2], m[1][2]);
+		__m256d z2 = _mm256_set_pd(0.0, m[1][2], m[0][2], m[2][2]);
+
+		// Calculate cofactor rows
+		//
+		__m256d row0 = _mm256_sub_pd(_mm256_mul_pd(y1, z2), _mm256_mul_pd(z1, y2));
+		__m256d row1 = _mm256_sub_pd(_mm256_mul_pd(z1, x2), _mm256_mul_pd(x1, z2));
+		__m256d row2 = _mm256_sub_pd(_mm256_mul_pd(x1, y2), _mm256_mul_pd(y1, x2));
+
+		_mm256_store_pd(result.rows[0], row0);
+		_mm256_store_pd(result.rows[1], row1);
+		_mm256_store_pd(result.rows[2], row2);
+
+		double determinant = (m[0][0] * result.rows[0][0]) + (m[0][1] * result.rows[1][0]) + (m[0][2] * result.rows[2][0]);
+
+		if (determinant == 0.0)
+		{
+
+			return false;
+
+		}
+
+		// Scale cofactors and solve translation against inverted 3x3
+		//
+		__m256d factor = _mm256_set1_pd(1.0 / determinant);
+
+		row0 = _mm256_mul_pd(row0, factor);
+		row1 = _mm256_mul_pd(row1, factor);
+		row2 = _mm256_mul_pd(row2, factor);
+
+		__m256d row3 = _mm256_mul_pd(_mm256_broadcast_sd(&m[3][0]), row0);
+		row3 = _mm256_add_pd(row3, _mm256_mul_pd(_mm256_broadcast_sd(&m[3][1]), row1));
+		row3 = _mm256_add_pd(row3, _mm256_mul_pd(_mm256_broadcast_sd(&m[3][2]), row2));
+		row3 = _mm256_sub_pd(_mm256_setzero_pd(), row3);
+
+		_mm256_store_pd(result.rows[0], row0);
+		_mm256_store_pd(result.rows[1], row1);
+		_mm256_store_pd(result.rows[2], row2);
+		_mm256_store_pd(result.rows[3], row3);
+
+		result.rows[3][3] = 1.0;
+
+#elif defined(MAXFORM_CORE_SSE2)
+
+		// Rotate each column of the upper 3x3 forwards and backwards, split into low and high pairs
+		//
+		__m128d x1[2] = { _mm_set_pd(m[2][0], m[1][0]), _mm_set_pd(0.0, m[0][0]) };
+		__m128d x2[2] = { _mm_set_pd(m[0][0], m[2][0]), _mm_set_pd(0.0, m[1][0]) };
+		__m128d y1[2] = { _mm_set_pd(m[2][1], m[1][1]), _mm_set_pd(0.0, m[0][1]) };
+		__m128d y2[2] = { _mm_set_pd(m[0][1], m[2][1]), _mm_set_pd(0.0, m[1][1]) };
+		__m128d z1[2] = { _mm_set_pd(m[2][2], m[1][2]), _mm_set_pd(0.0, m[0][2]) };
+		__m128d z2[2] = { _mm_set_pd(m[0][2], m[2][2]), _mm_set_pd(0.0, m[1][2]) };
+
+		// Calculate cofactor rows
+		//
+		__m128d rows[3][2];
+
+		for (unsigned int k = 0; k < 2; k++)
+		{
+
+			rows[0][k] = _mm_sub_pd(_mm_mul_pd(y1[k], z2[k]), _mm_mul_pd(z1[k], y2[k]));
+			rows[1][k] = _mm_sub_pd(_mm_mul_pd(z1[k], x2[k]), _mm_mul_pd(x1[k], z2[k]));
+			rows[2][k] = _mm_sub_pd(_mm_mul_pd(x1[k], y2[k]), _mm_mul_pd(y1[k], x2[k]));
+
+			_mm_store_pd(&result.rows[0][k * 2], rows[0][k]);
+			_mm_store_pd(&result.rows[1][k * 2], rows[1][k]);
+			_mm_store_pd(&result.rows[2][k * 2], rows[2][k]);
+
+		}
+
+		double determinant = (m[0][0] * result.rows[0][0]) + (m[0][1] * result.rows[1][0]) + (m[0][2] * result.rows[2][0]);
+
+		if (determinant == 0.0)
+		{
+
+			return false;
+
+		}
+
+		// Scale cofactors and solve translation against inverted 3x3
+		//
+		__m128d factor = _mm_set1_pd(1.0 / determinant);
+		__m128d tx = _mm_set1_pd(m[3][0]);
+		__m128d ty = _mm_set1_pd(m[3][1]);
+		__m128d tz = _mm_set1_pd(m[3][2]);
+		__m128d translation;
+
+		for (unsigned int k = 0; k < 2; k++)
+		{
+
+			rows[0][k] = _mm_mul_pd(rows[0][k], factor);
+			rows[1][k] = _mm_mul_pd(rows[1][k], factor);
+			rows[2][k] = _mm_mul_pd(rows[2][k], factor);
+
+			translation = _mm_add_pd(_mm_add_pd(_mm_mul_pd(tx, rows[0][k]), _mm_mul_pd(ty, rows[1][k])), _mm_mul_pd(tz, rows[2][k]));
+
+			_mm_store_pd(&result.rows[0][k * 2], rows[0][k]);
+			_mm_store_pd(&result.rows[1][k * 2], rows[1][k]);
+			_mm_store_pd(&result.rows[2][k * 2], rows[2][k]);
+			_mm_store_pd(&result.rows[3][k * 2], _mm_sub_pd(_mm_setzero_pd(), translation));
+
+		}
+
+		result.rows[3][3] = 1.0;
+
+#else
+
+		// Calculate cofactors of upper 3x3
+		//
+		double c00 = (m[1][1] * m[2][2]) - (m[1][2] * m[2][1]);
+		double c01 = (m[1][2] * m[2][0]) - (m[1][0] * m[2][2]);
+		double c02 = (m[1][0] * m[2][1]) - (m[1][1] * m[2][0]);
+
+		double determinant = (m[0][0] * c00) + (m[0][1] * c01) + (m[0][2] * c02);
+
+		if (determinant == 0.0)
+		{
+
+			return false;
+
+		}
+
+		double factor = 1.0 / determinant;
+
+		result = {{
+			{ c00 * factor, ((m[0][2] * m[2][1]) - (m[0][1] * m[2][2])) * factor, ((m[0][1] * m[1][2]) - (m[0][2] * m[1][1])) * factor, 0.0 },
+			{ c01 * factor, ((m[0][0] * m[2][2]) - (m[0][2] * m[2][0])) * factor, ((m[0][2] * m[1][0]) - (m[0][0] * m[1][2])) * factor, 0.0 },
+			{ c02 * factor, ((m[0][1] * m[2][0]) - (m[0][0] * m[2][1])) * factor, ((m[0][0] * m[1][1]) - (m[0][1] * m[1][0])) * factor, 0.0 },
+			{ 0.0, 0.0, 0.0, 1.0 }
+		}};
+
+		// Solve translation against inverted 3x3
+		//
+		for (unsigned int i = 0; i < 3; i++)
+		{
+
+			result.rows[3][i] = -((m[3][0] * result.rows[0][i]) + (m[3][1] * result.rows[1][i]) + (m[3][2] * result.rows[2][i]));
+
+		}
+
+#endif
+
+		inverse = result;
+
+		return true;
+
+	};
+
+	Vector3 transformPoint(const Vector3& point, const Matrix4& matrix)
+	/**
+	Returns the supplied point transformed by the affine matrix.
+	The homogeneous divide is skipped since affine matrices always preserve w!
+
+	@param point: The point to transform.
+	@param matrix: The affine matrix.
+	@return: The transformed point.
+	*/
+	{
+
+#if defined(MAXFORM_CORE_AVX)
+
+		alignas(32) double result[4];
+
+		__m256d sum = _mm256_load_pd(matrix.rows[3]);
+		sum = _mm256_add_pd(sum, _mm256_mul_pd(_mm256_broadcast_sd(&point.x), _mm256_load_pd(matrix.rows[0])));
+		sum = _mm256_add_pd(sum, _mm256_mul_pd(_mm256_broadcast_sd(&point.y), _mm256_load_pd(matrix.rows[1])));
+		sum = _mm256_add_pd(sum, _mm256_mul_pd(_mm256_broadcast_sd(&point.z), _mm256_load_pd(matrix.rows[2])));
+
+		_mm256_store_pd(result, sum);
+
+		return Vector3{ result[0], result[1], result[2] };
+
+#elif defined(MAXFORM_CORE_SSE2)
+
+		alignas(16) double result[4];
+
+		__m128d x = _mm_set1_pd(point.x);
+		__m128d y = _mm_set1_pd(point.y);
+		__m128d z = _mm_set1_pd(point.z);
+
+		for (unsigned int k = 0; k < 4; k += 2)
+		{
+
+			__m128d sum = _mm_load_pd(&matrix.rows[3][k]);
+			sum = _mm_add_pd(sum, _mm_mul_pd(x, _mm_load_pd(&matrix.rows[0][k])));
+			sum = _mm_add_pd(sum, _mm_mul_pd(y, _mm_load_pd(&matrix.rows[1][k])));
+			sum = _mm_add_pd(sum, _mm_mul_pd(z, _mm_load_pd(&matrix.rows[2][k])));
+
+			_mm_store_pd(&result[k], sum);
+
+		}
+
+		return Vector3{ result[0], result[1], result[2] };
+
+#else
+
+		const double (&m)[4][4] = matrix.rows;
+
+		return Vector3{
+			(point.x * m[0][0]) + (point.y * m[1][0]) + (point.z * m[2][0]) + m[3][0],
+			(point.x * m[0][1]) + (point.y * m[1][1]) + (point.z * m[2][1]) + m[3][1],
+			(point.x * m[0][2]) + (point.y * m[1][2]) + (point.z * m[2][2]) + m[3][2]
+		};
+
+#endif
+
+	};
+
+	void multiplyBatch(const Matrix4& preMatrix, MatrixBatch& matrices)
+	/**
+	Pre-multiplies every matrix in the supplied batch, in place.
+
+	@param preMatrix: The left-hand matrix.
+	@param matrices: The matrices to update.
+	@return: Void.
+	*/
+	{
+
+		size_t matrixCount = matrices.size();
+
+		for (size_t i = 0; i < matrixCount; i++)
+		{
+
+			MaxformCore::multiply(preMatrix, matrices[i], matrices[i]);
+
+		}
+
+	};
+
+	bool staggerBatch(const MatrixBatch& matrices, MatrixBatch& localMatrices)
+	/**
+	Converts each matrix into the space of its preceding matrix.
+	The supplied output batch is resized, so its capacity can be reused between calls!
+
+	@param matrices: The world matrices.
+	@param localMatrices: The passed batch to populate.
+	@return: Were all parents affine and invertible.
+	*/
+	{
+
+		size_t matrixCount = matrices.size();
+		localMatrices.resize(matrixCount);
+
+		if (matrixCount == 0)
+		{
+
+			return true;
+
+		}
+
+		localMatrices[0] = matrices[0];
+
+		Matrix4 parentInverse;
+		bool isInverted;
+
+		for (size_t i = 1; i < matrixCount; i++)  // Skip the first item!
+		{
+
+			isInverted = MaxformCore::affineInverse(matrices[i - 1], parentInverse);
+
+			if (!isInverted)
+			{
+
+				return false;
+
+			}
+
+			MaxformCore::multiply(matrices[i], parentInverse, localMatrices[i]);
+
+		}
+
+		return true;
+
+	};
+
+	void expandBatch(MatrixBatch& matrices)
+	/**
+	Converts each matrix into world space using the preceding matrix as its parent, in place.
+
+	@param matrices: The local matrices to update.
+	@return: Void.
+	*/
+	{
+
+		size_t matrixCount = matrices.size();
+
+		for (size_t i = 1; i < matrixCount; i++)  // Skip the first item!
+		{
+
+			MaxformCore::multiply(matrices[i], matrices[i - 1], matrices[i]);
+
+		}
+
+	};
+
+	void transformPoints(std::vector<Vector3>& points, const Matrix4& matrix)
+	/**
+	Transforms every point by the supplied affine matrix, in place.
+	The matrix rows are only loaded once for the entire batch!
+
+	@param points: The points to update.
+	@param matrix: The affine matrix.
+	@return: Void.
+	*/
+	{
+
+		size_t pointCount = points.size();
+
+#if defined(MAXFORM_CORE_AVX)
+
+		__m256d row0 = _mm256_load_pd(matrix.rows[0]);
+		__m256d row1 = _mm256_load_pd(matrix.rows[1]);
+		__m256d row2 = _mm256_load_pd(matrix.rows[2]);
+		__m256d row3 = _mm256_load_pd(matrix.rows[3]);
+
+		alignas(32) double result[4];
+		__m256d sum;
+
+		for (size_t i = 0; i < pointCount; i++)
+		{
+
+			Vector3& point = points[i];
+
+			sum = _mm256_add_pd(row3, _mm256_mul_pd(_mm256_broadcast_sd(&point.x), row0));
+			sum = _mm256_add_pd(sum, _mm256_mul_pd(_mm256_broadcast_sd(&point.y), row1));
+			sum = _mm256_add_pd(sum, _mm256_mul_pd(_mm256_broadcast_sd(&point.z), row2));
+
+			_mm256_store_pd(result, sum);
+			point = Vector3{ result[0], result[1], result[2] };
+
+		}
+
+#elif defined(MAXFORM_CORE_SSE2)
+
+		__m128d lows[4], highs[4];
+
+		for (unsigned int k = 0; k < 4; k++)
+		{
+
+			lows[k] = _mm_load_pd(&matrix.rows[k][0]);
+			highs[k] = _mm_load_pd(&matrix.rows[k][2]);
+
+		}
+
+		alignas(16) double result[4];
+		__m128d x, y, z;
+
+		for (size_t i = 0; i < pointCount; i++)
+		{
+
+			Vector3& point = points[i];
+
+			x = _mm_set1_pd(point.x);
+			y = _mm_set1_pd(point.y);
+			z = _mm_set1_pd(point.z);
+
+			_mm_store_pd(&result[0], _mm_add_pd(_mm_add_pd(lows[3], _mm_mul_pd(x, lows[0])), _mm_add_pd(_mm_mul_pd(y, lows[1]), _mm_mul_pd(z, lows[2]))));
+			_mm_store_pd(&result[2], _mm_add_pd(_mm_add_pd(highs[3], _mm_mul_pd(x, highs[0])), _mm_add_pd(_mm_mul_pd(y, highs[1]), _mm_mul_pd(z, highs[2]))));
+
+			point = Vector3{ result[0], result[1], result[2] };
+
+		}
+
+#else
+
+		for (size_t i = 0; i < pointCount; i++)
+		{
+
+			points[i] = MaxformCore::transformPoint(points[i], matrix);
+
+		}
+
+#endif
+
+	};
+
+	void transformPoints(const MatrixBatch& matrices, const Vector3& point, std::vector<Vector3>& points)
+	/**
+	Transforms the supplied point by every matrix in the batch.
+	Transforming the origin extracts the position of each matrix, see `Maxformations::matrixToPosition` for details.
+	The supplied output vector is resized, so its capacity can be reused between calls!
+
+	@param matrices: The affine matrices.
+	@param point: The point to transform.
+	@param points: The passed vector to populate.
+	@return: Void.
+	*/
+	{
+
+		size_t matrixCount = matrices.size();
+		points.resize(matrixCount);
+
+		for (size_t i = 0; i < matrixCount; i++)
+		{
+
+			points[i] = MaxformCore::transformPoint(point, matrices[i]);
+
+		}
+
+	};
+
+	void slerpBatch(const QuaternionBatch& startQuats, const QuaternionBatch& endQuats, const std::vector<double>& weights, const SlerpPrecision precision, QuaternionBatch& quats)
+	/**
+	Spherical interpolates every pair of quaternions along their shortest arc using the respective weight.
+	See `MaxformCore::slerp` for the maximum angular error of each precision.
+	The polynomial precision evaluates two pairs per register with AVX while every pair is blended in vector registers.
+	The supplied output batch is resized, so its capacity can be reused between calls!
+
+	@param startQuats: The start quaternions.
+	@param endQuats: The end quaternions.
+	@param weights: The amount to interpolate each pair.
+	@param precision: The precision to interpolate with.
+	@param quats: The passed batch to populate.
+	@return: Void.
+	*/
+	{
+
+		size_t quatCount = std::min(std::min(startQuats.size(), endQuats.size()), weights.size());
+		quats.resize(quatCount);
+
+		bool isNormalized = (precision == SlerpPrecision::Nlerp);
+
+		// Define blend step
+		// The end weight is expected to be flipped onto the shortest arc beforehand!
+		//
+		auto blend = [&](const size_t index, const double startWeight, const double endWeight)
+		{
+
+			const Quaternion& startQuat = startQuats[index];
+			const Quaternion& endQuat = endQuats[index];
+
+			// Check if quaternions require blending
+			//
+			double weight = weights[index];
+
+			if (std::fabs(weight) <= SLERP_TOLERANCE)
+			{
+
+				quats[index] = startQuat;
+				return;
+
+			}
+			else if (std::fabs(1.0 - weight) <= SLERP_TOLERANCE)
+			{
+
+				quats[index] = endQuat;
+				return;
+
+			}
+
+#if defined(MAXFORM_CORE_AVX)
+
+			alignas(32) double result[4];
+
+			__m256d quat = _mm256_add_pd(
+				_mm256_mul_pd(_mm256_set1_pd(startWeight), _mm256_set_pd(startQuat.w, startQuat.z, startQuat.y, startQuat.x)),
+				_mm256_mul_pd(_mm256_set1_pd(endWeight), _mm256_set_pd(endQuat.w, endQuat.z, endQuat.y, endQuat.x))
+			);
+
+			if (isNormalized)
+			{
+
+				__m256d sqr = _mm256_mul_pd(quat, quat);
+				__m128d sum = _mm_add_pd(_mm256_castpd256_pd128(sqr), _mm256_extractf128_pd(sqr, 1));
+				double quatLength = std::sqrt(_mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum))));
+
+				quat = (quatLength > 0.0) ? _mm256_mul_pd(quat, _mm256_set1_pd(1.0 / quatLength)) : _mm256_set_pd(1.0, 0.0, 0.0, 0.0);
+
+			}
+
+			_mm256_store_pd(result, quat);
+			quats[index] = Quaternion{ result[0], result[1], result[2], result[3] };
+
+#elif defined(MAXFORM_CORE_SSE2)
+
+			alignas(16) double result[4];
+
+			__m128d start = _mm_set1_pd(startWeight);
+			__m128d end = _mm_set1_pd(endWeight);
+			__m128d low = _mm_add_pd(_mm_mul_pd(start, _mm_set_pd(startQuat.y, startQuat.x)), _mm_mul_pd(end, _mm_set_pd(endQuat.y, endQuat.x)));
+			__m128d high = _mm_add_pd(_mm_mul_pd(start, _mm_set_pd(startQuat.w, startQuat.z)), _mm_mul_pd(end, _mm_set_pd(endQuat.w, endQuat.z)));
+
+			if (isNormalized)
+			{
+
+				__m128d sum = _mm_add_pd(_mm_mul_pd(low, low), _mm_mul_pd(high, high));
+				double quatLength = std::sqrt(_mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum))));
+
+				if (quatLength > 0.0)
+				{
+
+					__m128d factor = _mm_set1_pd(1.0 / quatLength);
+
+					low = _mm_mul_pd(low, factor);
+					high = _mm_mul_pd(high, factor);
+
+				}
+				else
+				{
+
+					low = _mm_setzero_pd();
+					high = _mm_set_pd(1.0, 0.0);
+
+				}
+
+			}
+
+			_mm_store_pd(&result[0], low);
+			_mm_store_pd(&result[2], high);
+
+			quats[index] = Quaternion{ result[0], result[1], result[2], result[3] };
+
+#else
+
+			Quaternion quat = Quaternion{
+				(startQuat.x * startWeight) + (endQuat.x * endWeight),
+				(startQuat.y * startWeight) + (endQuat.y * endWeight),
+				(startQuat.z * startWeight) + (endQuat.z * endWeight),
+				(startQuat.w * startWeight) + (endQuat.w * endWeight)
+			};
+
+			quats[index] = isNormalized ? MaxformCore::normal(quat) : quat;
+
+#endif
+
+		};
+
+		// Blend each pair
+		//
+		size_t i = 0;
+		double dot, sign, startWeight, endWeight;
+
+#if defined(MAXFORM_CORE_AVX)
+
+		if (precision == SlerpPrecision::Polynomial)
+		{
+
+			// Evaluate the sine ratios of two pairs per register, see `MaxformCore::slerpWeights` for details
+			// The lanes are ordered as: (startWeight0, endWeight0, startWeight1, endWeight1)
+			//
+			alignas(32) double ratios[4];
+
+			__m256d one = _mm256_set1_pd(1.0);
+			__m256d x, sqr, ratio;
+
+			double dot0, dot1, t0, t1, d0, d1;
+
+			for (; (i + 1) < quatCount; i += 2)
+			{
+
+				t0 = weights[i];
+				t1 = weights[i + 1];
+
+				// Extrapolated pairs are left to the exact weights, see `MaxformCore::slerpWeights` for details
+				//
+				bool isExtrapolated = (t0 < 0.0) || (t0 > 1.0) || (t1 < 0.0) || (t1 > 1.0);
+
+				if (isExtrapolated)
+				{
+
+					for (size_t j = i; j < (i + 2); j++)
+					{
+
+						dot = MaxformCore::dot(startQuats[j], endQuats[j]);
+						sign = (dot < 0.0) ? -1.0 : 1.0;
+
+						MaxformCore::slerpWeights(dot * sign, weights[j], precision, startWeight, endWeight);
+						blend(j, startWeight, endWeight * sign);
+
+					}
+
+					continue;
+
+				}
+
+				dot0 = MaxformCore::dot(startQuats[i], endQuats[i]);
+				dot1 = MaxformCore::dot(startQuats[i + 1], endQuats[i + 1]);
+
+				d0 = 1.0 - t0;
+				d1 = 1.0 - t1;
+
+				x = _mm256_set_pd(std::fabs(dot1) - 1.0, std::fabs(dot1) - 1.0, std::fabs(dot0) - 1.0, std::fabs(dot0) - 1.0);
+				sqr = _mm256_set_pd(t1 * t1, d1 * d1, t0 * t0, d0 * d0);
+				ratio = one;
+
+				for (int k = 7; k >= 0; k--)
+				{
+
+					ratio = _mm256_add_pd(one, _mm256_mul_pd(_mm256_mul_pd(_mm256_sub_pd(_mm256_mul_pd(_mm256_set1_pd(SLERP_U[k]), sqr), _mm256_set1_pd(SLERP_V[k])), x), ratio));
+
+				}
+
+				_mm256_store_pd(ratios, _mm256_mul_pd(ratio, _mm256_set_pd(t1, d1, t0, d0)));
+
+				blend(i, ratios[0], (dot0 < 0.0) ? -ratios[1] : ratios[1]);
+				blend(i + 1, ratios[2], (dot1 < 0.0) ? -ratios[3] : ratios[3]);
+
+			}
+
+		}
+
+#endif
+
+		for (; i < quatCount; i++)
+		{
+
+			dot = MaxformCore::dot(startQuats[i], endQuats[i]);
+			sign = (dot < 0.0) ? -1.0 : 1.0;
+
+			MaxformCore::slerpWeights(dot * sign, weights[i], precision, startWeight, endWeight);
+			blend(i, startWeight, endWeight * sign);
+
+		}
+
+	};
+
+	Vector3 sumLogMaps(const QuaternionBatch& quats, const std::vector<double>& weights)
+	/**
+	Returns the weighted sum of the logarithms of the supplied unit quaternions, see `MaxformCore::logMap` for the error bounds.
+	Each lane evaluates the polynomial for a separate quaternion, four per register with AVX or two with SSE2.
+	The sum can be converted back into a rotation using `MaxformCore::expMap`!
+
+	@param quats: The unit quaternions.
+	@param weights: The weight of each quaternion.
+	@return: The weighted rotation vector.
+	*/
+	{
+
+		size_t quatCount = std::min(quats.size(), weights.size());
+		size_t i = 0;
+
+		Vector3 sum = Vector3{ 0.0, 0.0, 0.0 };
+
+#if defined(MAXFORM_CORE_AVX)
+
+		alignas(32) double sums[3][4];
+
+		__m256d signMask = _mm256_set1_pd(-0.0);
+		__m256d one = _mm256_set1_pd(1.0);
+		__m256d sumX = _mm256_setzero_pd();
+		__m256d sumY = _mm256_setzero_pd();
+		__m256d sumZ = _mm256_setzero_pd();
+		__m256d w, sign, x, ratio;
+
+		for (; (i + 3) < quatCount; i += 4)
+		{
+
+			const Quaternion& a = quats[i];
+			const Quaternion& b = quats[i + 1];
+			const Quaternion& c = quats[i + 2];
+			const Quaternion& d = quats[i + 3];
+
+			// Flip each quaternion onto the shortest arc by transferring the sign of w onto its weight
+			//
+			w = _mm256_set_pd(d.w, c.w, b.w, a.w);
+			sign = _mm256_and_pd(w, signMask);
+			x = _mm256_sub_pd(one, _mm256_andnot_pd(signMask, w));
+
+			ratio = _mm256_set1_pd(LOG_COEFFICIENTS[7]);
+
+			for (int k = 6; k >= 0; k--)
+			{
+
+				ratio = _mm256_add_pd(_mm256_mul_pd(ratio, x), _mm256_set1_pd(LOG_COEFFICIENTS[k]));
+
+			}
+
+			ratio = _mm256_mul_pd(ratio, _mm256_xor_pd(_mm256_set_pd(weights[i + 3], weights[i + 2], weights[i + 1], weights[i]), sign));
+
+			sumX = _mm256_add_pd(sumX, _mm256_mul_pd(ratio, _mm256_set_pd(d.x, c.x, b.x, a.x)));
+			sumY = _mm256_add_pd(sumY, _mm256_mul_pd(ratio, _mm256_set_pd(d.y, c.y, b.y, a.y)));
+			sumZ = _mm256_add_pd(sumZ, _mm256_mul_pd(ratio, _mm256_set_pd(d.z, c.z, b.z, a.z)));
+
+		}
+
+		_mm256_store_pd(sums[0], sumX);
+		_mm256_store_pd(sums[1], sumY);
+		_mm256_store_pd(sums[2], sumZ);
+
+		sum = Vector3{ (sums[0][0] + sums[0][1]) + (sums[0][2] + sums[0][3]), (sums[1][0] + sums[1][1]) + (sums[1][2] + sums[1][3]), (sums[2][0] + sums[2][1]) + (sums[2][2] + sums[2][3]) };
+
+#elif defined(MAXFORM_CORE_SSE2)
+
+		alignas(16) double sums[3][2];
+
+		__m128d signMask = _mm_set1_pd(-0.0);
+		__m128d one = _mm_set1_pd(1.0);
+		__m128d sumX = _mm_setzero_pd();
+		__m128d sumY = _mm_setzero_pd();
+		__m128d sumZ = _mm_setzero_pd();
+		__m128d w, sign, x, ratio;
+
+		for (; (i + 1) < quatCount; i += 2)
+		{
+
+			const Quaternion& a = quats[i];
+			const Quaternion& b = quats[i + 1];
+
+			// Flip each quaternion onto the shortest arc by transferring the sign of w onto its weight
+			//
+			w = _mm_set_pd(b.w, a.w);
+			sign = _mm_and_pd(w, signMask);
+			x = _mm_sub_pd(one, _mm_andnot_pd(signMask, w));
+
+			ratio = _mm_set1_pd(LOG_COEFFICIENTS[7]);
+
+			for (int k = 6; k >= 0; k--)
+			{
+
+				ratio = _mm_add_pd(_mm_mul_pd(ratio, x), _mm_set1_pd(LOG_COEFFICIENTS[k]));
+
+			}
+
+			ratio = _mm_mul_pd(ratio, _mm_xor_pd(_mm_set_pd(weights[i + 1], weights[i]), sign));
+
+			sumX = _mm_add_pd(sumX, _mm_mul_pd(ratio, _mm_set_pd(b.x, a.x)));
+			sumY = _mm_add_pd(sumY, _mm_mul_pd(ratio, _mm_set_pd(b.y, a.y)));
+			sumZ = _mm_add_pd(sumZ, _mm_mul_pd(ratio, _mm_set_pd(b.z, a.z)));
+
+		}
+
+		_mm_store_pd(sums[0], sumX);
+		_mm_store_pd(sums[1], sumY);
+		_mm_store_pd(sums[2], sumZ);
+
+		sum = Vector3{ sums[0][0] + sums[0][1], sums[1][0] + sums[1][1], sums[2][0] + sums[2][1] };
+
+#endif
+
+		for (; i < quatCount; i++)
+		{
+
+			sum = MaxformCore::add(sum, MaxformCore::scale(MaxformCore::logMap(quats[i]), weights[i]));
+
+		}
+
+		return sum;
+
+	};
+
+	Quaternion averageQuaternions(const QuaternionBatch& quats, const std::vector<double>& weights)
+	/**
+	Returns the weighted average of the supplied unit quaternions using Markley's eigenvector method.
+	The quaternions are accumulated into a symmetric 4x4 matrix whose dominant eigenvector, found through power iteration, is the average.
+	Each outer product is accumulated a row per register with AVX, or half a row with SSE2, and non-positive weights are skipped!
+
+	@param quats: The unit quaternions to average.
+	@param weights: The weight of each quaternion.
+	@return: The average rotation.
+	*/
+	{
+
+		size_t quatCount = std::min(quats.size(), weights.size());
+
+		Quaternion estimate = Quaternion{ 0.0, 0.0, 0.0, 1.0 };
+		double maxWeight = 0.0;
+
+		alignas(32) double product[4];
+
+#if !defined(MAXFORM_CORE_AVX)
+
+		alignas(16) double accumulator[4][4];
+
+#endif
+
+#if defined(MAXFORM_CORE_AVX)
+
+		__m256d rows[4] = { _mm256_setzero_pd(), _mm256_setzero_pd(), _mm256_setzero_pd(), _mm256_setzero_pd() };
+		__m256d packed, weighted;
+
+#elif defined(MAXFORM_CORE_SSE2)
+
+		__m128d lows[4] = { _mm_setzero_pd(), _mm_setzero_pd(), _mm_setzero_pd(), _mm_setzero_pd() };
+		__m128d highs[4] = { _mm_setzero_pd(), _mm_setzero_pd(), _mm_setzero_pd(), _mm_setzero_pd() };
+		__m128d low, high, weighted;
+
+#else
+
+		for (unsigned int row = 0; row < 4; row++)
+		{
+
+			for (unsigned int column = 0; column < 4; column++)
+			{
+
+				accumulator[row][column] = 0.0;
+
+			}
+
+		}
+
+#endif
+
+		// Accumulate weighted outer products
+		//
+		double weight;
+
+		for (size_t i = 0; i < quatCount; i++)
+		{
+
+			weight = weights[i];
+
+			if (weight <= 0.0)
+			{
+
+				continue;
+
+			}
+
+			const Quaternion& quat = quats[i];
+			const double components[4] = { quat.x, quat.y, quat.z, quat.w };
+
+#if defined(MAXFORM_CORE_AVX)
+
+			packed = _mm256_set_pd(quat.w, quat.z, quat.y, quat.x);
+
+			for (unsigned int row = 0; row < 4; row++)
+			{
+
+				weighted = _mm256_set1_pd(weight * components[row]);
+				rows[row] = _mm256_add_pd(rows[row], _mm256_mul_pd(weighted, packed));
+
+			}
+
+#elif defined(MAXFORM_CORE_SSE2)
+
+			low = _mm_set_pd(quat.y, quat.x);
+			high = _mm_set_pd(quat.w, quat.z);
+
+			for (unsigned int row = 0; row < 4; row++)
+			{
+
+				weighted = _mm_set1_pd(weight * components[row]);
+
+				lows[row] = _mm_add_pd(lows[row], _mm_mul_pd(weighted, low));
+				highs[row] = _mm_add_pd(highs[row], _mm_mul_pd(weighted, high));
+
+			}
+
+#else
+
+			for (unsigned int row = 0; row < 4; row++)
+			{
+
+				for (unsigned int column = 0; column < 4; column++)
+				{
+
+					accumulator[row][column] += weight * components[row] * components[column];
+
+				}
+
+			}
+
+#endif
+
+			// Start from the heaviest rotation since it is usually closest to the average
+			//
+			if (weight > maxWeight)
+			{
+
+				estimate = quat;
+				maxWeight = weight;
+
+			}
+
+		}
+
+		if (maxWeight == 0.0)
+		{
+
+			return Quaternion{ 0.0, 0.0, 0.0, 1.0 };
+
+		}
+
+#if defined(MAXFORM_CORE_SSE2) && !defined(MAXFORM_CORE_AVX)
+
+		for (unsigned int row = 0; row < 4; row++)
+		{
+
+			_mm_store_pd(&accumulator[row][0], lows[row]);
+			_mm_store_pd(&accumulator[row][2], highs[row]);
+
+		}
+
+#endif
+
+		// Find dominant eigenvector through power iteration
+		// The accumulator is symmetric so each product is a sum of its rows scaled by the estimate!
+		//
+		double length, alignment;
+
+		for (unsigned int iteration = 0; iteration < 32; iteration++)
+		{
+
+#if defined(MAXFORM_CORE_AVX)
+
+			__m256d sum = _mm256_mul_pd(rows[0], _mm256_set1_pd(estimate.x));
+			sum = _mm256_add_pd(sum, _mm256_mul_pd(rows[1], _mm256_set1_pd(estimate.y)));
+			sum = _mm256_add_pd(sum, _mm256_mul_pd(rows[2], _mm256_set1_pd(estimate.z)));
+			sum = _mm256_add_pd(sum, _mm256_mul_pd(rows[3], _mm256_set1_pd(estimate.w)));
+
+			_mm256_store_pd(product, sum);
+
+#else
+
+			for (unsigned int row = 0; row < 4; row++)
+			{
+
+				product[row] = (accumulator[row][0] * estimate.x) + (accumulator[row][1] * estimate.y) + (accumulator[row][2] * estimate.z) + (accumulator[row][3] * estimate.w);
+
+			}
+
+#endif
+
+			length = std::sqrt((product[0] * product[0]) + (product[1] * product[1]) + (product[2] * product[2]) + (product[3] * product[3]));
+
+			if (length == 0.0)
+			{
+
+				break;
+
+			}
+
+			Quaternion next = Quaternion{ product[0] / length, product[1] / length, product[2] / length, product[3] / length };
+			alignment = MaxformCore::dot(next, estimate);
+
+			estimate = next;
+
+			if (alignment > (1.0 - 1e-12))
+			{
+
+				break;
+
+			}
+
+		}
+
+		return estimate;
+
+	};
+
+};
@@ -0,0 +1,119 @@
+#ifndef _MAXFORM_CORE
+#define _MAXFORM_CORE
+//
+// File: MaxformCore.h
+//
+// Author: Benjamin H. Singleton
+//
+// The solver kernels in this namespace only depend on the standard library.
+// Maya nodes convert their inputs through the adapters in Maxformations, see `Maxformations::toCoreVector` for details.
+//
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+// The matrix kernels use AVX when the plug-in is built with `MAXFORM_ENABLE_AVX2`, otherwise SSE2 on x86-64.
+// Any other architecture falls back onto scalar loops!
+//
+#if defined(__AVX__)
+#define MAXFORM_CORE_AVX
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MAXFORM_CORE_SSE2
+#include <emmintrin.h>
+#endif
+
+
+namespace MaxformCore
+{
+
+	const double PI = 3.14159265358979323846;
+
+	struct Vector3
+	{
+
+		double x;
+		double y;
+		double z;
+
+	};
+
+	struct Quaternion
+	{
+
+		double x;
+		double y;
+		double z;
+		double w;
+
+	};
+
+	struct alignas(32) Matrix4
+	{
+
+		double rows[4][4];
+
+	};
+
+	enum class SlerpPrecision
+	{
+
+		Exact = 0,
+		Polynomial = 1,
+		Nlerp = 2
+
+	};
+
+	typedef std::vector<Quaternion> QuaternionBatch;
+	typedef std::vector<Matrix4> MatrixBatch;
+
+	Vector3					add(const Vector3& vector, const Vector3& otherVector);
+	Vector3					subtract(const Vector3& vector, const Vector3& otherVector);
+	Vector3					scale(const Vector3& vector, const double factor);
+	Vector3					negate(const Vector3& vector);
+	double					dot(const Vector3& vector, const Vector3& otherVector);
+	Vector3					cross(const Vector3& vector, const Vector3& otherVector);
+	double					length(const Vector3& vector);
+	Vector3					normal(const Vector3& vector);
+	double					distanceBetween(const Vector3& point, const Vector3& otherPoint);
+	double					angleBetween(const Vector3& vector, const Vector3& otherVector);
+	Vector3					rotate(const Vector3& vector, const Vector3& axis, const double angle);
+
+	Quaternion				multiply(const Quaternion& quat, const Quaternion& otherQuat);
+	Quaternion				conjugate(const Quaternion& quat);
+	double					dot(const Quaternion& quat, const Quaternion& otherQuat);
+	Quaternion				normal(const Quaternion& quat);
+	Quaternion				axisAngle(const Vector3& axis, const double angle);
+	Vector3					rotate(const Vector3& vector, const Quaternion& quat);
+	void					quaternionToMatrix(const Quaternion& quat, Matrix4& matrix);
+	Quaternion				matrixToQuaternion(const Matrix4& matrix);
+	void					slerpWeights(const double dot, const double weight, const SlerpPrecision precision, double& startWeight, double& endWeight);
+	Quaternion				slerp(const Quaternion& startQuat, const Quaternion& endQuat, const double weight, const SlerpPrecision precision);
+	Vector3					logMap(const Quaternion& quat);
+	Quaternion				expMap(const Vector3& vector);
+	bool					blendDualQuaternions(const QuaternionBatch& rotations, const std::vector<Vector3>& positions, const std::vector<double>& weights, Quaternion& rotation, Vector3& position);
+
+	void					solveTriangle(const double startLength, const double endLength, const double distance, double& startRadian, double& endRadian);
+	double					lagrange2d(const double x, const double x1, const double y1, const double x2, const double y2, const double x3, const double y3);
+	std::vector<Vector3>	compressPoints(const std::vector<Vector3>& points, const Vector3& goal);
+	void					fabrik(std::vector<Vector3>& points, const Vector3& origin, const Vector3& goal, const unsigned int iterations);
+
+	unsigned int			lineSphereIntersection(const Vector3& startPoint, const Vector3& endPoint, const Vector3& center, const double radius, Vector3(&hits)[2]);
+	std::vector<Vector3>	fitChain(const std::vector<Vector3>& points, const std::vector<double>& lengths);
+
+	void					multiply(const Matrix4& matrix, const Matrix4& otherMatrix, Matrix4& product);
+	bool					affineInverse(const Matrix4& matrix, Matrix4& inverse);
+	Vector3					transformPoint(const Vector3& point, const Matrix4& matrix);
+
+	void					multiplyBatch(const Matrix4& preMatrix, MatrixBatch& matrices);
+	bool					staggerBatch(const MatrixBatch& matrices, MatrixBatch& localMatrices);
+	void					expandBatch(MatrixBatch& matrices);
+	void					transformPoints(std::vector<Vector3>& points, const Matrix4& matrix);
+	void					transformPoints(const MatrixBatch& matrices, const Vector3& point, std::vector<Vector3>& points);
+	void					slerpBatch(const QuaternionBatch& startQuats, const QuaternionBatch& endQuats, const std::vector<double>& weights, const SlerpPrecision precision, QuaternionBatch& quats);
+	Vector3					sumLogMaps(const QuaternionBatch& quats, const std::vector<double>& weights);
+	Quaternion				averageQuaternions(const QuaternionBatch& quats, const std::vector<double>& weights);
+
+};
+#endif
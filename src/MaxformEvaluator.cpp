@@ -0,0 +1,742 @@
+//
+// File: MaxformEvaluator.cpp
+//
+// Custom Evaluator: maxformEvaluator
+//
+// Author: Benjamin H. Singleton
+//
+
+#include "MaxformEvaluator.h"
+
+MString			MaxformEvaluator::evaluatorName("maxformEvaluator");
+unsigned int	MaxformEvaluator::priority = 250;
+
+// The nodes computed by the cluster currently being discovered on this thread, see `MaxformEvaluator::clusterEvaluate` for details.
+//
+thread_local std::vector<MObjectHandle>* recordedNodes = nullptr;
+
+
+MaxformEvaluator::MaxformEvaluator() : MPxCustomEvaluator()
+{
+
+	this->setConsolidation(MPxCustomEvaluator::kConsolidateR2L);
+
+};
+
+
+MaxformEvaluator::~MaxformEvaluator() {};
+
+
+bool MaxformEvaluator::markIfSupported(const MEvaluationNode* node)
+/**
+Determines if the evaluator can take over the supplied evaluation node.
+Only the PRS and list controllers are claimed so connected controller stacks are consolidated into a single cluster!
+
+@param node: The evaluation node to test.
+@return: Is supported.
+*/
+{
+
+	MStatus status;
+
+	MObject dependencyNode = node->dependencyNode(&status);
+	CHECK_MSTATUS_AND_RETURN(status, false);
+
+	MFnDependencyNode fnDependNode(dependencyNode, &status);
+	CHECK_MSTATUS_AND_RETURN(status, false);
+
+	return MaxformEvaluator::isSupported(fnDependNode.typeId());
+
+};
+
+
+MCustomEvaluatorClusterNode::SchedulingType MaxformEvaluator::schedulingType(const MCustomEvaluatorClusterNode* cluster)
+/**
+Returns the degree of parallelism supported by the supplied cluster.
+Each cluster only writes to the data blocks of its own controllers so clusters are safe to evaluate in parallel!
+
+@param cluster: The cluster to schedule.
+@return: The scheduling type.
+*/
+{
+
+	return MCustomEvaluatorClusterNode::kParallel;
+
+};
+
+
+bool MaxformEvaluator::clusterInitialize(const MCustomEvaluatorClusterNode* cluster)
+/**
+Prepares an empty plan for the supplied cluster.
+The plan is populated on the cluster's first evaluation since that is when its controllers are known to have been computed.
+
+@param cluster: The cluster to initialize.
+@return: Is initialized.
+*/
+{
+
+	this->plans[cluster] = ClusterPlan();
+
+	return true;
+
+};
+
+
+void MaxformEvaluator::clusterTerminate(const MCustomEvaluatorClusterNode* cluster)
+/**
+Releases the plan for the supplied cluster.
+Maya terminates every cluster whenever the evaluation graph is invalidated so plans never outlive a topology change!
+
+@param cluster: The cluster to terminate.
+@return: Void.
+*/
+{
+
+	this->plans.erase(cluster);
+
+};
+
+
+void MaxformEvaluator::clusterEvaluate(const MCustomEvaluatorClusterNode* cluster)
+/**
+Evaluates the supplied cluster.
+The first evaluation runs the cluster normally while recording which controllers compute, these are then grouped into fused PRS stacks.
+Any cluster that cannot be fused, or any evaluation outside of the normal context, falls back onto normal evaluation!
+
+@param cluster: The cluster to evaluate.
+@return: Void.
+*/
+{
+
+	std::unordered_map<const MCustomEvaluatorClusterNode*, ClusterPlan>::iterator iter = this->plans.find(cluster);
+
+	if (iter == this->plans.end())
+	{
+
+		cluster->evaluate();
+		return;
+
+	}
+
+	// Check if plan requires discovering
+	//
+	ClusterPlan& plan = iter->second;
+
+	if (!plan.isInitialized)
+	{
+
+		recordedNodes = &plan.nodes;
+		cluster->evaluate();
+		recordedNodes = nullptr;
+
+		MaxformEvaluator::createPlan(plan);
+		plan.isInitialized = true;
+
+		return;
+
+	}
+
+	// Evaluate fused stacks
+	//
+	bool isNormal = MDGContext::current().isNormal();
+
+	if (!plan.isFusable || !isNormal)
+	{
+
+		cluster->evaluate();
+		return;
+
+	}
+
+	MStatus status = MaxformEvaluator::evaluatePlan(plan);
+
+	if (!status)
+	{
+
+		plan.isFusable = false;
+		cluster->evaluate();
+
+	}
+
+};
+
+
+void* MaxformEvaluator::creator()
+/**
+This function is called by Maya when a new instance is requested.
+See pluginMain.cpp for details.
+
+@return: MaxformEvaluator
+*/
+{
+
+	return new MaxformEvaluator();
+
+};
+
+
+void MaxformEvaluator::recordCompute(const MObject& node)
+/**
+Records the supplied controller if its cluster is being discovered on the calling thread.
+Outside of discovery this is a single thread-local check!
+
+@param node: The computing controller.
+@return: Void.
+*/
+{
+
+	if (recordedNodes == nullptr)
+	{
+
+		return;
+
+	}
+
+	MObjectHandle handle = MObjectHandle(node);
+
+	for (const MObjectHandle& recordedNode : *recordedNodes)
+	{
+
+		if (recordedNode == handle)
+		{
+
+			return;
+
+		}
+
+	}
+
+	recordedNodes->push_back(handle);
+
+};
+
+
+bool MaxformEvaluator::isSupported(const MTypeId& typeId)
+/**
+Evaluates if the supplied node type can be claimed by this evaluator.
+
+@param typeId: The node type to test.
+@return: Is supported.
+*/
+{
+
+	return typeId == PRS::id || typeId == PositionList::id || typeId == RotationList::id || typeId == ScaleList::id;
+
+};
+
+
+MStatus MaxformEvaluator::createPlan(ClusterPlan& plan)
+/**
+Groups the recorded controllers into PRS stacks.
+The plan is only fusable if every recorded list exclusively drives all three components of a PRS in the same cluster!
+
+@param plan: The passed plan to populate.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	plan.isFusable = false;
+	plan.stacks.clear();
+
+	// Collect PRS controllers
+	//
+	std::unordered_map<unsigned int, size_t> stackIndices;
+
+	for (const MObjectHandle& handle : plan.nodes)
+	{
+
+		MFnDependencyNode fnDependNode(handle.object(), &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		if (fnDependNode.typeId() == PRS::id)
+		{
+
+			stackIndices[handle.hashCode()] = plan.stacks.size();
+
+			ControllerStack stack;
+			stack.prs = handle;
+
+			plan.stacks.push_back(stack);
+
+		}
+
+	}
+
+	// Attach list controllers
+	//
+	for (const MObjectHandle& handle : plan.nodes)
+	{
+
+		MFnDependencyNode fnDependNode(handle.object(), &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		MTypeId typeId = fnDependNode.typeId();
+
+		if (typeId == PRS::id)
+		{
+
+			continue;
+
+		}
+
+		bool isAttached = MaxformEvaluator::attachList(handle.object(), typeId, plan.stacks, stackIndices);
+
+		if (!isAttached)
+		{
+
+			plan.stacks.clear();
+			return MS::kSuccess;
+
+		}
+
+	}
+
+	if (plan.stacks.empty())
+	{
+
+		return MS::kSuccess;
+
+	}
+
+	// Resolve data blocks
+	// Any stack that cannot be resolved leaves the whole cluster to normal evaluation!
+	//
+	status = MaxformEvaluator::resolvePlan(plan);
+	plan.isFusable = static_cast<bool>(status);
+
+	return MS::kSuccess;
+
+};
+
+
+bool MaxformEvaluator::attachList(const MObject& list, const MTypeId& typeId, std::vector<ControllerStack>& stacks, const std::unordered_map<unsigned int, size_t>& stackIndices)
+/**
+Attaches the supplied list to the PRS stack it drives.
+Lists whose outputs are observed by anything other than their PRS are rejected since their outputs are never written while fused!
+
+@param list: The list controller.
+@param typeId: The list controller type.
+@param stacks: The passed stacks to update.
+@param stackIndices: The stack indices keyed by PRS hash code.
+@return: Is attached.
+*/
+{
+
+	MStatus status;
+
+	// Get the list outputs and the PRS inputs they should drive
+	//
+	MObject sourceAttributes[4], destinationAttributes[4];
+	const unsigned int componentMasks[4] = { 7, 1, 2, 4 };
+
+	if (typeId == PositionList::id)
+	{
+
+		MObject sources[4] = { PositionController::value, PositionController::valueX, PositionController::valueY, PositionController::valueZ };
+		MObject destinations[4] = { PRS::position, PRS::x_position, PRS::y_position, PRS::z_position };
+
+		std::copy(sources, sources + 4, sourceAttributes);
+		std::copy(destinations, destinations + 4, destinationAttributes);
+
+	}
+	else if (typeId == RotationList::id)
+	{
+
+		MObject sources[4] = { RotationController::value, RotationController::valueX, RotationController::valueY, RotationController::valueZ };
+		MObject destinations[4] = { PRS::rotation, PRS::x_rotation, PRS::y_rotation, PRS::z_rotation };
+
+		std::copy(sources, sources + 4, sourceAttributes);
+		std::copy(destinations, destinations + 4, destinationAttributes);
+
+	}
+	else if (typeId == ScaleList::id)
+	{
+
+		MObject sources[4] = { ScaleController::value, ScaleController::valueX, ScaleController::valueY, ScaleController::valueZ };
+		MObject destinations[4] = { PRS::scale, PRS::x_scale, PRS::y_scale, PRS::z_scale };
+
+		std::copy(sources, sources + 4, sourceAttributes);
+		std::copy(destinations, destinations + 4, destinationAttributes);
+
+	}
+	else
+	{
+
+		return false;
+
+	}
+
+	// Inspect outgoing connections
+	//
+	MFnDependencyNode fnDependNode(list, &status);
+	CHECK_MSTATUS_AND_RETURN(status, false);
+
+	MPlugArray plugs;
+
+	status = fnDependNode.getConnections(plugs);
+	CHECK_MSTATUS_AND_RETURN(status, false);
+
+	unsigned int componentMask = 0;
+	long stackIndex = -1;
+
+	for (unsigned int i = 0; i < plugs.length(); i++)
+	{
+
+		MPlugArray otherPlugs;
+		plugs[i].destinations(otherPlugs, &status);
+
+		if (otherPlugs.length() == 0)
+		{
+
+			continue;  // Inputs are evaluated upstream of the cluster!
+
+		}
+
+		MObject attribute = plugs[i].attribute();
+		int component = -1;
+
+		for (int j = 0; j < 4; j++)
+		{
+
+			if (attribute == sourceAttributes[j])
+			{
+
+				component = j;
+				break;
+
+			}
+
+		}
+
+		if (component == -1)
+		{
+
+			return false;  // Secondary outputs, such as matrices or pre-values, are observed externally!
+
+		}
+
+		for (unsigned int j = 0; j < otherPlugs.length(); j++)
+		{
+
+			MObjectHandle otherHandle = MObjectHandle(otherPlugs[j].node());
+			std::unordered_map<unsigned int, size_t>::const_iterator iter = stackIndices.find(otherHandle.hashCode());
+
+			bool isPRS = iter != stackIndices.end() && stacks[iter->second].prs == otherHandle;
+
+			if (!isPRS)
+			{
+
+				return false;
+
+			}
+
+			bool isComponent = otherPlugs[j].attribute() == destinationAttributes[component];
+			bool isSameStack = stackIndex == -1 || stackIndex == static_cast<long>(iter->second);
+
+			if (!(isComponent && isSameStack))
+			{
+
+				return false;
+
+			}
+
+			stackIndex = static_cast<long>(iter->second);
+			componentMask |= componentMasks[component];
+
+		}
+
+	}
+
+	if (componentMask != 7)
+	{
+
+		return false;  // Partially connected lists are left to normal evaluation!
+
+	}
+
+	// Attach list to stack
+	//
+	ControllerStack& stack = stacks[stackIndex];
+	MObjectHandle& slot = (typeId == PositionList::id) ? stack.positionList : (typeId == RotationList::id) ? stack.rotationList : stack.scaleList;
+
+	if (slot.isValid())
+	{
+
+		return false;
+
+	}
+
+	slot = MObjectHandle(list);
+
+	return true;
+
+};
+
+
+MStatus MaxformEvaluator::resolvePlan(ClusterPlan& plan)
+/**
+Resolves the data block of every controller in the supplied plan.
+This is done once per plan so fused evaluations never construct function sets or force caches per frame!
+The normal context data blocks live as long as their nodes and plans are terminated along with the graph whenever a node is removed.
+
+@param plan: The passed plan to resolve.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	plan.dataBlocks.clear();
+	plan.dataBlocks.reserve(plan.stacks.size() * 4);
+
+	for (ControllerStack& stack : plan.stacks)
+	{
+
+		stack.prsBlock = MaxformEvaluator::resolveBlock(stack.prs, plan, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		stack.positionBlock = MaxformEvaluator::resolveBlock(stack.positionList, plan, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		stack.rotationBlock = MaxformEvaluator::resolveBlock(stack.rotationList, plan, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		stack.scaleBlock = MaxformEvaluator::resolveBlock(stack.scaleList, plan, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	return MS::kSuccess;
+
+};
+
+
+int MaxformEvaluator::resolveBlock(const MObjectHandle& handle, ClusterPlan& plan, MStatus* status)
+/**
+Appends the normal context data block for the supplied controller to the plan.
+Unassigned controllers, such as a PRS component without a list, are skipped!
+
+@param handle: The controller handle.
+@param plan: The passed plan to append to.
+@param status: Return status.
+@return: The data block index or -1 if the controller is unassigned.
+*/
+{
+
+	*status = MS::kSuccess;
+
+	if (!handle.isValid())
+	{
+
+		return -1;
+
+	}
+
+	MPxNode* userNode = MaxformEvaluator::getUserNode(handle.object(), status);
+	CHECK_MSTATUS_AND_RETURN(*status, -1);
+
+	plan.dataBlocks.push_back(userNode->forceCache());
+
+	return static_cast<int>(plan.dataBlocks.size() - 1);
+
+};
+
+
+MStatus MaxformEvaluator::evaluatePlan(ClusterPlan& plan)
+/**
+Evaluates every PRS stack in the supplied plan as a single batch.
+Each controller type is gathered across every control before any PRS is composed, so the same kernel runs back to back!
+List values are passed straight into the PRS composition so only the PRS value is written back to a data block.
+The list outputs are left dirty and will be computed normally if anything ever pulls on them.
+
+@param plan: The plan to evaluate.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Check stacks are still alive
+	//
+	for (const ControllerStack& stack : plan.stacks)
+	{
+
+		bool isAlive = stack.prs.isAlive() && (stack.positionBlock == -1 || stack.positionList.isAlive()) && (stack.rotationBlock == -1 || stack.rotationList.isAlive()) && (stack.scaleBlock == -1 || stack.scaleList.isAlive());
+
+		if (!isAlive)
+		{
+
+			return MS::kFailure;
+
+		}
+
+	}
+
+	size_t stackCount = plan.stacks.size();
+
+	thread_local std::vector<MVector> positions, rotations, scales;
+
+	positions.resize(stackCount);
+	rotations.resize(stackCount);
+	scales.resize(stackCount);
+
+	// Gather position values
+	//
+	for (size_t i = 0; i < stackCount; i++)
+	{
+
+		const ControllerStack& stack = plan.stacks[i];
+
+		if (stack.positionBlock != -1)
+		{
+
+			positions[i] = PositionList::getValue(plan.dataBlocks[stack.positionBlock], &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		}
+		else
+		{
+
+			MDataHandle positionHandle = plan.dataBlocks[stack.prsBlock].inputValue(PRS::position, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			positions[i] = MVector(
+				positionHandle.child(PRS::x_position).asDistance().asCentimeters(),
+				positionHandle.child(PRS::y_position).asDistance().asCentimeters(),
+				positionHandle.child(PRS::z_position).asDistance().asCentimeters()
+			);
+
+		}
+
+	}
+
+	// Gather rotation values
+	//
+	for (size_t i = 0; i < stackCount; i++)
+	{
+
+		const ControllerStack& stack = plan.stacks[i];
+
+		if (stack.rotationBlock != -1)
+		{
+
+			MQuaternion quat = RotationList::getValue(plan.dataBlocks[stack.rotationBlock], &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			MEulerRotation eulerAngles = Maxformations::matrixToEulerRotation(quat.asMatrix(), MEulerRotation::RotationOrder::kXYZ);
+			rotations[i] = MVector(eulerAngles.x, eulerAngles.y, eulerAngles.z);
+
+		}
+		else
+		{
+
+			MDataHandle rotationHandle = plan.dataBlocks[stack.prsBlock].inputValue(PRS::rotation, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			rotations[i] = MVector(
+				rotationHandle.child(PRS::x_rotation).asAngle().asRadians(),
+				rotationHandle.child(PRS::y_rotation).asAngle().asRadians(),
+				rotationHandle.child(PRS::z_rotation).asAngle().asRadians()
+			);
+
+		}
+
+	}
+
+	// Gather scale values
+	//
+	for (size_t i = 0; i < stackCount; i++)
+	{
+
+		const ControllerStack& stack = plan.stacks[i];
+
+		if (stack.scaleBlock != -1)
+		{
+
+			scales[i] = ScaleList::getValue(plan.dataBlocks[stack.scaleBlock], &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		}
+		else
+		{
+
+			MDataHandle scaleHandle = plan.dataBlocks[stack.prsBlock].inputValue(PRS::scale, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			scales[i] = MVector(
+				scaleHandle.child(PRS::x_scale).asDouble(),
+				scaleHandle.child(PRS::y_scale).asDouble(),
+				scaleHandle.child(PRS::z_scale).asDouble()
+			);
+
+		}
+
+	}
+
+	// Compose and update PRS values
+	//
+	for (size_t i = 0; i < stackCount; i++)
+	{
+
+		MDataBlock& data = plan.dataBlocks[plan.stacks[i].prsBlock];
+
+		MDataHandle axisOrderHandle = data.inputValue(PRS::axisOrder, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		MDataHandle orientationHandle = data.inputValue(PRS::orientation, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		MVector orientation = MVector(
+			orientationHandle.child(PRS::x_orientation).asAngle().asRadians(),
+			orientationHandle.child(PRS::y_orientation).asAngle().asRadians(),
+			orientationHandle.child(PRS::z_orientation).asAngle().asRadians()
+		);
+
+		MTransformationMatrix transform = PRS::createTransform(positions[i], rotations[i], orientation, scales[i], axisOrderHandle.asShort());
+
+		MDataHandle valueHandle = data.outputValue(PRS::value, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = Maxformations::setMatrixData(valueHandle, transform);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		valueHandle.setClean();
+
+		status = data.setClean(PRS::value);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	return status;
+
+};
+
+
+MPxNode* MaxformEvaluator::getUserNode(const MObject& node, MStatus* status)
+/**
+Returns the plug-in instance for the supplied node.
+
+@param node: The dependency node.
+@param status: Returns status.
+@return: The user node.
+*/
+{
+
+	MFnDependencyNode fnDependNode(node, status);
+	CHECK_MSTATUS_AND_RETURN(*status, nullptr);
+
+	MPxNode* userNode = fnDependNode.userNode(status);
+	CHECK_MSTATUS_AND_RETURN(*status, nullptr);
+
+	if (userNode == nullptr)
+	{
+
+		*status = MS::kFailure;
+
+	}
+
+	return userNode;
+
+};
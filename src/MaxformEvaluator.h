@@ -0,0 +1,103 @@
+#ifndef _MAXFORM_EVALUATOR
+#define _MAXFORM_EVALUATOR
+//
+// File: MaxformEvaluator.h
+//
+// Custom Evaluator: maxformEvaluator
+//
+// Author: Benjamin H. Singleton
+//
+
+#include "PRS.h"
+#include "PositionList.h"
+#include "RotationList.h"
+#include "ScaleList.h"
+
+#include <maya/MPxCustomEvaluator.h>
+#include <maya/MCustomEvaluatorClusterNode.h>
+#include <maya/MEvaluationNode.h>
+#include <maya/MObject.h>
+#include <maya/MObjectHandle.h>
+#include <maya/MPlug.h>
+#include <maya/MPlugArray.h>
+#include <maya/MDataBlock.h>
+#include <maya/MDataHandle.h>
+#include <maya/MDGContext.h>
+#include <maya/MFnDependencyNode.h>
+#include <maya/MTransformationMatrix.h>
+#include <maya/MEulerRotation.h>
+#include <maya/MQuaternion.h>
+#include <maya/MVector.h>
+#include <maya/MTypeId.h>
+#include <maya/MString.h>
+
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+
+
+struct ControllerStack
+{
+
+	MObjectHandle	prs;
+	MObjectHandle	positionList;
+	MObjectHandle	rotationList;
+	MObjectHandle	scaleList;
+
+	int				prsBlock = -1;
+	int				positionBlock = -1;
+	int				rotationBlock = -1;
+	int				scaleBlock = -1;
+
+};
+
+
+struct ClusterPlan
+{
+
+	bool							isInitialized = false;
+	bool							isFusable = false;
+	std::vector<MObjectHandle>		nodes;
+	std::vector<ControllerStack>	stacks;
+	std::vector<MDataBlock>			dataBlocks;
+
+};
+
+
+class MaxformEvaluator : public MPxCustomEvaluator
+{
+
+public:
+
+													MaxformEvaluator();
+	virtual											~MaxformEvaluator();
+
+	virtual	bool									markIfSupported(const MEvaluationNode* node);
+	virtual	MCustomEvaluatorClusterNode::SchedulingType	schedulingType(const MCustomEvaluatorClusterNode* cluster);
+
+	virtual	bool									clusterInitialize(const MCustomEvaluatorClusterNode* cluster);
+	virtual	void									clusterTerminate(const MCustomEvaluatorClusterNode* cluster);
+	virtual	void									clusterEvaluate(const MCustomEvaluatorClusterNode* cluster);
+
+	static	void*									creator();
+
+	static	void									recordCompute(const MObject& node);
+	static	bool									isSupported(const MTypeId& typeId);
+	static	MStatus									createPlan(ClusterPlan& plan);
+	static	bool									attachList(const MObject& list, const MTypeId& typeId, std::vector<ControllerStack>& stacks, const std::unordered_map<unsigned int, size_t>& stackIndices);
+	static	MStatus									resolvePlan(ClusterPlan& plan);
+	static	int										resolveBlock(const MObjectHandle& handle, ClusterPlan& plan, MStatus* status);
+	static	MStatus									evaluatePlan(ClusterPlan& plan);
+	static	MPxNode*								getUserNode(const MObject& node, MStatus* status);
+
+public:
+
+	static	MString									evaluatorName;
+	static	unsigned int							priority;
+
+protected:
+
+			std::unordered_map<const MCustomEvaluatorClusterNode*, ClusterPlan>	plans;
+
+};
+#endif
@@ -0,0 +1,807 @@
+//
+// File: MaxformProfiler.cpp
+//
+// Author: Benjamin H. Singleton
+//
+
+#include "MaxformProfiler.h"
+
+#include <maya/MFnDependencyNode.h>
+
+#include <mutex>
+#include <vector>
+#include <unordered_map>
+#include <cstring>
+
+
+namespace MaxformProfiler
+{
+
+	int computeCategory = -1;
+	int solverCategory = -1;
+	int topologyCategory = -1;
+
+	MStatus registerCategories()
+	/**
+	Registers the profiler categories used by the plug-in.
+	This does nothing when profiling has been compiled out!
+
+	@return: Return status.
+	*/
+	{
+
+#if defined(MAXFORM_ENABLE_PROFILING)
+
+		computeCategory = MProfiler::addCategory("Maxform", "Maxform node computes");
+		solverCategory = MProfiler::addCategory("Maxform Solvers", "Maxform solver and sampling stages");
+		topologyCategory = MProfiler::addCategory("Maxform Topology", "Maxform controller connection edits");
+
+#endif
+
+		return MS::kSuccess;
+
+	};
+
+	MStatus deregisterCategories()
+	/**
+	Removes the profiler categories used by the plug-in.
+	This does nothing when profiling has been compiled out!
+
+	@return: Return status.
+	*/
+	{
+
+#if defined(MAXFORM_ENABLE_PROFILING)
+
+		MProfiler::removeCategory("Maxform");
+		MProfiler::removeCategory("Maxform Solvers");
+		MProfiler::removeCategory("Maxform Topology");
+
+		computeCategory = solverCategory = topologyCategory = -1;
+
+#endif
+
+		return MS::kSuccess;
+
+	};
+
+	struct ThreadRecord
+	{
+
+		StatisticsRecord												records[MAX_STATISTICS];
+		std::unordered_map<unsigned int, std::vector<InstanceRecord*>>	instances;
+		unsigned int													instanceGeneration = 0;
+
+	};
+
+	struct StatisticsTotals
+	{
+
+		unsigned long long	calls = 0;
+		unsigned long long	nanoseconds = 0;
+		unsigned long long	cacheHits = 0;
+		unsigned long long	cacheMisses = 0;
+		unsigned long long	iterations = 0;
+		unsigned long long	histogram[HISTOGRAM_BUCKETS] = {};
+
+	};
+
+	// The registries below are only locked when a new statistic, thread or node instance is first seen, or when collecting!
+	// Every other update goes straight into the calling thread's own records.
+	//
+	std::atomic<bool> recording(false);
+	std::atomic<bool> trackingInstances(false);
+
+	std::mutex registryMutex;
+	const char* statisticNames[MAX_STATISTICS] = {};
+	unsigned int statisticCount = 0;
+
+	std::vector<ThreadRecord*> threadRecords;
+
+	// Hash codes are not unique so each bucket is confirmed against the node handles, much like `Maxformations::deferUntilLoaded`.
+	// Evicting deleted nodes bumps the generation so each thread knows to drop its own lookup before touching any stale records!
+	//
+	std::unordered_map<unsigned int, std::vector<InstanceRecord*>> instanceRecords;
+	std::atomic<unsigned int> instanceGeneration(0);
+
+	thread_local ThreadRecord* threadRecord = nullptr;
+	thread_local StatisticsScope* currentScope = nullptr;
+
+	ThreadRecord* getThreadRecord()
+	/**
+	Returns the statistics records owned by the calling thread.
+	The records are intentionally never freed since Maya's evaluation threads outlive the plug-in's commands!
+
+	@return: The thread's records.
+	*/
+	{
+
+		if (threadRecord == nullptr)
+		{
+
+			threadRecord = new ThreadRecord();
+
+			std::lock_guard<std::mutex> lock(registryMutex);
+			threadRecords.push_back(threadRecord);
+
+		}
+
+		return threadRecord;
+
+	};
+
+	InstanceRecord* findInstanceRecord(const std::vector<InstanceRecord*>& instances, const MObject& node)
+	/**
+	Returns the record, from the supplied hash bucket, that belongs to the specified node.
+
+	@param instances: The hash bucket to search.
+	@param node: The computing node.
+	@return: The node's record, or a null pointer if there is none.
+	*/
+	{
+
+		for (InstanceRecord* instance : instances)
+		{
+
+			if (instance->handle.isAlive() && instance->handle.objectRef() == node)
+			{
+
+				return instance;
+
+			}
+
+		}
+
+		return nullptr;
+
+	};
+
+	InstanceRecord* getInstanceRecord(ThreadRecord* thread, const unsigned int statisticIndex, const MObject& node)
+	/**
+	Returns the shared statistics record for the supplied node.
+	Each thread keeps its own lookup so the registry is only locked the first time a thread sees a node!
+
+	@param thread: The calling thread's records.
+	@param statisticIndex: The statistic the node reports under.
+	@param node: The computing node.
+	@return: The node's record.
+	*/
+	{
+
+		// Check if the thread's lookup is stale
+		//
+		unsigned int generation = instanceGeneration.load(std::memory_order_acquire);
+
+		if (thread->instanceGeneration != generation)
+		{
+
+			thread->instances.clear();
+			thread->instanceGeneration = generation;
+
+		}
+
+		// Search the thread's lookup
+		//
+		MObjectHandle handle = MObjectHandle(node);
+		std::vector<InstanceRecord*>& threadInstances = thread->instances[handle.hashCode()];
+
+		InstanceRecord* instance = findInstanceRecord(threadInstances, node);
+
+		if (instance != nullptr)
+		{
+
+			return instance;
+
+		}
+
+		// Search the shared registry
+		//
+		std::lock_guard<std::mutex> lock(registryMutex);
+
+		std::vector<InstanceRecord*>& sharedInstances = instanceRecords[handle.hashCode()];
+		instance = findInstanceRecord(sharedInstances, node);
+
+		if (instance == nullptr)
+		{
+
+			instance = new InstanceRecord();
+			instance->handle = handle;
+			instance->statisticIndex = statisticIndex;
+
+			sharedInstances.push_back(instance);
+
+		}
+
+		threadInstances.push_back(instance);
+
+		return instance;
+
+	};
+
+	unsigned int getBucket(const unsigned long long nanoseconds)
+	/**
+	Returns the histogram bucket for the supplied duration.
+	Each bucket covers a power of two so percentiles are accurate to within a factor of two!
+
+	@param nanoseconds: The duration.
+	@return: The bucket index.
+	*/
+	{
+
+		unsigned int bucket = 0;
+
+		while ((nanoseconds >> (bucket + 1)) > 0 && (bucket + 1) < HISTOGRAM_BUCKETS)
+		{
+
+			bucket++;
+
+		}
+
+		return bucket;
+
+	};
+
+	void addSample(StatisticsRecord& record, const unsigned long long nanoseconds, const unsigned int bucket)
+	/**
+	Adds a timed call to the supplied record.
+
+	@param record: The record to update.
+	@param nanoseconds: The duration of the call.
+	@param bucket: The histogram bucket for the duration.
+	@return: Void.
+	*/
+	{
+
+		record.calls.fetch_add(1, std::memory_order_relaxed);
+		record.nanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+		record.histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+
+	};
+
+	void resetRecord(StatisticsRecord& record)
+	/**
+	Zeroes the supplied record.
+
+	@param record: The record to reset.
+	@return: Void.
+	*/
+	{
+
+		record.calls = 0;
+		record.nanoseconds = 0;
+		record.cacheHits = 0;
+		record.cacheMisses = 0;
+		record.iterations = 0;
+
+		for (unsigned int i = 0; i < HISTOGRAM_BUCKETS; i++)
+		{
+
+			record.histogram[i] = 0;
+
+		}
+
+	};
+
+	void accumulateRecord(const StatisticsRecord& record, StatisticsTotals& totals)
+	/**
+	Adds the supplied record onto the passed totals.
+
+	@param record: The record to read from.
+	@param totals: The passed totals to update.
+	@return: Void.
+	*/
+	{
+
+		totals.calls += record.calls.load(std::memory_order_relaxed);
+		totals.nanoseconds += record.nanoseconds.load(std::memory_order_relaxed);
+		totals.cacheHits += record.cacheHits.load(std::memory_order_relaxed);
+		totals.cacheMisses += record.cacheMisses.load(std::memory_order_relaxed);
+		totals.iterations += record.iterations.load(std::memory_order_relaxed);
+
+		for (unsigned int i = 0; i < HISTOGRAM_BUCKETS; i++)
+		{
+
+			totals.histogram[i] += record.histogram[i].load(std::memory_order_relaxed);
+
+		}
+
+	};
+
+	double getPercentile(const StatisticsTotals& totals, const double percentile)
+	/**
+	Returns the upper bound, in microseconds, of the histogram bucket containing the specified percentile.
+
+	@param totals: The totals to inspect.
+	@param percentile: The percentile, from 0 to 1.
+	@return: The duration in microseconds.
+	*/
+	{
+
+		unsigned long long sampleCount = 0;
+		double threshold = percentile * static_cast<double>(totals.calls);
+
+		for (unsigned int i = 0; i < HISTOGRAM_BUCKETS; i++)
+		{
+
+			sampleCount += totals.histogram[i];
+
+			if (static_cast<double>(sampleCount) >= threshold)
+			{
+
+				return static_cast<double>(2ULL << i) / 1000.0;
+
+			}
+
+		}
+
+		return 0.0;
+
+	};
+
+	MString totalsToJSON(const StatisticsTotals& totals)
+	/**
+	Serializes the supplied totals into a JSON object.
+	Cache and iteration fields are omitted when nothing was recorded for them!
+
+	@param totals: The totals to serialize.
+	@return: The JSON object.
+	*/
+	{
+
+		MString json, value;
+
+		json += "{\"calls\": ";
+		json += static_cast<double>(totals.calls);
+
+		value.set(static_cast<double>(totals.nanoseconds) / 1e6, 3);
+		json += ", \"totalMs\": ";
+		json += value;
+
+		value.set(getPercentile(totals, 0.5), 3);
+		json += ", \"p50Us\": ";
+		json += value;
+
+		value.set(getPercentile(totals, 0.9), 3);
+		json += ", \"p90Us\": ";
+		json += value;
+
+		value.set(getPercentile(totals, 0.99), 3);
+		json += ", \"p99Us\": ";
+		json += value;
+
+		unsigned long long cacheAccesses = totals.cacheHits + totals.cacheMisses;
+
+		if (cacheAccesses > 0)
+		{
+
+			value.set(static_cast<double>(totals.cacheHits) / static_cast<double>(cacheAccesses), 3);
+			json += ", \"cacheHitRate\": ";
+			json += value;
+
+		}
+
+		if (totals.iterations > 0 && totals.calls > 0)
+		{
+
+			value.set(static_cast<double>(totals.iterations) / static_cast<double>(totals.calls), 3);
+			json += ", \"iterationsPerCall\": ";
+			json += value;
+
+		}
+
+		json += "}";
+
+		return json;
+
+	};
+
+	StatisticsScope::StatisticsScope(const unsigned int statisticIndex, const MObject& node)
+	/**
+	Starts timing the enclosing compute if statistics are being recorded.
+
+	@param statisticIndex: The statistic to report under, see `registerStatistic` for details.
+	@param node: The computing node.
+	*/
+	{
+
+		this->typeRecord = nullptr;
+		this->instanceRecord = nullptr;
+		this->parentScope = nullptr;
+
+		if (!recording.load(std::memory_order_relaxed) || statisticIndex >= MAX_STATISTICS)
+		{
+
+			return;
+
+		}
+
+		ThreadRecord* thread = getThreadRecord();
+		this->typeRecord = &thread->records[statisticIndex];
+
+		if (trackingInstances.load(std::memory_order_relaxed))
+		{
+
+			this->instanceRecord = getInstanceRecord(thread, statisticIndex, node);
+
+		}
+
+		this->parentScope = currentScope;
+		currentScope = this;
+
+		this->startTime = std::chrono::steady_clock::now();
+
+	};
+
+	StatisticsScope::~StatisticsScope()
+	/**
+	Stops timing the enclosing compute and adds it to the thread's records.
+	*/
+	{
+
+		if (this->typeRecord == nullptr)
+		{
+
+			return;
+
+		}
+
+		std::chrono::steady_clock::time_point endTime = std::chrono::steady_clock::now();
+		unsigned long long nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - this->startTime).count();
+		unsigned int bucket = getBucket(nanoseconds);
+
+		addSample(*this->typeRecord, nanoseconds, bucket);
+
+		if (this->instanceRecord != nullptr)
+		{
+
+			addSample(this->instanceRecord->record, nanoseconds, bucket);
+
+		}
+
+		currentScope = this->parentScope;
+
+	};
+
+	unsigned int registerStatistic(const char* name)
+	/**
+	Returns the index for the supplied statistic name, registering it if required.
+	Callers are expected to cache the index, see the `MAXFORM_STATISTICS_SCOPE` macro for details.
+
+	@param name: The statistic name.
+	@return: The statistic index, or `MAX_STATISTICS` if the registry is full.
+	*/
+	{
+
+		std::lock_guard<std::mutex> lock(registryMutex);
+
+		for (unsigned int i = 0; i < statisticCount; i++)
+		{
+
+			if (std::strcmp(statisticNames[i], name) == 0)
+			{
+
+				return i;
+
+			}
+
+		}
+
+		if (statisticCount >= MAX_STATISTICS)
+		{
+
+			return MAX_STATISTICS;
+
+		}
+
+		statisticNames[statisticCount] = name;
+
+		return statisticCount++;
+
+	};
+
+	bool isRecording()
+	/**
+	Evaluates if compute statistics are being recorded.
+
+	@return: Is recording.
+	*/
+	{
+
+		return recording;
+
+	};
+
+	void setRecording(const bool enabled)
+	/**
+	Updates whether compute statistics are recorded.
+
+	@param enabled: Is recording.
+	@return: Void.
+	*/
+	{
+
+		recording = enabled;
+
+	};
+
+	bool isTrackingInstances()
+	/**
+	Evaluates if statistics are also recorded per node instance.
+
+	@return: Is tracking instances.
+	*/
+	{
+
+		return trackingInstances;
+
+	};
+
+	void setTrackingInstances(const bool enabled)
+	/**
+	Updates whether statistics are also recorded per node instance.
+
+	@param enabled: Is tracking instances.
+	@return: Void.
+	*/
+	{
+
+		trackingInstances = enabled;
+
+	};
+
+	bool isAvailable()
+	/**
+	Evaluates if compute statistics were compiled into this build.
+	See the `MAXFORM_ENABLE_STATISTICS` option in CMakeLists.txt for details.
+
+	@return: Is available.
+	*/
+	{
+
+#if defined(MAXFORM_ENABLE_STATISTICS)
+
+		return true;
+
+#else
+
+		return false;
+
+#endif
+
+	};
+
+	void recordCacheAccess(const bool isHit)
+	/**
+	Records a cache access against the innermost compute on the calling thread.
+
+	@param isHit: Was the cache hit.
+	@return: Void.
+	*/
+	{
+
+		StatisticsScope* scope = currentScope;
+
+		if (scope == nullptr)
+		{
+
+			return;
+
+		}
+
+		std::atomic<unsigned long long>& typeCounter = isHit ? scope->typeRecord->cacheHits : scope->typeRecord->cacheMisses;
+		typeCounter.fetch_add(1, std::memory_order_relaxed);
+
+		if (scope->instanceRecord != nullptr)
+		{
+
+			std::atomic<unsigned long long>& instanceCounter = isHit ? scope->instanceRecord->record.cacheHits : scope->instanceRecord->record.cacheMisses;
+			instanceCounter.fetch_add(1, std::memory_order_relaxed);
+
+		}
+
+	};
+
+	void recordIterations(const unsigned int iterations)
+	/**
+	Records solver iterations against the innermost compute on the calling thread.
+
+	@param iterations: The number of iterations used.
+	@return: Void.
+	*/
+	{
+
+		StatisticsScope* scope = currentScope;
+
+		if (scope == nullptr)
+		{
+
+			return;
+
+		}
+
+		scope->typeRecord->iterations.fetch_add(iterations, std::memory_order_relaxed);
+
+		if (scope->instanceRecord != nullptr)
+		{
+
+			scope->instanceRecord->record.iterations.fetch_add(iterations, std::memory_order_relaxed);
+
+		}
+
+	};
+
+	void resetStatistics()
+	/**
+	Zeroes every recorded statistic and evicts the records of any deleted nodes.
+	Registered statistics and live node instances are kept so no thread has to re-register them!
+	This must only be called from the main thread while nothing is being evaluated!
+
+	@return: Void.
+	*/
+	{
+
+		std::lock_guard<std::mutex> lock(registryMutex);
+
+		for (ThreadRecord* thread : threadRecords)
+		{
+
+			for (unsigned int i = 0; i < MAX_STATISTICS; i++)
+			{
+
+				resetRecord(thread->records[i]);
+
+			}
+
+		}
+
+		bool isEvicted = false;
+
+		for (std::unordered_map<unsigned int, std::vector<InstanceRecord*>>::iterator iter = instanceRecords.begin(); iter != instanceRecords.end();)
+		{
+
+			std::vector<InstanceRecord*>& instances = iter->second;
+
+			for (std::vector<InstanceRecord*>::iterator instance = instances.begin(); instance != instances.end();)
+			{
+
+				if ((*instance)->handle.isAlive())
+				{
+
+					resetRecord((*instance)->record);
+					instance++;
+
+				}
+				else
+				{
+
+					delete *instance;
+					instance = instances.erase(instance);
+
+					isEvicted = true;
+
+				}
+
+			}
+
+			iter = instances.empty() ? instanceRecords.erase(iter) : std::next(iter);
+
+		}
+
+		if (isEvicted)
+		{
+
+			instanceGeneration.fetch_add(1, std::memory_order_release);
+
+		}
+
+	};
+
+	MString statisticsToJSON(const bool includeInstances)
+	/**
+	Collects the statistics from every thread and serializes them into a JSON string.
+	This resolves node names so it must only be called from the main thread!
+
+	@param includeInstances: Determines if per-instance statistics are included.
+	@return: The JSON string.
+	*/
+	{
+
+		std::lock_guard<std::mutex> lock(registryMutex);
+
+		// Collect statistic totals
+		//
+		MString json;
+		json += "{\n\t\"recording\": ";
+		json += recording ? "true" : "false";
+		json += ",\n\t\"types\": {";
+
+		bool isFirst = true;
+
+		for (unsigned int i = 0; i < statisticCount; i++)
+		{
+
+			StatisticsTotals totals;
+
+			for (ThreadRecord* thread : threadRecords)
+			{
+
+				accumulateRecord(thread->records[i], totals);
+
+			}
+
+			if (totals.calls == 0)
+			{
+
+				continue;  // Skip unused statistics!
+
+			}
+
+			json += isFirst ? "\n\t\t\"" : ",\n\t\t\"";
+			json += statisticNames[i];
+			json += "\": ";
+			json += totalsToJSON(totals);
+
+			isFirst = false;
+
+		}
+
+		json += "\n\t}";
+
+		// Collect instance totals
+		//
+		if (includeInstances)
+		{
+
+			json += ",\n\t\"instances\": {";
+			isFirst = true;
+
+			for (std::pair<const unsigned int, std::vector<InstanceRecord*>>& pair : instanceRecords)
+			{
+
+				for (InstanceRecord* instance : pair.second)
+				{
+
+					if (!instance->handle.isAlive() || !instance->handle.isValid())
+					{
+
+						continue;  // Skip deleted nodes!
+
+					}
+
+					StatisticsTotals totals;
+					accumulateRecord(instance->record, totals);
+
+					if (totals.calls == 0)
+					{
+
+						continue;
+
+					}
+
+					MFnDependencyNode fnNode(instance->handle.object());
+
+					json += isFirst ? "\n\t\t\"" : ",\n\t\t\"";
+					json += fnNode.name();
+					json += "\": {\"type\": \"";
+					json += statisticNames[instance->statisticIndex];
+					json += "\", \"statistics\": ";
+					json += totalsToJSON(totals);
+					json += "}";
+
+					isFirst = false;
+
+				}
+
+			}
+
+			json += "\n\t}";
+
+		}
+
+		json += "\n}\n";
+
+		return json;
+
+	};
+
+};
@@ -0,0 +1,134 @@
+#ifndef _MAXFORM_PROFILER
+#define _MAXFORM_PROFILER
+//
+// File: MaxformProfiler.h
+//
+// Author: Benjamin H. Singleton
+//
+// The profiling macros below only expand when `MAXFORM_ENABLE_PROFILING` is defined.
+// Release builds compile them out entirely, see the `MAXFORM_ENABLE_PROFILING` option in CMakeLists.txt for details.
+//
+// Compute statistics are compiled in separately through `MAXFORM_ENABLE_STATISTICS` and only recorded once enabled through the `maxformStats` command.
+// Each thread accumulates into its own counters so recording never serializes parallel evaluation!
+//
+
+#include <maya/MStatus.h>
+#include <maya/MObject.h>
+#include <maya/MObjectHandle.h>
+#include <maya/MString.h>
+
+#include <atomic>
+#include <chrono>
+
+#if defined(MAXFORM_ENABLE_PROFILING)
+#include <maya/MProfiler.h>
+#endif
+
+
+namespace MaxformProfiler
+{
+
+	extern int		computeCategory;
+	extern int		solverCategory;
+	extern int		topologyCategory;
+
+	MStatus			registerCategories();
+	MStatus			deregisterCategories();
+
+	const unsigned int	MAX_STATISTICS = 64;
+	const unsigned int	HISTOGRAM_BUCKETS = 48;
+
+	struct StatisticsRecord
+	{
+
+		std::atomic<unsigned long long>	calls{ 0 };
+		std::atomic<unsigned long long>	nanoseconds{ 0 };
+		std::atomic<unsigned long long>	cacheHits{ 0 };
+		std::atomic<unsigned long long>	cacheMisses{ 0 };
+		std::atomic<unsigned long long>	iterations{ 0 };
+		std::atomic<unsigned long long>	histogram[HISTOGRAM_BUCKETS] = {};
+
+	};
+
+	struct InstanceRecord
+	{
+
+		MObjectHandle		handle;
+		unsigned int		statisticIndex;
+		StatisticsRecord	record;
+
+	};
+
+	class StatisticsScope
+	/**
+	Times the enclosing compute and attributes any cache or iteration counts, recorded within it, to the computing node.
+	The scope does nothing beyond a single atomic load while statistics are disabled!
+	*/
+	{
+
+	public:
+
+								StatisticsScope(const unsigned int statisticIndex, const MObject& node);
+								~StatisticsScope();
+
+		StatisticsRecord*		typeRecord;
+		InstanceRecord*			instanceRecord;
+
+	protected:
+
+		StatisticsScope*		parentScope;
+		std::chrono::steady_clock::time_point	startTime;
+
+	};
+
+	unsigned int	registerStatistic(const char* name);
+	bool			isRecording();
+	void			setRecording(const bool enabled);
+	bool			isTrackingInstances();
+	void			setTrackingInstances(const bool enabled);
+	bool			isAvailable();
+
+	void			recordCacheAccess(const bool isHit);
+	void			recordIterations(const unsigned int iterations);
+
+	void			resetStatistics();
+	MString			statisticsToJSON(const bool includeInstances);
+
+};
+
+#define MAXFORM_PROFILE_JOIN(left, right) left##right
+#define MAXFORM_PROFILE_NAME(prefix, line) MAXFORM_PROFILE_JOIN(prefix, line)
+
+#if defined(MAXFORM_ENABLE_STATISTICS)
+
+#define MAXFORM_STATISTICS_SCOPE(eventName, node) \
+	static const unsigned int MAXFORM_PROFILE_NAME(maxformStatisticIndex, __LINE__) = MaxformProfiler::registerStatistic(eventName); \
+	MaxformProfiler::StatisticsScope MAXFORM_PROFILE_NAME(maxformStatisticsScope, __LINE__)(MAXFORM_PROFILE_NAME(maxformStatisticIndex, __LINE__), node)
+#define MAXFORM_RECORD_CACHE_ACCESS(isHit) MaxformProfiler::recordCacheAccess(isHit)
+#define MAXFORM_RECORD_ITERATIONS(iterations) MaxformProfiler::recordIterations(iterations)
+
+#else
+
+#define MAXFORM_STATISTICS_SCOPE(eventName, node)
+#define MAXFORM_RECORD_CACHE_ACCESS(isHit)
+#define MAXFORM_RECORD_ITERATIONS(iterations)
+
+#endif
+
+#if defined(MAXFORM_ENABLE_PROFILING)
+
+#define MAXFORM_PROFILE_COMPUTE(eventName, node) \
+	MProfilingScope MAXFORM_PROFILE_NAME(maxformProfilingScope, __LINE__)(MaxformProfiler::computeCategory, MProfiler::kColorC_L2, eventName, nullptr, node); \
+	MAXFORM_STATISTICS_SCOPE(eventName, node)
+#define MAXFORM_PROFILE_SOLVER(eventName) MProfilingScope MAXFORM_PROFILE_NAME(maxformProfilingScope, __LINE__)(MaxformProfiler::solverCategory, MProfiler::kColorD_L2, eventName)
+#define MAXFORM_PROFILE_TOPOLOGY(eventName) MProfilingScope MAXFORM_PROFILE_NAME(maxformProfilingScope, __LINE__)(MaxformProfiler::topologyCategory, MProfiler::kColorE_L2, eventName)
+
+#else
+
+#define MAXFORM_PROFILE_COMPUTE(eventName, node) MAXFORM_STATISTICS_SCOPE(eventName, node)
+#define MAXFORM_PROFILE_SOLVER(eventName)
+#define MAXFORM_PROFILE_TOPOLOGY(eventName)
+
+#endif
+
+#endif
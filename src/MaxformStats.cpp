@@ -0,0 +1,171 @@
+//
+// File: MaxformStats.cpp
+//
+// MEL Command: maxformStats
+//
+// Author: Benjamin H. Singleton
+//
+
+#include "MaxformStats.h"
+
+MString MaxformStats::commandName("maxformStats");
+
+const char* MaxformStats::enableFlag = "-e";
+const char* MaxformStats::enableLongFlag = "-enable";
+const char* MaxformStats::instancesFlag = "-i";
+const char* MaxformStats::instancesLongFlag = "-instances";
+const char* MaxformStats::resetFlag = "-r";
+const char* MaxformStats::resetLongFlag = "-reset";
+const char* MaxformStats::outputFlag = "-o";
+const char* MaxformStats::outputLongFlag = "-output";
+
+
+MaxformStats::MaxformStats() {}
+MaxformStats::~MaxformStats() {};
+
+
+MStatus MaxformStats::doIt(const MArgList& args)
+/**
+Returns the compute statistics recorded by the Maxformations nodes as a JSON string.
+The enable and instances flags toggle recording, which is off by default, before the statistics are collected.
+When the reset flag is set the statistics are zeroed after being returned, so each call can report a single interval!
+
+@param args: The command arguments.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Update recording state
+	//
+	MArgDatabase argDatabase(MaxformStats::newSyntax(), args, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	bool enabled;
+
+	if (argDatabase.isFlagSet(MaxformStats::enableFlag))
+	{
+
+		status = argDatabase.getFlagArgument(MaxformStats::enableFlag, 0, enabled);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		if (enabled && !MaxformProfiler::isAvailable())
+		{
+
+			MGlobal::displayWarning("Compute statistics were not compiled into this build!");
+
+		}
+
+		MaxformProfiler::setRecording(enabled);
+
+	}
+
+	if (argDatabase.isFlagSet(MaxformStats::instancesFlag))
+	{
+
+		status = argDatabase.getFlagArgument(MaxformStats::instancesFlag, 0, enabled);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		MaxformProfiler::setTrackingInstances(enabled);
+
+	}
+
+	// Collect statistics
+	//
+	MString json = MaxformProfiler::statisticsToJSON(MaxformProfiler::isTrackingInstances());
+
+	if (argDatabase.isFlagSet(MaxformStats::outputFlag))
+	{
+
+		MString outputPath;
+
+		status = argDatabase.getFlagArgument(MaxformStats::outputFlag, 0, outputPath);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		std::ofstream file(outputPath.asChar());
+
+		if (!file.is_open())
+		{
+
+			MGlobal::displayError("Unable to write statistics to: " + outputPath);
+			return MS::kFailure;
+
+		}
+
+		file << json.asChar();
+		file.close();
+
+	}
+
+	if (argDatabase.isFlagSet(MaxformStats::resetFlag))
+	{
+
+		MaxformProfiler::resetStatistics();
+
+	}
+
+	MaxformStats::setResult(json);
+
+	return status;
+
+};
+
+
+bool MaxformStats::isUndoable() const
+/**
+This method is used to specify whether or not the command is undoable.
+
+@return: bool
+*/
+{
+
+	return false;
+
+};
+
+
+bool MaxformStats::hasSyntax() const
+/**
+This method specifies whether or not the command has a syntax object.
+
+@return: bool
+*/
+{
+
+	return true;
+
+};
+
+
+void* MaxformStats::creator()
+/**
+This function is called by Maya when a new instance is requested.
+See pluginMain.cpp for details.
+
+@return: MaxformStats
+*/
+{
+
+	return new MaxformStats();
+
+};
+
+
+MSyntax MaxformStats::newSyntax()
+/**
+Returns the syntax object for this command.
+
+@return: MSyntax
+*/
+{
+
+	MSyntax syntax;
+	syntax.addFlag(MaxformStats::enableFlag, MaxformStats::enableLongFlag, MSyntax::kBoolean);
+	syntax.addFlag(MaxformStats::instancesFlag, MaxformStats::instancesLongFlag, MSyntax::kBoolean);
+	syntax.addFlag(MaxformStats::resetFlag, MaxformStats::resetLongFlag);
+	syntax.addFlag(MaxformStats::outputFlag, MaxformStats::outputLongFlag, MSyntax::kString);
+
+	return syntax;
+
+};
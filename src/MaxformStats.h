@@ -0,0 +1,53 @@
+#ifndef _MAXFORM_STATS_COMMAND
+#define _MAXFORM_STATS_COMMAND
+//
+// File: MaxformStats.h
+//
+// MEL Command: maxformStats
+//
+// Author: Benjamin H. Singleton
+//
+
+#include <maya/MPxCommand.h>
+#include <maya/MObject.h>
+#include <maya/MArgList.h>
+#include <maya/MArgDatabase.h>
+#include <maya/MSyntax.h>
+#include <maya/MString.h>
+#include <maya/MGlobal.h>
+
+#include <fstream>
+
+#include "MaxformProfiler.h"
+
+
+class MaxformStats : public MPxCommand
+{
+
+public:
+
+						MaxformStats();
+	virtual				~MaxformStats();
+
+	virtual	MStatus		doIt(const MArgList& args);
+	virtual	bool		isUndoable() const;
+	virtual	bool		hasSyntax() const;
+
+	static	void*		creator();
+	static	MSyntax		newSyntax();
+
+public:
+
+	static	MString		commandName;
+
+	static	const char*	enableFlag;
+	static	const char*	enableLongFlag;
+	static	const char*	instancesFlag;
+	static	const char*	instancesLongFlag;
+	static	const char*	resetFlag;
+	static	const char*	resetLongFlag;
+	static	const char*	outputFlag;
+	static	const char*	outputLongFlag;
+
+};
+#endif
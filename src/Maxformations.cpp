@@ -61,6 +61,7 @@ namespace Maxformations
 	MMatrix createRotationMatrix(const double x, const double y, const double z, const AxisOrder axisOrder)
 	/**
 	Creates a rotation matrix from the supplied angles and axis order.
+	This is the only runtime dispatch, see `createRotationMatrix<AxisOrder>` for the specialized kernels.
 
 	@param x: The X angle in radians.
 	@param y: The Y angle in radians.
@@ -70,64 +71,35 @@ namespace Maxformations
 	*/
 	{
 
-		// Compose rotation axis matrices
-		//
-		double rotateX[4][4] = {
-			{1.0, 0.0, 0.0, 0.0},
-			{0.0, cos(x), sin(x), 0.0},
-			{0.0, -sin(x), cos(x), 0.0},
-			{0.0, 0.0, 0.0, 1.0}
-		};
-
-		double rotateY[4][4] = {
-			{cos(y), 0.0, -sin(y), 0.0},
-			{0.0, 1.0, 0.0, 0.0},
-			{sin(y), 0.0, cos(y), 0.0},
-			{0.0, 0.0, 0.0, 1.0}
-		};
-
-		double rotateZ[4][4] = {
-			{cos(z), sin(z), 0.0, 0.0},
-			{-sin(z), cos(z), 0.0, 0.0},
-			{0.0, 0.0, 1.0, 0.0},
-			{0.0, 0.0, 0.0, 1.0}
-		};
-
-		MMatrix rotateXMatrix = MMatrix(rotateX);
-		MMatrix rotateYMatrix = MMatrix(rotateY);
-		MMatrix rotateZMatrix = MMatrix(rotateZ);
-
-		// Compose rotation matrix using axis order
-		//
 		switch (axisOrder)
 		{
 
 			case AxisOrder::xyz:
-				return rotateXMatrix * rotateYMatrix * rotateZMatrix;
+				return Maxformations::createRotationMatrix<AxisOrder::xyz>(x, y, z);
 
 			case AxisOrder::xzy:
-				return rotateXMatrix * rotateZMatrix * rotateYMatrix;
+				return Maxformations::createRotationMatrix<AxisOrder::xzy>(x, y, z);
 
 			case AxisOrder::yzx:
-				return rotateYMatrix * rotateZMatrix * rotateXMatrix;
+				return Maxformations::createRotationMatrix<AxisOrder::yzx>(x, y, z);
 
 			case AxisOrder::yxz:
-				return rotateYMatrix * rotateXMatrix * rotateZMatrix;
+				return Maxformations::createRotationMatrix<AxisOrder::yxz>(x, y, z);
 
 			case AxisOrder::zxy:
-				return rotateZMatrix * rotateXMatrix * rotateYMatrix;
+				return Maxformations::createRotationMatrix<AxisOrder::zxy>(x, y, z);
 
 			case AxisOrder::zyx:
-				return rotateZMatrix * rotateYMatrix * rotateXMatrix;
+				return Maxformations::createRotationMatrix<AxisOrder::zyx>(x, y, z);
 
 			case AxisOrder::xyx:
-				return rotateXMatrix * rotateYMatrix * rotateXMatrix;
+				return Maxformations::createRotationMatrix<AxisOrder::xyx>(x, y, z);
 
 			case AxisOrder::yzy:
-				return rotateYMatrix * rotateZMatrix * rotateYMatrix;
+				return Maxformations::createRotationMatrix<AxisOrder::yzy>(x, y, z);
 
 			case AxisOrder::zxz:
-				return rotateZMatrix * rotateXMatrix * rotateZMatrix;
+				return Maxformations::createRotationMatrix<AxisOrder::zxz>(x, y, z);
 
 			default:
 				return MMatrix(MMatrix::identity);
@@ -174,7 +146,7 @@ namespace Maxformations
 	*/
 	{
 
-		return createRotationMatrix(radians.x, radians.y, radians.z, AxisOrder::xyz);
+		return Maxformations::createRotationMatrix<AxisOrder::xyz>(radians.x, radians.y, radians.z);
 
 	};
 
@@ -636,6 +608,8 @@ namespace Maxformations
 
 		MStatus status;
 
+		MAXFORM_PROFILE_SOLVER("Maxformations::composeMatrix");
+
 		// Initialize mesh function set
 		//
 		MFnMesh fnMesh(mesh, &status);
@@ -754,6 +728,194 @@ namespace Maxformations
 
 	};
 
+	bool isAffine(const MMatrix& matrix)
+	/**
+	Evaluates if the supplied matrix is affine, meaning its last column is (0, 0, 0, 1).
+
+	@param matrix: The matrix to inspect.
+	@return: Is affine.
+	*/
+	{
+
+		return matrix(0, 3) == 0.0 && matrix(1, 3) == 0.0 && matrix(2, 3) == 0.0 && matrix(3, 3) == 1.0;
+
+	};
+
+	bool isRigid(const MMatrix& matrix)
+	/**
+	Evaluates if the supplied matrix is rigid, meaning it is affine and its upper 3x3 is orthonormal with no reflection.
+	The check only uses the axis rows so it remains cheaper than any inverse it guards!
+
+	@param matrix: The matrix to inspect.
+	@return: Is rigid.
+	*/
+	{
+
+		// Check if matrix is affine
+		//
+		bool isAffine = Maxformations::isAffine(matrix);
+
+		if (!isAffine)
+		{
+
+			return false;
+
+		}
+
+		// Check axis lengths
+		//
+		double xx = (matrix(0, 0) * matrix(0, 0)) + (matrix(0, 1) * matrix(0, 1)) + (matrix(0, 2) * matrix(0, 2));
+		double yy = (matrix(1, 0) * matrix(1, 0)) + (matrix(1, 1) * matrix(1, 1)) + (matrix(1, 2) * matrix(1, 2));
+		double zz = (matrix(2, 0) * matrix(2, 0)) + (matrix(2, 1) * matrix(2, 1)) + (matrix(2, 2) * matrix(2, 2));
+
+		bool isUnit = std::fabs(xx - 1.0) < Maxformations::RIGID_TOLERANCE && std::fabs(yy - 1.0) < Maxformations::RIGID_TOLERANCE && std::fabs(zz - 1.0) < Maxformations::RIGID_TOLERANCE;
+
+		if (!isUnit)
+		{
+
+			return false;
+
+		}
+
+		// Check axes are perpendicular
+		//
+		double xy = (matrix(0, 0) * matrix(1, 0)) + (matrix(0, 1) * matrix(1, 1)) + (matrix(0, 2) * matrix(1, 2));
+		double xz = (matrix(0, 0) * matrix(2, 0)) + (matrix(0, 1) * matrix(2, 1)) + (matrix(0, 2) * matrix(2, 2));
+		double yz = (matrix(1, 0) * matrix(2, 0)) + (matrix(1, 1) * matrix(2, 1)) + (matrix(1, 2) * matrix(2, 2));
+
+		bool isOrthogonal = std::fabs(xy) < Maxformations::RIGID_TOLERANCE && std::fabs(xz) < Maxformations::RIGID_TOLERANCE && std::fabs(yz) < Maxformations::RIGID_TOLERANCE;
+
+		if (!isOrthogonal)
+		{
+
+			return false;
+
+		}
+
+		// Check for reflection
+		//
+		double determinant = (matrix(0, 0) * ((matrix(1, 1) * matrix(2, 2)) - (matrix(1, 2) * matrix(2, 1)))) + (matrix(0, 1) * ((matrix(1, 2) * matrix(2, 0)) - (matrix(1, 0) * matrix(2, 2)))) + (matrix(0, 2) * ((matrix(1, 0) * matrix(2, 1)) - (matrix(1, 1) * matrix(2, 0))));
+
+		return determinant > 0.0;
+
+	};
+
+	MMatrix rigidInverse(const MMatrix& matrix)
+	/**
+	Returns the inverse of the supplied rigid matrix.
+	The upper 3x3 is transposed and the translation row is rotated back through it.
+	The matrix is assumed to be rigid, see `isRigid` to check beforehand!
+
+	@param matrix: The matrix to invert.
+	@return: The inverse matrix.
+	*/
+	{
+
+		double rows[4][4] = {
+			{ matrix(0, 0), matrix(1, 0), matrix(2, 0), 0.0 },
+			{ matrix(0, 1), matrix(1, 1), matrix(2, 1), 0.0 },
+			{ matrix(0, 2), matrix(1, 2), matrix(2, 2), 0.0 },
+			{ 0.0, 0.0, 0.0, 1.0 }
+		};
+
+		for (unsigned int i = 0; i < 3; i++)
+		{
+
+			rows[3][i] = -((matrix(3, 0) * matrix(i, 0)) + (matrix(3, 1) * matrix(i, 1)) + (matrix(3, 2) * matrix(i, 2)));
+
+		}
+
+		return MMatrix(rows);
+
+	};
+
+	MMatrix invertMatrix(const MMatrix& matrix)
+	/**
+	Returns the inverse of the supplied matrix using the cheapest method its structure allows.
+	Rigid matrices are transposed, affine matrices are inverted by cofactors and anything else falls back onto `MMatrix::inverse`.
+	Only use this for matrices of unknown structure, callers that already know their structure should call `rigidInverse` or `affineInverse` directly!
+
+	@param matrix: The matrix to invert.
+	@return: The inverse matrix.
+	*/
+	{
+
+		bool isRigid = Maxformations::isRigid(matrix);
+
+		if (isRigid)
+		{
+
+			return Maxformations::rigidInverse(matrix);
+
+		}
+		else
+		{
+
+			return Maxformations::affineInverse(matrix);
+
+		}
+
+	};
+
+	MMatrix affineInverse(const MMatrix& matrix)
+	/**
+	Returns the inverse of the supplied affine matrix.
+	Only the upper 3x3 is inverted, by cofactors, with the translation row solved against it.
+	Projective or singular matrices fall back onto the general `MMatrix::inverse` method!
+
+	@param matrix: The matrix to invert.
+	@return: The inverse matrix.
+	*/
+	{
+
+		// Check if matrix is affine
+		//
+		bool isAffine = Maxformations::isAffine(matrix);
+
+		if (!isAffine)
+		{
+
+			return matrix.inverse();
+
+		}
+
+		// Calculate cofactors of upper 3x3
+		//
+		double c00 = (matrix(1, 1) * matrix(2, 2)) - (matrix(1, 2) * matrix(2, 1));
+		double c01 = (matrix(1, 2) * matrix(2, 0)) - (matrix(1, 0) * matrix(2, 2));
+		double c02 = (matrix(1, 0) * matrix(2, 1)) - (matrix(1, 1) * matrix(2, 0));
+
+		double determinant = (matrix(0, 0) * c00) + (matrix(0, 1) * c01) + (matrix(0, 2) * c02);
+
+		if (determinant == 0.0)
+		{
+
+			return matrix.inverse();
+
+		}
+
+		double factor = 1.0 / determinant;
+
+		double rows[4][4] = {
+			{ c00 * factor, ((matrix(0, 2) * matrix(2, 1)) - (matrix(0, 1) * matrix(2, 2))) * factor, ((matrix(0, 1) * matrix(1, 2)) - (matrix(0, 2) * matrix(1, 1))) * factor, 0.0 },
+			{ c01 * factor, ((matrix(0, 0) * matrix(2, 2)) - (matrix(0, 2) * matrix(2, 0))) * factor, ((matrix(0, 2) * matrix(1, 0)) - (matrix(0, 0) * matrix(1, 2))) * factor, 0.0 },
+			{ c02 * factor, ((matrix(0, 1) * matrix(2, 0)) - (matrix(0, 0) * matrix(2, 1))) * factor, ((matrix(0, 0) * matrix(1, 1)) - (matrix(0, 1) * matrix(1, 0))) * factor, 0.0 },
+			{ 0.0, 0.0, 0.0, 1.0 }
+		};
+
+		// Solve translation against inverted 3x3
+		//
+		for (unsigned int i = 0; i < 3; i++)
+		{
+
+			rows[3][i] = -((matrix(3, 0) * rows[0][i]) + (matrix(3, 1) * rows[1][i]) + (matrix(3, 2) * rows[2][i]));
+
+		}
+
+		return MMatrix(rows);
+
+	};
+
 	MMatrixArray staggerMatrices(const MMatrixArray& matrices)
 	/**
 	Returns staggered matrices where each matrix is converted to local space using the preceding matrix as its parent space.
@@ -762,18 +924,49 @@ namespace Maxformations
 	@return: The matrices in local space.
 	*/
 	{
-		
-		MMatrixArray newMatrices = MMatrixArray(matrices);
-		unsigned int numMatrices = newMatrices.length();
 
-		for (unsigned int i = 1; i < numMatrices; i++)  // Skip the first item!
+		MMatrixArray newMatrices;
+		Maxformations::staggerMatrices(matrices, newMatrices);
+
+		return newMatrices;
+
+	};
+
+	void staggerMatrices(const MMatrixArray& matrices, MMatrixArray& newMatrices)
+	/**
+	Converts each matrix to local space using the preceding matrix as its parent space.
+	The matrices are processed as a core batch, reusing this thread's scratch buffers and the passed array between calls!
+
+	@param matrices: The matrices to stagger.
+	@param newMatrices: The passed array to populate with the matrices in local space.
+	@return: Void.
+	*/
+	{
+
+		thread_local MaxformCore::MatrixBatch worldBatch, localBatch;
+		Maxformations::toCoreMatrices(matrices, worldBatch);
+
+		bool isStaggered = MaxformCore::staggerBatch(worldBatch, localBatch);
+
+		if (isStaggered)
 		{
 
-			newMatrices[i] = matrices[i] * matrices[i - 1].inverse();
+			Maxformations::fromCoreMatrices(localBatch, newMatrices);
+			return;
 
 		}
 
-		return newMatrices;
+		// Fall back onto general inverses for projective or singular parents
+		//
+		unsigned int numMatrices = matrices.length();
+		newMatrices.setLength(numMatrices);
+
+		for (unsigned int i = 0; i < numMatrices; i++)
+		{
+
+			newMatrices[i] = (i == 0) ? matrices[i] : matrices[i] * Maxformations::invertMatrix(matrices[i - 1]);
+
+		}
 
 	};
 
@@ -781,22 +974,34 @@ namespace Maxformations
 	/**
 	Returns expanded matrices where each matrix is converted to world space using the preceding matrix as its parent space.
 
-	@param matrices: The matrices to stagger.
+	@param matrices: The matrices to expand.
 	@return: The matrices in world space.
 	*/
 	{
 
-		MMatrixArray newMatrices = MMatrixArray(matrices);
-		unsigned int numMatrices = newMatrices.length();
+		MMatrixArray newMatrices;
+		Maxformations::expandMatrices(matrices, newMatrices);
 
-		for (unsigned int i = 1; i < numMatrices; i++)  // Skip the first item!
-		{
+		return newMatrices;
 
-			newMatrices[i] = matrices[i] * newMatrices[i - 1];
+	};
 
-		}
+	void expandMatrices(const MMatrixArray& matrices, MMatrixArray& newMatrices)
+	/**
+	Converts each matrix to world space using the preceding matrix as its parent space.
+	The matrices are processed as a core batch, reusing this thread's scratch buffer and the passed array between calls!
 
-		return newMatrices;
+	@param matrices: The matrices to expand.
+	@param newMatrices: The passed array to populate with the matrices in world space.
+	@return: Void.
+	*/
+	{
+
+		thread_local MaxformCore::MatrixBatch batch;
+		Maxformations::toCoreMatrices(matrices, batch);
+
+		MaxformCore::expandBatch(batch);
+		Maxformations::fromCoreMatrices(batch, newMatrices);
 
 	};
 
@@ -871,16 +1076,13 @@ namespace Maxformations
 		status = createAimMatrix(forwardAxis, forwardAxisFlip, upAxis, upAxisFlip, aimMatrix);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		// Re-orient matrices
+		// Re-orient matrices as a core batch
 		//
-		unsigned int numMatrices = matrices.length();
+		thread_local MaxformCore::MatrixBatch batch;
+		Maxformations::toCoreMatrices(matrices, batch);
 
-		for (unsigned int i = 0; i < numMatrices; i++)
-		{
-
-			matrices[i] = aimMatrix * matrices[i];
-
-		}
+		MaxformCore::multiplyBatch(Maxformations::toCoreMatrix(aimMatrix), batch);
+		Maxformations::fromCoreMatrices(batch, matrices);
 
 		return MS::kSuccess;
 
@@ -906,20 +1108,37 @@ namespace Maxformations
 	@param matrices: The transform matrices to extract from.
 	@return: The position values.
 	*/
+	{
+
+		MVectorArray positions;
+		Maxformations::matrixToPosition(matrices, positions);
+
+		return positions;
+
+	};
+
+	void matrixToPosition(const MMatrixArray& matrices, MVectorArray& positions)
+	/**
+	Extracts the position components from the supplied transform matrices.
+	Only the translation row is copied so there's no need to go through a core batch, the passed array is reused between calls!
+
+	@param matrices: The transform matrices to extract from.
+	@param positions: The passed array to populate with the position values.
+	@return: Void.
+	*/
 	{
 
 		unsigned int matrixCount = matrices.length();
-		MVectorArray positions = MVectorArray(matrixCount);
+		positions.setLength(matrixCount);
 
 		for (unsigned int i = 0; i < matrixCount; i++)
 		{
 
-			positions[i] = Maxformations::matrixToPosition(matrices[i]);
+			const MMatrix& matrix = matrices[i];
+			positions[i] = MVector(matrix(3, 0), matrix(3, 1), matrix(3, 2));
 
 		}
 
-		return positions;
-
 	};
 
 	MDistance distanceBetween(const MMatrix& startMatrix, const MMatrix& endMatrix)
@@ -1432,31 +1651,31 @@ namespace Maxformations
 		{
 
 		case AxisOrder::xyz:
-			return matrixToEulerXYZ(matrix);
+			return Maxformations::matrixToEulerAngles<AxisOrder::xyz>(matrix);
 
 		case AxisOrder::xzy:
-			return matrixToEulerXZY(matrix);
+			return Maxformations::matrixToEulerAngles<AxisOrder::xzy>(matrix);
 
 		case AxisOrder::yzx:
-			return matrixToEulerYZX(matrix);
+			return Maxformations::matrixToEulerAngles<AxisOrder::yzx>(matrix);
 
 		case AxisOrder::yxz:
-			return matrixToEulerYXZ(matrix);
+			return Maxformations::matrixToEulerAngles<AxisOrder::yxz>(matrix);
 
 		case AxisOrder::zxy:
-			return matrixToEulerZXY(matrix);
+			return Maxformations::matrixToEulerAngles<AxisOrder::zxy>(matrix);
 
 		case AxisOrder::zyx:
-			return matrixToEulerZYX(matrix);
+			return Maxformations::matrixToEulerAngles<AxisOrder::zyx>(matrix);
 
 		case AxisOrder::xyx:
-			return matrixToEulerXYX(matrix);
+			return Maxformations::matrixToEulerAngles<AxisOrder::xyx>(matrix);
 
 		case AxisOrder::yzy:
-			return matrixToEulerYZY(matrix);
+			return Maxformations::matrixToEulerAngles<AxisOrder::yzy>(matrix);
 
 		case AxisOrder::zxz:
-			return matrixToEulerZXZ(matrix);
+			return Maxformations::matrixToEulerAngles<AxisOrder::zxz>(matrix);
 
 		default:
 			return matrixToEulerXYZ(matrix);
@@ -1465,6 +1684,54 @@ namespace Maxformations
 
 	};
 
+	MVectorArray matrixToEulerAngles(const MMatrixArray& matrices, const AxisOrder axisOrder)
+	/**
+	Converts the supplied transform matrices into euler angles using the specified axis order.
+	The axis order is only dispatched once so every matrix runs through the same specialized kernel!
+
+	@param matrices: The matrices to convert.
+	@param axis: The axis order for the euler angles.
+	@return: The angles in radians.
+	*/
+	{
+
+		switch (axisOrder)
+		{
+
+		case AxisOrder::xyz:
+			return Maxformations::matrixToEulerAngles<AxisOrder::xyz>(matrices);
+
+		case AxisOrder::xzy:
+			return Maxformations::matrixToEulerAngles<AxisOrder::xzy>(matrices);
+
+		case AxisOrder::yzx:
+			return Maxformations::matrixToEulerAngles<AxisOrder::yzx>(matrices);
+
+		case AxisOrder::yxz:
+			return Maxformations::matrixToEulerAngles<AxisOrder::yxz>(matrices);
+
+		case AxisOrder::zxy:
+			return Maxformations::matrixToEulerAngles<AxisOrder::zxy>(matrices);
+
+		case AxisOrder::zyx:
+			return Maxformations::matrixToEulerAngles<AxisOrder::zyx>(matrices);
+
+		case AxisOrder::xyx:
+			return Maxformations::matrixToEulerAngles<AxisOrder::xyx>(matrices);
+
+		case AxisOrder::yzy:
+			return Maxformations::matrixToEulerAngles<AxisOrder::yzy>(matrices);
+
+		case AxisOrder::zxz:
+			return Maxformations::matrixToEulerAngles<AxisOrder::zxz>(matrices);
+
+		default:
+			return Maxformations::matrixToEulerAngles<AxisOrder::xyz>(matrices);
+
+		}
+
+	};
+
 	MEulerRotation matrixToEulerRotation(const MMatrix& matrix, const AxisOrder axisOrder)
 	/**
 	Converts the supplied transform matrix into an euler rotation using the specified axis order.
@@ -1522,7 +1789,40 @@ namespace Maxformations
 	*/
 	{
 
-		return matrixToQuaternion(createRotationMatrix(radians, axisOrder));
+		switch (axisOrder)
+		{
+
+		case AxisOrder::xyz:
+			return Maxformations::eulerAnglesToQuaternion<AxisOrder::xyz>(radians);
+
+		case AxisOrder::xzy:
+			return Maxformations::eulerAnglesToQuaternion<AxisOrder::xzy>(radians);
+
+		case AxisOrder::yzx:
+			return Maxformations::eulerAnglesToQuaternion<AxisOrder::yzx>(radians);
+
+		case AxisOrder::yxz:
+			return Maxformations::eulerAnglesToQuaternion<AxisOrder::yxz>(radians);
+
+		case AxisOrder::zxy:
+			return Maxformations::eulerAnglesToQuaternion<AxisOrder::zxy>(radians);
+
+		case AxisOrder::zyx:
+			return Maxformations::eulerAnglesToQuaternion<AxisOrder::zyx>(radians);
+
+		case AxisOrder::xyx:
+			return Maxformations::eulerAnglesToQuaternion<AxisOrder::xyx>(radians);
+
+		case AxisOrder::yzy:
+			return Maxformations::eulerAnglesToQuaternion<AxisOrder::yzy>(radians);
+
+		case AxisOrder::zxz:
+			return Maxformations::eulerAnglesToQuaternion<AxisOrder::zxz>(radians);
+
+		default:
+			return MQuaternion(MQuaternion::identity);
+
+		}
 
 	};
 
@@ -1556,27 +1856,106 @@ namespace Maxformations
 
 	};
 
-	MQuaternion slerp(const MQuaternion& startQuat, const MQuaternion& endQuat, const float weight)
+	SlerpPrecision slerpPrecision = SlerpPrecision::Exact;
+
+	SlerpPrecision getSlerpPrecision()
 	/**
-	Spherical interpolates two quaternions.
-	See the following for details: https://www.euclideanspace.com/maths/algebra/realNormedAlgebra/quaternions/slerp/index.htm
+	Returns the global precision used by slerp when none is specified.
+	Nodes with a `slerpPrecision` attribute ignore this since their attribute defaults are always exact!
 
-	@param startQuat: Start Quaternion.
-	@param endQuat: End Quaternion.
-	@param weight: The amount to interpolate.
-	@return: The interpolated quaternion.
+	@return: The slerp precision.
 	*/
 	{
 
-		bool isZero = Maxformations::isClose(0.0f, weight, Maxformations::TOLERANCE);
-		bool isOne = Maxformations::isClose(weight, 1.0f, Maxformations::TOLERANCE);
+		return slerpPrecision;
 
-		if (isZero || isOne)
-		{
+	};
 
-			return isZero ? startQuat : endQuat;
+	void setSlerpPrecision(const SlerpPrecision precision)
+	/**
+	Updates the global precision used by slerp when none is specified.
 
-		}
+	@param precision: The slerp precision.
+	@return: Void.
+	*/
+	{
+
+		slerpPrecision = precision;
+
+	};
+
+	MQuaternion slerp(const MQuaternion& startQuat, const MQuaternion& endQuat, const float weight)
+	/**
+	Spherical interpolates two quaternions using the global slerp precision.
+
+	@param startQuat: Start Quaternion.
+	@param endQuat: End Quaternion.
+	@param weight: The amount to interpolate.
+	@return: The interpolated quaternion.
+	*/
+	{
+
+		return Maxformations::slerp(startQuat, endQuat, weight, slerpPrecision);
+
+	};
+
+	MQuaternion slerp(const MQuaternion& startQuat, const MQuaternion& endQuat, const float weight, const SlerpPrecision precision)
+	/**
+	Spherical interpolates two quaternions using the specified precision.
+	See `MaxformCore::slerp` for the maximum angular error of each precision.
+
+	@param startQuat: Start Quaternion.
+	@param endQuat: End Quaternion.
+	@param weight: The amount to interpolate.
+	@param precision: The precision to interpolate with.
+	@return: The interpolated quaternion.
+	*/
+	{
+
+		MaxformCore::Quaternion quat = MaxformCore::slerp(Maxformations::toCoreQuaternion(startQuat), Maxformations::toCoreQuaternion(endQuat), weight, precision);
+		return Maxformations::fromCoreQuaternion(quat);
+
+	};
+
+	MQuaternion nlerp(const MQuaternion& startQuat, const MQuaternion& endQuat, const float weight)
+	/**
+	Normalized linear interpolates two quaternions.
+	Unlike slerp no trigonometry is required, the path is identical but the angular velocity is not constant.
+	The angular error peaks around 0.03 degrees for 30 degree arcs, 0.9 degrees for 90 degree arcs and 8.1 degrees for 180 degree arcs.
+	These bounds hold for any weight since negative and overshooting weights are mirrored back onto [0, 1] through the conjugate, each mirror reflects the arc about its nearest end!
+
+	@param startQuat: Start Quaternion.
+	@param endQuat: End Quaternion.
+	@param weight: The amount to interpolate.
+	@return: The interpolated quaternion.
+	*/
+	{
+
+		bool isZero = Maxformations::isClose(0.0f, weight, Maxformations::TOLERANCE);
+		bool isOne = Maxformations::isClose(weight, 1.0f, Maxformations::TOLERANCE);
+
+		if (isZero || isOne)
+		{
+
+			return isZero ? startQuat : endQuat;
+
+		}
+
+		// Mirror extrapolated weights back onto the arc
+		// Since `slerp(q1, q2, -t) == slerp(q1, q1 * q2^-1 * q1, t)` the endpoints stay exact rather than drifting with the normalization!
+		//
+		if (weight < 0.0f)
+		{
+
+			return Maxformations::nlerp(startQuat, startQuat * endQuat.conjugate() * startQuat, -weight);
+
+		}
+		else if (weight > 1.0f)
+		{
+
+			return Maxformations::nlerp(endQuat, endQuat * startQuat.conjugate() * endQuat, weight - 1.0f);
+
+		}
 
 		MQuaternion q1 = MQuaternion(startQuat);
 		MQuaternion q2 = MQuaternion(endQuat);
@@ -1586,34 +1965,49 @@ namespace Maxformations
 		if (dot < 0.0)
 		{
 
-			dot = Maxformations::dot(q1, q2.negateIt());
+			q2.negateIt();
 
 		}
 
-		double theta = acos(dot);
-		double sinTheta = sin(theta);
+		q1.scaleIt(1.0 - weight);
+		q2.scaleIt(weight);
 
-		double w1, w2;
+		return (q1 + q2).normalizeIt();
 
-		if (sinTheta > 1e-3)
-		{
+	};
 
-			w1 = sin((1.0 - weight) * theta) / sinTheta;
-			w2 = sin(weight * theta) / sinTheta;
+	MQuaternion averageQuaternions(const MMatrixArray& matrices, const MFloatArray& weights)
+	/**
+	Returns the weighted average rotation of the supplied matrices using Markley's eigenvector method.
+	The rotations are accumulated into a symmetric 4x4 matrix whose dominant eigenvector, found through power iteration, is the average.
+	Unlike chained slerps the result is independent of the order of the matrices and is unaffected by quaternion signs!
 
-		}
-		else
+	@param matrices: The matrices to average.
+	@param weights: The weight of each matrix.
+	@return: The average rotation.
+	*/
+	{
+
+		// Collect weighted rotations
+		// Non-positive weights are skipped by the core kernel so there's no need to filter them here!
+		//
+		unsigned int matrixCount = std::min(matrices.length(), weights.length());
+
+		thread_local MaxformCore::QuaternionBatch quats;
+		thread_local std::vector<double> quatWeights;
+
+		quats.resize(matrixCount);
+		quatWeights.resize(matrixCount);
+
+		for (unsigned int i = 0; i < matrixCount; i++)
 		{
 
-			w1 = 1.0 - weight;
-			w2 = weight;
+			quatWeights[i] = weights[i];
+			quats[i] = (weights[i] > 0.0f) ? Maxformations::toCoreQuaternion(Maxformations::matrixToQuaternion(matrices[i])) : MaxformCore::Quaternion{ 0.0, 0.0, 0.0, 1.0 };
 
 		}
 
-		q1.scaleIt(w1);
-		q2.scaleIt(w2);
-
-		return q1 + q2;
+		return Maxformations::fromCoreQuaternion(MaxformCore::averageQuaternions(quats, quatWeights));
 
 	};
 
@@ -1845,12 +2239,28 @@ namespace Maxformations
 
 	MMatrix blendMatrices(const MMatrix& startMatrix, const MMatrix& endMatrix, const float weight)
 	/**
+	Interpolates the two given matrices using the supplied weight and the global slerp precision.
+
+	@param startMatrix: The start matrix.
+	@param endMatrix: The end matrix.
+	@param weight: The amount to blend.
+	@return: The interpolated matrix.
+	*/
+	{
+
+		return Maxformations::blendMatrices(startMatrix, endMatrix, weight, slerpPrecision);
+
+	};
+
+	MMatrix blendMatrices(const MMatrix& startMatrix, const MMatrix& endMatrix, const float weight, const SlerpPrecision precision)
+	/**
 	Interpolates the two given matrices using the supplied weight.
 	Both translate and scale will be lerp'd while rotation will be slerp'd.
 
 	@param startMatrix: The start matrix.
 	@param endMatrix: The end matrix.
 	@param weight: The amount to blend.
+	@param precision: The slerp precision to blend rotations with.
 	@return: The interpolated matrix.
 	*/
 	{
@@ -1896,7 +2306,7 @@ namespace Maxformations
 			// Interpolate translation
 			//
 			MPoint translation = Maxformations::lerp(startPosition, endPosition, weight);
-			MQuaternion quat = Maxformations::slerp(startRotation, endRotation, weight);
+			MQuaternion quat = Maxformations::slerp(startRotation, endRotation, weight, precision);
 			MVector scale = Maxformations::lerp(startScale, endScale, weight);
 
 			// Compose interpolated matrix
@@ -1913,12 +2323,28 @@ namespace Maxformations
 
 	MMatrix blendMatrices(const MMatrix& restMatrix, const MMatrixArray& matrices, const MFloatArray& weights)
 	/**
+	Interpolates the supplied matrices using the weight array and the global slerp precision.
+
+	@param restMatrix: The default matrix to blend from in case the weights don't equal 100.
+	@param matrices: The matrix array to blend.
+	@param weights: The float array containing the weighted averages.
+	@return: The interpolated matrix.
+	*/
+	{
+
+		return Maxformations::blendMatrices(restMatrix, matrices, weights, slerpPrecision);
+
+	};
+
+	MMatrix blendMatrices(const MMatrix& restMatrix, const MMatrixArray& matrices, const MFloatArray& weights, const SlerpPrecision precision)
+	/**
 	Interpolates the supplied matrices using the weight array as a blend aplha.
 	The rest matrix is used just in case the weights don't equal 100.
 
 	@param restMatrix: The default matrix to blend from in case the weights don't equal 100.
 	@param matrices: The matrix array to blend.
 	@param weights: The float array containing the weighted averages.
+	@param precision: The slerp precision to blend rotations with.
 	@return: The interpolated matrix.
 	*/
 	{
@@ -1996,7 +2422,7 @@ namespace Maxformations
 					for (unsigned int i = (startIndex + 1); i < matrixCount; i++)
 					{
 
-						matrix = Maxformations::blendMatrices(matrix, matrices[i], normalizedWeights[i]);
+						matrix = Maxformations::blendMatrices(matrix, matrices[i], normalizedWeights[i], precision);
 
 					}
 
@@ -2020,6 +2446,168 @@ namespace Maxformations
 
 	};
 
+	MMatrix blendMatrices(const MMatrix& restMatrix, const MMatrixArray& matrices, const MFloatArray& weights, const BlendMode mode)
+	/**
+	Interpolates the supplied matrices using the weight array, the specified blend mode and the global slerp precision.
+
+	@param restMatrix: The default matrix to blend from in case the weights don't equal 100.
+	@param matrices: The matrix array to blend.
+	@param weights: The float array containing the weighted averages.
+	@param mode: The method to blend the matrices with.
+	@return: The interpolated matrix.
+	*/
+	{
+
+		return Maxformations::blendMatrices(restMatrix, matrices, weights, mode, slerpPrecision);
+
+	};
+
+	MMatrix blendMatrices(const MMatrix& restMatrix, const MMatrixArray& matrices, const MFloatArray& weights, const BlendMode mode, const SlerpPrecision precision)
+	/**
+	Interpolates the supplied matrices using the weight array and the specified blend mode.
+	The slerp precision is ignored by dual quaternion blending since it requires no trigonometry!
+
+	@param restMatrix: The default matrix to blend from in case the weights don't equal 100.
+	@param matrices: The matrix array to blend.
+	@param weights: The float array containing the weighted averages.
+	@param mode: The method to blend the matrices with.
+	@param precision: The slerp precision to blend rotations with.
+	@return: The interpolated matrix.
+	*/
+	{
+
+		switch (mode)
+		{
+
+			case BlendMode::DualQuaternion:
+				return Maxformations::blendDualQuaternions(restMatrix, matrices, weights);
+
+			default:
+				return Maxformations::blendMatrices(restMatrix, matrices, weights, precision);
+
+		}
+
+	};
+
+	MMatrix blendDualQuaternions(const MMatrix& restMatrix, const MMatrixArray& matrices, const MFloatArray& weights)
+	/**
+	Interpolates the supplied matrices using dual quaternion linear blending, see `MaxformCore::blendDualQuaternions` for details.
+	This avoids any trigonometry or matrix rebuilds per pair of matrices while scale is still lerp'd separately!
+
+	@param restMatrix: The default matrix in case none of the weights contribute.
+	@param matrices: The matrix array to blend.
+	@param weights: The float array containing the weighted averages.
+	@return: The interpolated matrix.
+	*/
+	{
+
+		// Check if any weights contribute
+		//
+		MIntArray indices = Maxformations::nonZeroes(weights);
+		unsigned int indexCount = indices.length();
+
+		if (indexCount == 0)
+		{
+
+			return MMatrix(restMatrix);
+
+		}
+
+		// Collect weighted rigid transforms
+		// Scale is lerp'd separately since dual quaternions can only represent rigid transforms!
+		//
+		MFloatArray normalizedWeights = Maxformations::normalize(weights);
+
+		thread_local MaxformCore::QuaternionBatch rotations;
+		thread_local std::vector<MaxformCore::Vector3> positions;
+		thread_local std::vector<double> transformWeights;
+
+		rotations.resize(indexCount);
+		positions.resize(indexCount);
+		transformWeights.resize(indexCount);
+
+		MVector scale = MVector(MVector::zero);
+
+		MPoint position;
+		MQuaternion rotation;
+		MVector matrixScale;
+
+		unsigned int index;
+
+		for (unsigned int i = 0; i < indexCount; i++)
+		{
+
+			index = indices[i];
+
+			Maxformations::decomposeMatrix(matrices[index], position, rotation, matrixScale);
+
+			rotations[i] = Maxformations::toCoreQuaternion(rotation);
+			positions[i] = MaxformCore::Vector3{ position.x, position.y, position.z };
+			transformWeights[i] = normalizedWeights[index];
+
+			scale += (matrixScale * std::fabs(transformWeights[i]));
+
+		}
+
+		// Blend dual quaternions
+		//
+		MaxformCore::Quaternion blendedRotation;
+		MaxformCore::Vector3 blendedPosition;
+
+		bool isBlended = MaxformCore::blendDualQuaternions(rotations, positions, transformWeights, blendedRotation, blendedPosition);
+
+		if (!isBlended)
+		{
+
+			return MMatrix(restMatrix);
+
+		}
+
+		MQuaternion quat = Maxformations::fromCoreQuaternion(blendedRotation);
+		MPoint translation = MPoint(blendedPosition.x, blendedPosition.y, blendedPosition.z);
+
+		// Compose blended matrix
+		//
+		MMatrix translateMatrix = Maxformations::createPositionMatrix(translation);
+		MMatrix rotateMatrix = quat.asMatrix();
+		MMatrix scaleMatrix = Maxformations::createScaleMatrix(scale);
+
+		return scaleMatrix * rotateMatrix * translateMatrix;
+
+	};
+
+	MMatrix averageMatrices(const MMatrix& restMatrix, const MMatrixArray& matrices, const MFloatArray& weights)
+	/**
+	Averages the rotations of the supplied matrices using the weight array, see `averageQuaternions` for details.
+	Only the rotation is preserved so this is intended for orientation blends with many targets.
+	The rest matrix is returned if none of the weights contribute.
+
+	@param restMatrix: The default matrix in case none of the weights contribute.
+	@param matrices: The matrix array to average.
+	@param weights: The float array containing the weighted averages.
+	@return: The averaged rotation matrix.
+	*/
+	{
+
+		// Check if any weights contribute
+		//
+		MIntArray indices = Maxformations::nonZeroes(weights);
+
+		if (indices.length() == 0)
+		{
+
+			return MMatrix(restMatrix);
+
+		}
+
+		// Average weighted rotations
+		//
+		MQuaternion quat = Maxformations::averageQuaternions(matrices, weights);
+
+		return quat.asMatrix();
+
+	};
+
 	MObject createMatrixData(const MMatrix& matrix)
 	/**
 	Returns a matrix data object from the supplied matrix.
@@ -2158,6 +2746,48 @@ namespace Maxformations
 
 	};
 
+	MStatus setMatrixData(MDataHandle& handle, const MTransformationMatrix& transform)
+	/**
+	Updates the matrix data on the supplied data handle.
+	The existing data object is modified in place whenever possible to avoid reallocating it.
+
+	@param handle: The data handle to update.
+	@param transform: The transformation matrix to assign.
+	@return: Status code.
+	*/
+	{
+
+		MStatus status;
+
+		// Check if existing data can be reused
+		//
+		MObject matrixData = handle.data();
+		bool isMatrixData = matrixData.hasFn(MFn::kMatrixData);
+
+		if (isMatrixData)
+		{
+
+			MFnMatrixData fnMatrixData(matrixData, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			status = fnMatrixData.set(transform);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		}
+		else
+		{
+
+			matrixData = Maxformations::createMatrixData(transform);
+
+			status = handle.setMObject(matrixData);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		}
+
+		return status;
+
+	};
+
 	MStatus resetMatrixPlug(MPlug& plug)
 	/**
 	Resets the matrix value on the supplied plug.
@@ -2419,51 +3049,232 @@ namespace Maxformations
 
 	};
 
-	MStatus disconnectPlugs(const MPlug& plug, const MPlug& otherPlug)
+	BatchModifier::BatchModifier()
 	/**
-	Disconnects the two supplied plugs.
+	Constructor.
+	*/
+	{
 
-	@param plug: The source plug.
-	@param otherPlug: The destination plug.
-	@return: Status code.
+		this->editCount = 0;
+
+	};
+
+	BatchModifier::~BatchModifier()
+	/**
+	Destructor.
 	*/
 	{
+	};
 
-		MStatus status;
+	MPlug BatchModifier::source(const MPlug& plug, MStatus* status)
+	/**
+	Returns the source plug connected to the supplied plug.
+	Any queued connections take precedence over the live graph!
 
-		// Check for null plugs
+	@param plug: The destination plug.
+	@param status: Return status.
+	@return: The source plug.
+	*/
+	{
+
+		// Check if any connections are pending on this plug
 		//
-		bool isNull = plug.isNull(&status) || otherPlug.isNull(&status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		size_t numConnections = this->connections.size();
 
-		if (isNull)
+		for (size_t i = numConnections; i > 0; i--)
 		{
 
-			return MS::kFailure;
+			const Connection& connection = this->connections[i - 1];
 
-		}
+			if (connection.destination == plug)
+			{
 
-		// Setup dag modifier
-		//
-		MDGModifier modifier;
+				*status = MS::kSuccess;
+				return connection.connected ? connection.source : MPlug();
 
-		status = modifier.disconnect(plug, otherPlug);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			}
 
-		// Execute modifier
-		//
-		status = modifier.doIt();
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		}
 
-		return status;
+		// Fallback on the live graph
+		//
+		return plug.source(status);
 
 	};
 
-	MStatus breakConnections(const MPlug& plug, bool asDst, bool asSrc)
+	MStatus BatchModifier::connect(const MPlug& source, const MPlug& destination)
 	/**
-	Breaks the connections to the supplied plug.
+	Queues a connection between the two supplied plugs.
+	Plugs that are already connected are skipped.
 
-	@param plug: The plug to break connections on.
+	@param source: The source plug.
+	@param destination: The destination plug.
+	@return: Status code.
+	*/
+	{
+
+		MStatus status;
+
+		// Redundancy check
+		//
+		MPlug otherPlug = this->source(destination, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		if (otherPlug == source)
+		{
+
+			return MS::kSuccess;  // Nothing to do here~!
+
+		}
+
+		// Queue connection
+		//
+		status = this->modifier.connect(source, destination);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		this->connections.push_back({ source, destination, true });
+		this->editCount++;
+
+		return status;
+
+	};
+
+	MStatus BatchModifier::disconnect(const MPlug& source, const MPlug& destination)
+	/**
+	Queues a disconnection between the two supplied plugs.
+	Plugs that are not connected are skipped.
+
+	@param source: The source plug.
+	@param destination: The destination plug.
+	@return: Status code.
+	*/
+	{
+
+		MStatus status;
+
+		// Redundancy check
+		//
+		MPlug otherPlug = this->source(destination, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		bool isNull = otherPlug.isNull(&status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		if (isNull || otherPlug != source)
+		{
+
+			return MS::kSuccess;  // Nothing to do here~!
+
+		}
+
+		// Queue disconnection
+		//
+		status = this->modifier.disconnect(source, destination);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		this->connections.push_back({ MPlug(), destination, false });
+		this->editCount++;
+
+		return status;
+
+	};
+
+	MStatus BatchModifier::newPlugValue(const MPlug& plug, const MPlug& otherPlug)
+	/**
+	Queues a value change on the other plug using the value from the supplied plug.
+
+	@param plug: Plug to take the value from.
+	@param otherPlug: Plug to pass the value to.
+	@return: Status code.
+	*/
+	{
+
+		MStatus status;
+
+		// Check if these are compound plugs
+		//
+		bool isCompound = plug.isCompound(&status) && otherPlug.isCompound(&status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		if (isCompound)
+		{
+
+			// Iterate through children
+			//
+			unsigned int numChildren = plug.numChildren(&status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			for (unsigned int i = 0; i < numChildren; i++)
+			{
+
+				status = this->newPlugValue(plug.child(i), otherPlug.child(i));
+				CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			}
+
+			return status;
+
+		}
+
+		// Evaluate attribute type
+		// Numeric, unit and enum attributes are all stored in internal units so doubles are safe here!
+		//
+		MObject attribute = otherPlug.attribute(&status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		bool isNumeric = attribute.hasFn(MFn::kNumericAttribute) || attribute.hasFn(MFn::kUnitAttribute) || attribute.hasFn(MFn::kEnumAttribute);
+
+		if (isNumeric)
+		{
+
+			double value = plug.asDouble(&status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			status = this->modifier.newPlugValueDouble(otherPlug, value);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		}
+		else
+		{
+
+			MObject value = plug.asMObject(&status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			status = this->modifier.newPlugValue(otherPlug, value);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		}
+
+		this->editCount++;
+
+		return status;
+
+	};
+
+	MStatus BatchModifier::newPlugValue(const MPlug& plug, const MObject& data)
+	/**
+	Queues a value change on the supplied plug using the supplied data object.
+
+	@param plug: Plug to pass the value to.
+	@param data: The data object to assign.
+	@return: Status code.
+	*/
+	{
+
+		MStatus status = this->modifier.newPlugValue(plug, data);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		this->editCount++;
+
+		return status;
+
+	};
+
+	MStatus BatchModifier::breakConnections(const MPlug& plug, bool asDst, bool asSrc)
+	/**
+	Queues the removal of any connections to the supplied plug.
+
+	@param plug: The plug to break connections on.
 	@param source: Break input connections.
 	@param destination: Break output connections.
 	@return: Status code.
@@ -2511,7 +3322,7 @@ namespace Maxformations
 				element = plug.elementByPhysicalIndex(i, &status);
 				CHECK_MSTATUS_AND_RETURN_IT(status);
 
-				status = breakConnections(element, asDst, asSrc);
+				status = this->breakConnections(element, asDst, asSrc);
 				CHECK_MSTATUS_AND_RETURN_IT(status);
 
 			}
@@ -2533,7 +3344,7 @@ namespace Maxformations
 				child = plug.child(i, &status);
 				CHECK_MSTATUS_AND_RETURN_IT(status);
 
-				status = breakConnections(child, asDst, asSrc);
+				status = this->breakConnections(child, asDst, asSrc);
 				CHECK_MSTATUS_AND_RETURN_IT(status);
 
 			}
@@ -2544,37 +3355,44 @@ namespace Maxformations
 
 			// Check if incoming plugs should be broken
 			//
-			bool isConnected = plug.isConnected(&status);
-			CHECK_MSTATUS_AND_RETURN_IT(status);
-
-			if (asDst && isConnected)
+			if (asDst)
 			{
 
-				MPlug otherPlug = plug.source(&status);
+				MPlug otherPlug = this->source(plug, &status);
 				CHECK_MSTATUS_AND_RETURN_IT(status);
 
-				disconnectPlugs(otherPlug, plug);
+				status = this->disconnect(otherPlug, plug);
 				CHECK_MSTATUS_AND_RETURN_IT(status);
 
 			}
 
 			// Check if outgoing plugs should be broken
 			//
-			MPlugArray otherPlugs = MPlugArray();
-			bool hasConnections = plug.destinations(otherPlugs, &status);
-
-			if (asSrc && hasConnections)
+			if (asSrc)
 			{
 
+				MPlugArray otherPlugs = MPlugArray();
+				plug.destinations(otherPlugs, &status);
+				CHECK_MSTATUS_AND_RETURN_IT(status);
+
+				for (const Connection& connection : this->connections)
+				{
+
+					if (connection.connected && connection.source == plug)
+					{
+
+						otherPlugs.append(connection.destination);
+
+					}
+
+				}
+
 				unsigned int numDestinations = otherPlugs.length();
-				MPlug otherPlug;
 
 				for (unsigned int i = 0; i < numDestinations; i++)
 				{
 
-					otherPlug = otherPlugs[i];
-
-					disconnectPlugs(plug, otherPlug);
+					status = this->disconnect(plug, otherPlugs[i]);
 					CHECK_MSTATUS_AND_RETURN_IT(status);
 
 				}
@@ -2587,9 +3405,9 @@ namespace Maxformations
 
 	};
 
-	MStatus connectPlugs(const MPlug& plug, const MPlug& otherPlug, const bool force)
+	MStatus BatchModifier::connectPlugs(const MPlug& plug, const MPlug& otherPlug, const bool force)
 	/**
-	Connects the two supplied plugs.
+	Queues a connection between the two supplied plugs.
 	Using force will break any pre-existing connections.
 
 	@param plug: The source plug.
@@ -2613,19 +3431,6 @@ namespace Maxformations
 
 		}
 
-		// Check if destination already has connections
-		//
-		bool isConnected = otherPlug.isConnected(&status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
-
-		if (isConnected && force)
-		{
-
-			status = breakConnections(otherPlug, true, false);
-			CHECK_MSTATUS_AND_RETURN_IT(status);
-
-		}
-
 		// Check if these are compound plugs
 		//
 		bool isCompound = plug.isCompound(&status) && otherPlug.isCompound(&status);
@@ -2642,7 +3447,7 @@ namespace Maxformations
 			for (unsigned int i = 0; i < numChildren; i++)
 			{
 
-				status = connectPlugs(plug.child(i), otherPlug.child(i), force);
+				status = this->connectPlugs(plug.child(i), otherPlug.child(i), force);
 				CHECK_MSTATUS_AND_RETURN_IT(status);
 
 			}
@@ -2651,16 +3456,20 @@ namespace Maxformations
 		else
 		{
 
-			// Setup dag modifier
+			// Check if destination already has a connection
 			//
-			MDGModifier modifier;
-
-			status = modifier.connect(plug, otherPlug);
+			MPlug source = this->source(otherPlug, &status);
 			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-			// Execute modifier
-			//
-			status = modifier.doIt();
+			if (source != plug && force)
+			{
+
+				status = this->breakConnections(otherPlug, true, false);
+				CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			}
+
+			status = this->connect(plug, otherPlug);
 			CHECK_MSTATUS_AND_RETURN_IT(status);
 
 		}
@@ -2669,9 +3478,9 @@ namespace Maxformations
 
 	};
 
-	MStatus transferConnections(const MPlug& plug, const MPlug& otherPlug)
+	MStatus BatchModifier::transferConnections(const MPlug& plug, const MPlug& otherPlug)
 	/**
-	Transfers the connections from one plug to another.
+	Queues the transfer of any connections from one plug to another.
 
 	@param plug: Plug to take connections from.
 	@param otherPlug: Plug to pass connections to.
@@ -2721,7 +3530,7 @@ namespace Maxformations
 			for (unsigned int i = 0; i < numChildren; i++)
 			{
 
-				status = transferConnections(plug.child(i), otherPlug.child(i));
+				status = this->transferConnections(plug.child(i), otherPlug.child(i));
 				CHECK_MSTATUS_AND_RETURN_IT(status);
 
 			}
@@ -2732,7 +3541,7 @@ namespace Maxformations
 
 			// Disconnect plug from source
 			//
-			MPlug source = plug.source(&status);
+			MPlug source = this->source(plug, &status);
 			CHECK_MSTATUS_AND_RETURN_IT(status);
 
 			isNull = source.isNull(&status);
@@ -2741,7 +3550,7 @@ namespace Maxformations
 			if (!isNull)
 			{
 
-				status = disconnectPlugs(source, plug);
+				status = this->disconnect(source, plug);
 				CHECK_MSTATUS_AND_RETURN_IT(status);
 
 			}
@@ -2751,7 +3560,7 @@ namespace Maxformations
 			if (source != otherPlug && !isNull)
 			{
 
-				status = connectPlugs(source, otherPlug, true);
+				status = this->connectPlugs(source, otherPlug, true);
 				CHECK_MSTATUS_AND_RETURN_IT(status);
 
 			}
@@ -2762,9 +3571,9 @@ namespace Maxformations
 
 	};
 
-	MStatus transferValues(MPlug& plug, MPlug& otherPlug)
+	MStatus BatchModifier::transferValues(const MPlug& plug, const MPlug& otherPlug)
 	/**
-	Transfers the values from one plug to another.
+	Queues the transfer of values from one plug to another.
 
 	@param plug: Plug to take values from.
 	@param otherPlug: Plug to pass values to.
@@ -2798,141 +3607,743 @@ namespace Maxformations
 
 		}
 
-		// Assign data handle to other plug
-		//
-		MDataHandle dataHandle = plug.asMDataHandle(&status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
-
-		status = otherPlug.setMDataHandle(dataHandle);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
-
-		plug.destructHandle(dataHandle);
-
-		return status;
+		return this->newPlugValue(plug, otherPlug);
 
 	};
 
-	MStatus getAttributesByCategory(const MTypeId& id, const MString category, MObjectArray& attributes)
+	unsigned int BatchModifier::numEdits() const
 	/**
-	Returns a list of attributes with the specified category from the associated type ID.
+	Returns the number of queued edits.
 
-	@param id: The type ID to search from.
-	@param category: The attribute category to filter.
-	@param attributes: The passed array to populate.
-	@return: Return status.
+	@return: Edit count.
 	*/
 	{
 
-		MStatus status;
+		return this->editCount;
 
-		// Iterate through attributes
-		//
-		MNodeClass nodeClass = MNodeClass(id);
-		unsigned int attributeCount = nodeClass.attributeCount();
+	};
 
-		status = attributes.clear();
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+	MStatus BatchModifier::doIt()
+	/**
+	Executes all of the queued edits at once.
 
-		MFnAttribute fnAttribute;
-		bool hasCategory;
+	@return: Status code.
+	*/
+	{
 
-		for (unsigned int i = 0; i < attributeCount; i++)
+		if (this->editCount == 0)
 		{
 
-			status = fnAttribute.setObject(nodeClass.attribute(i, &status));
-			CHECK_MSTATUS_AND_RETURN_IT(status);
+			return MS::kSuccess;  // Nothing to do here~!
 
-			hasCategory = fnAttribute.hasCategory(category);
+		}
 
-			if (hasCategory)
-			{
+		return this->modifier.doIt();
 
-				attributes.append(fnAttribute.object());
+	};
 
-			}
-			else
-			{
+	MStatus BatchModifier::undoIt()
+	/**
+	Reverts all of the executed edits.
 
-				continue;
+	@return: Status code.
+	*/
+	{
 
-			}
+		if (this->editCount == 0)
+		{
+
+			return MS::kSuccess;  // Nothing to do here~!
 
 		}
 
-		return status;
+		return this->modifier.undoIt();
 
 	};
 
-	bool hasClassification(const MObject& node, const MString& classification, MStatus* status)
+	ConstraintCache::ConstraintCache()
 	/**
-	Evaluates if the supplied node has the specified classification.
-
-	@param node: The node to evaluate.
-	@param classification: The classification to test against.
-	@param status: Return status.
-	@return: Has classification.
+	Default constructor.
 	*/
 	{
 
-		MFnDependencyNode fnNode(node, status);
-		CHECK_MSTATUS_AND_RETURN(*status, false);
-
-		MString typeName = fnNode.typeName(status);
-		CHECK_MSTATUS_AND_RETURN(*status, false);
-
-		MString nodeClassification = MFnDependencyNode::classification(typeName);
-		
-		return classification == nodeClassification;
+		this->matrix = MMatrix::identity;
+		this->worldMatrix = MMatrix::identity;
+		this->isValid = false;
 
 	};
 
-	bool hasTypeId(const MObject& node, const MTypeId& typeId, MStatus* status)
+	ConstraintCache::~ConstraintCache() {};
+
+	bool ConstraintCache::get(const MDGContext& context, MMatrix& matrix, MMatrix& worldMatrix) const
 	/**
-	Evaluates if the supplied node has the specified type ID.
+	Copies the cached matrices into the supplied references.
+	Returns false if the cache is stale or the context is not normal, in which case the references are left untouched!
 
-	@param node: The node to evaluate.
-	@param classification: The type ID to test against.
-	@param status: Return status.
-	@return: Has type ID.
+	@param context: The current evaluation context.
+	@param matrix: The passed matrix to populate.
+	@param worldMatrix: The passed world matrix to populate.
+	@return: Cache state.
 	*/
 	{
 
-		MFnDependencyNode fnNode(node, status);
-		CHECK_MSTATUS_AND_RETURN(*status, false);
+		if (!context.isNormal())
+		{
 
-		MTypeId nodeTypeId = fnNode.typeId(status);
-		CHECK_MSTATUS_AND_RETURN(*status, false);
+			return false;
 
-		return typeId == nodeTypeId;
+		}
+
+		std::lock_guard<std::mutex> lock(this->mutex);
+
+		if (!this->isValid)
+		{
+
+			return false;
+
+		}
+
+		matrix = this->matrix;
+		worldMatrix = this->worldMatrix;
+
+		return true;
 
 	};
 
-	bool isSceneLoading()
+	void ConstraintCache::set(const MDGContext& context, const MMatrix& matrix, const MMatrix& worldMatrix)
 	/**
-	Evaluates if a scene file is being loaded.
+	Updates the cached matrices.
+	Any evaluations from a non-normal context are ignored so timed evaluations cannot overwrite the current state!
 
-	@return: Is loading.
+	@param context: The current evaluation context.
+	@param matrix: The constraint matrix.
+	@param worldMatrix: The constraint world matrix.
+	@return: void
 	*/
 	{
-		
-		return MFileIO::isNewingFile() || MFileIO::isOpeningFile() || MFileIO::isImportingFile() || MFileIO::isReferencingFile();
+
+		if (!context.isNormal())
+		{
+
+			return;
+
+		}
+
+		std::lock_guard<std::mutex> lock(this->mutex);
+
+		this->matrix = matrix;
+		this->worldMatrix = worldMatrix;
+		this->isValid = true;
+
+	};
+
+	void ConstraintCache::invalidate()
+	/**
+	Marks the cached matrices as stale.
+
+	@return: void
+	*/
+	{
+
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->isValid = false;
+
+	};
+
+	MStatus disconnectPlugs(const MPlug& plug, const MPlug& otherPlug)
+	/**
+	Disconnects the two supplied plugs.
+
+	@param plug: The source plug.
+	@param otherPlug: The destination plug.
+	@return: Status code.
+	*/
+	{
+
+		MStatus status;
+
+		// Check for null plugs
+		//
+		bool isNull = plug.isNull(&status) || otherPlug.isNull(&status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		if (isNull)
+		{
+
+			return MS::kFailure;
+
+		}
+
+		// Setup batch modifier
+		//
+		BatchModifier modifier;
+
+		status = modifier.disconnect(plug, otherPlug);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		// Execute modifier
+		//
+		status = modifier.doIt();
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		return status;
+
+	};
+
+	MStatus breakConnections(const MPlug& plug, bool asDst, bool asSrc)
+	/**
+	Breaks the connections to the supplied plug.
+
+	@param plug: The plug to break connections on.
+	@param source: Break input connections.
+	@param destination: Break output connections.
+	@return: Status code.
+	*/
+	{
+
+		MStatus status;
+
+		// Setup batch modifier
+		//
+		BatchModifier modifier;
+
+		status = modifier.breakConnections(plug, asDst, asSrc);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		// Execute modifier
+		//
+		status = modifier.doIt();
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		return status;
+
+	};
+
+	MStatus connectPlugs(const MPlug& plug, const MPlug& otherPlug, const bool force)
+	/**
+	Connects the two supplied plugs.
+	Using force will break any pre-existing connections.
+
+	@param plug: The source plug.
+	@param otherPlug: The destination plug.
+	@param force: Breaks pre-existing connections.
+	@return: Status code.
+	*/
+	{
+
+		MStatus status;
+
+		// Setup batch modifier
+		//
+		BatchModifier modifier;
+
+		status = modifier.connectPlugs(plug, otherPlug, force);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		// Execute modifier
+		//
+		status = modifier.doIt();
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		return status;
+
+	};
+
+	MStatus transferConnections(const MPlug& plug, const MPlug& otherPlug)
+	/**
+	Transfers the connections from one plug to another.
+
+	@param plug: Plug to take connections from.
+	@param otherPlug: Plug to pass connections to.
+	@return: Status code.
+	*/
+	{
+
+		MStatus status;
+
+		// Setup batch modifier
+		//
+		BatchModifier modifier;
+
+		status = modifier.transferConnections(plug, otherPlug);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		// Execute modifier
+		//
+		status = modifier.doIt();
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		return status;
+
+	};
+
+	MStatus transferValues(MPlug& plug, MPlug& otherPlug)
+	/**
+	Transfers the values from one plug to another.
+
+	@param plug: Plug to take values from.
+	@param otherPlug: Plug to pass values to.
+	@return: Status code.
+	*/
+	{
+		
+		MStatus status;
+
+		// Check if either plugs are null
+		//
+		bool isNull = plug.isNull(&status) || otherPlug.isNull(&status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		if (isNull)
+		{
+
+			return MS::kFailure;
+
+		}
+
+		// Check if either plugs are locked
+		//
+		bool isLocked = isPartiallyLocked(plug, &status) || isPartiallyLocked(otherPlug, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		if (isLocked)
+		{
+
+			return MS::kSuccess;  // Nothing we can do from here!
+
+		}
+
+		// Assign data handle to other plug
+		//
+		MDataHandle dataHandle = plug.asMDataHandle(&status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = otherPlug.setMDataHandle(dataHandle);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		plug.destructHandle(dataHandle);
+
+		return status;
+
+	};
+
+	MStatus getAttributesByCategory(const MTypeId& id, const MString category, MObjectArray& attributes)
+	/**
+	Returns a list of attributes with the specified category from the associated type ID.
+
+	@param id: The type ID to search from.
+	@param category: The attribute category to filter.
+	@param attributes: The passed array to populate.
+	@return: Return status.
+	*/
+	{
+
+		MStatus status;
+
+		// Iterate through attributes
+		//
+		MNodeClass nodeClass = MNodeClass(id);
+		unsigned int attributeCount = nodeClass.attributeCount();
+
+		status = attributes.clear();
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		MFnAttribute fnAttribute;
+		bool hasCategory;
+
+		for (unsigned int i = 0; i < attributeCount; i++)
+		{
+
+			status = fnAttribute.setObject(nodeClass.attribute(i, &status));
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			hasCategory = fnAttribute.hasCategory(category);
+
+			if (hasCategory)
+			{
+
+				attributes.append(fnAttribute.object());
+
+			}
+			else
+			{
+
+				continue;
+
+			}
+
+		}
+
+		return status;
+
+	};
+
+	bool hasClassification(const MObject& node, const MString& classification, MStatus* status)
+	/**
+	Evaluates if the supplied node has the specified classification.
+
+	@param node: The node to evaluate.
+	@param classification: The classification to test against.
+	@param status: Return status.
+	@return: Has classification.
+	*/
+	{
+
+		MFnDependencyNode fnNode(node, status);
+		CHECK_MSTATUS_AND_RETURN(*status, false);
+
+		MString typeName = fnNode.typeName(status);
+		CHECK_MSTATUS_AND_RETURN(*status, false);
+
+		MString nodeClassification = MFnDependencyNode::classification(typeName);
+		
+		return classification == nodeClassification;
+
+	};
+
+	bool hasTypeId(const MObject& node, const MTypeId& typeId, MStatus* status)
+	/**
+	Evaluates if the supplied node has the specified type ID.
+
+	@param node: The node to evaluate.
+	@param classification: The type ID to test against.
+	@param status: Return status.
+	@return: Has type ID.
+	*/
+	{
+
+		MFnDependencyNode fnNode(node, status);
+		CHECK_MSTATUS_AND_RETURN(*status, false);
+
+		MTypeId nodeTypeId = fnNode.typeId(status);
+		CHECK_MSTATUS_AND_RETURN(*status, false);
+
+		return typeId == nodeTypeId;
+
+	};
+
+	bool isSceneLoading()
+	/**
+	Evaluates if a scene file is being loaded.
+
+	@return: Is loading.
+	*/
+	{
+		
+		return MFileIO::isNewingFile() || MFileIO::isOpeningFile() || MFileIO::isImportingFile() || MFileIO::isReferencingFile();
+
+	};
+
+	// Global queries such as `MGlobal::upAxis` are not safe to call from the parallel evaluator.
+	// Instead their values are cached here, from the main thread, whenever the scene notifies us of a change!
+	//
+	std::atomic<bool> sceneZUp(false);
+
+	MCallbackIdArray sceneCallbackIds;
+
+	// Wiring requested by nodes while a scene is loading is queued here and executed from the main thread once loading has finished.
+	// Each node/function pair is only queued once no matter how many connections were made during the load!
+	//
+	struct DeferredTask
+	{
+
+		MObjectHandle		handle;
+		DeferredFunction	function;
+
+	};
+
+	std::vector<DeferredTask> deferredTasks;
+	std::unordered_map<unsigned int, std::vector<size_t>> deferredIndices;
+	MCallbackId idleCallbackId = 0;
+	bool hasIdleCallback = false;
+
+	void onSceneChanged(void* clientData)
+	/**
+	Scene callback that refreshes the cached scene state.
+
+	@param clientData: Unused.
+	@return: Void.
+	*/
+	{
+
+		Maxformations::updateSceneState();
+
+	};
+
+	void onSceneLoaded(void* clientData)
+	/**
+	Scene callback that executes any wiring that was deferred while the scene was loading.
+
+	@param clientData: Unused.
+	@return: Void.
+	*/
+	{
+
+		Maxformations::flushDeferred(true);
+
+	};
+
+	void onIdle(void* clientData)
+	/**
+	Idle callback that executes any wiring that was deferred outside of a top-level file operation.
+
+	@param clientData: Unused.
+	@return: Void.
+	*/
+	{
+
+		Maxformations::flushDeferred(false);
+
+	};
+
+	MStatus registerSceneCallbacks()
+	/**
+	Registers the callbacks used to keep the cached scene state up-to-date.
+	This should only be called once from `initializePlugin`!
+
+	@return: Return status.
+	*/
+	{
+
+		MStatus status;
+
+		Maxformations::updateSceneState();
+
+		MCallbackId callbackId = MSceneMessage::addCallback(MSceneMessage::kAfterNew, onSceneChanged, nullptr, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		sceneCallbackIds.append(callbackId);
+
+		callbackId = MSceneMessage::addCallback(MSceneMessage::kAfterOpen, onSceneChanged, nullptr, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		sceneCallbackIds.append(callbackId);
+
+		callbackId = MSceneMessage::addCallback(MSceneMessage::kAfterOpen, onSceneLoaded, nullptr, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		sceneCallbackIds.append(callbackId);
+
+		callbackId = MSceneMessage::addCallback(MSceneMessage::kAfterImport, onSceneLoaded, nullptr, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		sceneCallbackIds.append(callbackId);
+
+		callbackId = MSceneMessage::addCallback(MSceneMessage::kAfterCreateReference, onSceneLoaded, nullptr, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		sceneCallbackIds.append(callbackId);
+
+		// Not every Maya version exposes an up-axis event
+		// In which case the up-axis is only refreshed when a scene is opened or created!
+		//
+		callbackId = MEventMessage::addEventCallback("upAxisChanged", onSceneChanged, nullptr, &status);
+
+		if (status)
+		{
+
+			sceneCallbackIds.append(callbackId);
+
+		}
+
+		return MS::kSuccess;
 
 	};
 
-	MVector getSceneUpVector()
+	MStatus deregisterSceneCallbacks()
 	/**
-	Returns the current scene up vector.
+	Removes the callbacks used to keep the cached scene state up-to-date.
 
-	@return: The up vector.
+	@return: Return status.
+	*/
+	{
+
+		MStatus status = MMessage::removeCallbacks(sceneCallbackIds);
+		sceneCallbackIds.clear();
+
+		if (hasIdleCallback)
+		{
+
+			MMessage::removeCallback(idleCallbackId);
+			hasIdleCallback = false;
+
+		}
+
+		deferredTasks.clear();
+		deferredIndices.clear();
+
+		return status;
+
+	};
+
+	bool deferUntilLoaded(const MObject& node, DeferredFunction function)
+	/**
+	Queues the supplied function if a scene file is being loaded.
+	The queue is flushed, onto a single modifier, once the file operation has finished or Maya becomes idle.
+	This should only be called from the main thread!
+
+	@param node: The node to pass to the function.
+	@param function: The function that queues the wiring edits.
+	@return: Was deferred.
+	*/
+	{
+
+		// Evaluate if file is being opened
+		// Any DAG changes will interfere with file IO operations!
+		//
+		bool isSceneLoading = Maxformations::isSceneLoading();
+
+		if (!isSceneLoading)
+		{
+
+			return false;
+
+		}
+
+		// Check if this task has already been queued
+		//
+		MObjectHandle handle(node);
+		std::vector<size_t>& indices = deferredIndices[handle.hashCode()];
+
+		for (size_t index : indices)
+		{
+
+			const DeferredTask& task = deferredTasks[index];
+
+			if (task.function == function && task.handle.objectRef() == node)
+			{
+
+				return true;
+
+			}
+
+		}
+
+		indices.push_back(deferredTasks.size());
+		deferredTasks.push_back({ handle, function });
+
+		// Make sure the queue is flushed even if no scene callbacks follow
+		// For example, reloading an existing reference does not notify any of the scene callbacks above!
+		//
+		if (!hasIdleCallback)
+		{
+
+			MStatus status;
+			idleCallbackId = MEventMessage::addEventCallback("idle", onIdle, nullptr, &status);
+
+			hasIdleCallback = status == MS::kSuccess;
+
+		}
+
+		return true;
+
+	};
+
+	MStatus flushDeferred(const bool force)
+	/**
+	Executes all of the deferred tasks onto a single modifier.
+	Unless forced, the queue is left untouched while a scene file is still being loaded!
+
+	@param force: Ignores any file operations in progress.
+	@return: Return status.
+	*/
+	{
+
+		MStatus status;
+
+		bool isSceneLoading = Maxformations::isSceneLoading();
+
+		if (isSceneLoading && !force)
+		{
+
+			return MS::kSuccess;
+
+		}
+
+		if (hasIdleCallback)
+		{
+
+			MMessage::removeCallback(idleCallbackId);
+			hasIdleCallback = false;
+
+		}
+
+		if (deferredTasks.empty())
+		{
+
+			return MS::kSuccess;  // Nothing to do here~!
+
+		}
+
+		// Swap out the queue before executing any tasks
+		// This way any tasks queued by the modifier are not lost!
+		//
+		std::vector<DeferredTask> tasks;
+		tasks.swap(deferredTasks);
+
+		deferredIndices.clear();
+
+		MAXFORM_PROFILE_TOPOLOGY("Maxformations::flushDeferred");
+
+		BatchModifier modifier;
+
+		for (const DeferredTask& task : tasks)
+		{
+
+			if (!task.handle.isAlive())
+			{
+
+				continue;
+
+			}
+
+			status = task.function(task.handle.objectRef(), modifier);
+			CHECK_MSTATUS(status);
+
+		}
+
+		return modifier.doIt();
+
+	};
+
+	unsigned int numDeferred()
+	/**
+	Returns the number of tasks waiting to be flushed.
+
+	@return: Task count.
+	*/
+	{
+
+		return static_cast<unsigned int>(deferredTasks.size());
+
+	};
+
+	void updateSceneState()
+	/**
+	Refreshes the cached scene up-axis.
+	This queries global state so it must only be called from the main thread!
+
+	@return: Void.
 	*/
 	{
 
 		MStatus status;
 
-		MVector upVector = MGlobal::upAxis(&status);
-		CHECK_MSTATUS_AND_RETURN(status, MVector::yAxis);
+		bool isZAxisUp = MGlobal::isZAxisUp(&status);
+		sceneZUp = status ? isZAxisUp : false;
+
+	};
+
+	MVector getSceneUpVector()
+	/**
+	Returns the cached scene up vector.
+	This is safe to call from any evaluation thread.
+
+	@return: The up vector.
+	*/
+	{
 
-		return upVector;
+		return sceneZUp ? MVector::zAxis : MVector::yAxis;
 
 	};
 
@@ -3010,4 +4421,179 @@ namespace Maxformations
 
 	}
 
+
+	MaxformCore::Vector3 toCoreVector(const MVector& vector)
+	/**
+	Converts the supplied vector into a core vector.
+
+	@param vector: The vector to convert.
+	@return: The core vector.
+	*/
+	{
+
+		return MaxformCore::Vector3{ vector.x, vector.y, vector.z };
+
+	}
+
+	MaxformCore::Vector3 toCoreVector(const MPoint& point)
+	/**
+	Converts the supplied point into a core vector.
+	The point is expected to be cartesian since the w component is discarded!
+
+	@param point: The point to convert.
+	@return: The core vector.
+	*/
+	{
+
+		return MaxformCore::Vector3{ point.x, point.y, point.z };
+
+	}
+
+	MaxformCore::Quaternion toCoreQuaternion(const MQuaternion& quat)
+	/**
+	Converts the supplied quaternion into a core quaternion.
+
+	@param quat: The quaternion to convert.
+	@return: The core quaternion.
+	*/
+	{
+
+		return MaxformCore::Quaternion{ quat.x, quat.y, quat.z, quat.w };
+
+	}
+
+	MQuaternion fromCoreQuaternion(const MaxformCore::Quaternion& quat)
+	/**
+	Converts the supplied core quaternion back into a quaternion.
+
+	@param quat: The core quaternion to convert.
+	@return: The quaternion.
+	*/
+	{
+
+		return MQuaternion(quat.x, quat.y, quat.z, quat.w);
+
+	}
+
+	std::vector<MaxformCore::Vector3> toCoreVectors(const MPointArray& points)
+	/**
+	Converts the supplied points into core vectors.
+
+	@param points: The points to convert.
+	@return: The core vectors.
+	*/
+	{
+
+		unsigned int pointCount = points.length();
+		std::vector<MaxformCore::Vector3> vectors = std::vector<MaxformCore::Vector3>(pointCount);
+
+		for (unsigned int i = 0; i < pointCount; i++)
+		{
+
+			vectors[i] = Maxformations::toCoreVector(points[i]);
+
+		}
+
+		return vectors;
+
+	}
+
+	MPoint fromCoreVector(const MaxformCore::Vector3& vector)
+	/**
+	Converts the supplied core vector into a point.
+
+	@param vector: The core vector to convert.
+	@return: The point.
+	*/
+	{
+
+		return MPoint(vector.x, vector.y, vector.z);
+
+	}
+
+	MPointArray fromCoreVectors(const std::vector<MaxformCore::Vector3>& vectors)
+	/**
+	Converts the supplied core vectors into points.
+
+	@param vectors: The core vectors to convert.
+	@return: The points.
+	*/
+	{
+
+		unsigned int vectorCount = static_cast<unsigned int>(vectors.size());
+		MPointArray points = MPointArray(vectorCount);
+
+		for (unsigned int i = 0; i < vectorCount; i++)
+		{
+
+			points[i] = Maxformations::fromCoreVector(vectors[i]);
+
+		}
+
+		return points;
+
+	}
+
+	MaxformCore::Matrix4 toCoreMatrix(const MMatrix& matrix)
+	/**
+	Converts the supplied matrix into a core matrix.
+
+	@param matrix: The matrix to convert.
+	@return: The core matrix.
+	*/
+	{
+
+		MaxformCore::Matrix4 coreMatrix;
+		matrix.get(coreMatrix.rows);
+
+		return coreMatrix;
+
+	}
+
+	void toCoreMatrices(const MMatrixArray& matrices, MaxformCore::MatrixBatch& batch)
+	/**
+	Converts the supplied matrices into the passed core batch.
+	The batch is resized rather than reallocated so its capacity can be reused between calls!
+
+	@param matrices: The matrices to convert.
+	@param batch: The passed batch to populate.
+	@return: Void.
+	*/
+	{
+
+		unsigned int matrixCount = matrices.length();
+		batch.resize(matrixCount);
+
+		for (unsigned int i = 0; i < matrixCount; i++)
+		{
+
+			matrices[i].get(batch[i].rows);
+
+		}
+
+	}
+
+	void fromCoreMatrices(const MaxformCore::MatrixBatch& batch, MMatrixArray& matrices)
+	/**
+	Copies the supplied core batch into the passed matrices.
+	The matrices are resized to match the batch and written in place, so no temporary matrices are constructed!
+
+	@param batch: The core batch to convert.
+	@param matrices: The passed matrices to update.
+	@return: Void.
+	*/
+	{
+
+		unsigned int matrixCount = static_cast<unsigned int>(batch.size());
+		matrices.setLength(matrixCount);
+
+		for (unsigned int i = 0; i < matrixCount; i++)
+		{
+
+			std::memcpy(matrices[i].matrix, batch[i].rows, sizeof(batch[i].rows));
+
+		}
+
+	}
+
 };
\ No newline at end of file
@@ -9,6 +9,7 @@
 #define _USE_MATH_DEFINES
 
 #include <maya/MObject.h>
+#include <maya/MObjectHandle.h>
 #include <maya/MDistance.h>
 #include <maya/MAngle.h>
 #include <maya/MString.h>
@@ -29,17 +30,34 @@
 #include <maya/MPlug.h>
 #include <maya/MPlugArray.h>
 #include <maya/MDGModifier.h>
+#include <maya/MDGContext.h>
 #include <maya/MFnAttribute.h>
 #include <maya/MNodeClass.h>
 #include <maya/MTypeId.h>
 #include <maya/MFileIO.h>
 #include <maya/MGlobal.h>
+#include <maya/MTime.h>
+#include <maya/MEventMessage.h>
+#include <maya/MSceneMessage.h>
+#include <maya/MCallbackIdArray.h>
+
+#include <vector>
+#include <unordered_map>
+#include <cmath>
+#include <cstring>
+#include <atomic>
+#include <mutex>
+
+#include "MaxformCore.h"
+#include "MaxformProfiler.h"
 
 
 namespace Maxformations
 {
 
 	const double TOLERANCE = 1e-3;
+	const double RIGID_TOLERANCE = 1e-9;
+	const unsigned int AVERAGE_THRESHOLD = 4;
 
 	enum class AxisOrder
 	{
@@ -56,6 +74,16 @@ namespace Maxformations
 
 	};
 
+	typedef MaxformCore::SlerpPrecision SlerpPrecision;
+
+	enum class BlendMode
+	{
+
+		Slerp = 0,
+		DualQuaternion = 1
+
+	};
+
 	template<class N> N clamp(const N value, const N min, const N max)
 	/**
 	Clamps the supplied number between the specified range.
@@ -120,6 +148,80 @@ namespace Maxformations
 
 	};
 
+	class BatchModifier
+	/**
+	Queues connection and value edits onto a single `MDGModifier` so the graph topology only changes once per operation.
+	Queued connections are tracked so that any subsequent queries reflect the pending state rather than the live graph.
+	*/
+	{
+
+	public:
+
+						BatchModifier();
+		virtual			~BatchModifier();
+
+		MPlug			source(const MPlug& plug, MStatus* status);
+
+		MStatus			connect(const MPlug& source, const MPlug& destination);
+		MStatus			disconnect(const MPlug& source, const MPlug& destination);
+		MStatus			newPlugValue(const MPlug& plug, const MPlug& otherPlug);
+		MStatus			newPlugValue(const MPlug& plug, const MObject& data);
+
+		MStatus			breakConnections(const MPlug& plug, bool asDst, bool asSrc);
+		MStatus			connectPlugs(const MPlug& plug, const MPlug& otherPlug, const bool force);
+		MStatus			transferConnections(const MPlug& plug, const MPlug& otherPlug);
+		MStatus			transferValues(const MPlug& plug, const MPlug& otherPlug);
+
+		unsigned int	numEdits() const;
+
+		MStatus			doIt();
+		MStatus			undoIt();
+
+	protected:
+
+		struct Connection
+		{
+
+			MPlug	source;
+			MPlug	destination;
+			bool	connected;
+
+		};
+
+		MDGModifier					modifier;
+		std::vector<Connection>		connections;
+		unsigned int				editCount;
+
+	};
+
+	typedef MStatus(*DeferredFunction)(const MObject& node, BatchModifier& modifier);
+
+	class ConstraintCache
+	/**
+	Stores the blended constraint matrices so that each output request only has to derive its own value.
+	The cache is only trusted for normal context evaluations and must be invalidated whenever the constraint inputs change.
+	*/
+	{
+
+	public:
+
+						ConstraintCache();
+		virtual			~ConstraintCache();
+
+		bool			get(const MDGContext& context, MMatrix& matrix, MMatrix& worldMatrix) const;
+		void			set(const MDGContext& context, const MMatrix& matrix, const MMatrix& worldMatrix);
+		void			invalidate();
+
+	protected:
+
+		MMatrix			matrix;
+		MMatrix			worldMatrix;
+		bool			isValid;
+
+		mutable std::mutex	mutex;
+
+	};
+
 	MMatrix			createPositionMatrix(const double x, const double y, const double z);
 	MMatrix			createPositionMatrix(const MVector& position);
 	MMatrix			createPositionMatrix(const MMatrix& matrix);
@@ -147,13 +249,21 @@ namespace Maxformations
 	void			decomposeMatrix(const MMatrix& matrix, MPoint& position, MQuaternion& rotation, MVector& scale);
 	void			breakMatrix(const MMatrix& matrix, MVector& xAxis, MVector& yAxis, MVector& zAxis, MPoint& position);
 	MMatrix			normalizeMatrix(const MMatrix& matrix);
+	bool			isAffine(const MMatrix& matrix);
+	bool			isRigid(const MMatrix& matrix);
+	MMatrix			rigidInverse(const MMatrix& matrix);
+	MMatrix			affineInverse(const MMatrix& matrix);
+	MMatrix			invertMatrix(const MMatrix& matrix);
 	MMatrixArray	staggerMatrices(const MMatrixArray& matrices);
+	void			staggerMatrices(const MMatrixArray& matrices, MMatrixArray& newMatrices);
 	MMatrixArray	expandMatrices(const MMatrixArray& matrices);
+	void			expandMatrices(const MMatrixArray& matrices, MMatrixArray& newMatrices);
 	MStatus			twistMatrices(MMatrixArray& matrices, const int forwardAxis, const MAngle& startTwistAngle, const MAngle& endTwistAngle);
 	MStatus			reorientMatrices(MMatrixArray& matrices, const int forwardAxis, const bool forwardAxisFlip, const int upAxis, const bool upAxisFlip);
 
 	MVector			matrixToPosition(const MMatrix& matrix);
 	MVectorArray	matrixToPosition(const MMatrixArray& matrices);
+	void			matrixToPosition(const MMatrixArray& matrices, MVectorArray& positions);
 
 	MEulerRotation::RotationOrder	axisToRotationOrder(const AxisOrder axisOrder);
 	AxisOrder		rotationToAxisOrder(const MEulerRotation::RotationOrder rotationOrder);
@@ -168,6 +278,7 @@ namespace Maxformations
 	MVector			matrixToEulerYZY(const MMatrix& matrix);
 	MVector			matrixToEulerZXZ(const MMatrix& matrix);
 	MVector			matrixToEulerAngles(const MMatrix& matrix, const AxisOrder axisOrder);
+	MVectorArray	matrixToEulerAngles(const MMatrixArray& matrices, const AxisOrder axisOrder);
 
 	MEulerRotation	matrixToEulerRotation(const MMatrix& matrix, const AxisOrder axisOrder);
 	MEulerRotation	matrixToEulerRotation(const MMatrix& matrix, const MEulerRotation::RotationOrder rotationOrder);
@@ -176,7 +287,13 @@ namespace Maxformations
 	MQuaternion		eulerAnglesToQuaternion(const MVector& radians, const AxisOrder axisOrder);
 	MQuaternion		matrixToQuaternion(const MMatrix& matrix);
 	double			dot(const MQuaternion& quat, const MQuaternion& otherQuat);
+	SlerpPrecision	getSlerpPrecision();
+	void			setSlerpPrecision(const SlerpPrecision precision);
+
 	MQuaternion		slerp(const MQuaternion& startQuat, const MQuaternion& endQuat, const float weight);
+	MQuaternion		slerp(const MQuaternion& startQuat, const MQuaternion& endQuat, const float weight, const SlerpPrecision precision);
+	MQuaternion		nlerp(const MQuaternion& startQuat, const MQuaternion& endQuat, const float weight);
+	MQuaternion		averageQuaternions(const MMatrixArray& matrices, const MFloatArray& weights);
 	MMatrix			slerp(const MMatrix& startMatrix, const MMatrix& endMatrix, const float weight);
 
 	MVector			matrixToScale(const MMatrix& matrix);
@@ -189,7 +306,13 @@ namespace Maxformations
 	MFloatArray		normalize(const MFloatArray& items);
 	MIntArray		nonZeroes(const MFloatArray& items);
 	MMatrix			blendMatrices(const MMatrix& startMatrix, const MMatrix& endMatrix, const float weight);
+	MMatrix			blendMatrices(const MMatrix& startMatrix, const MMatrix& endMatrix, const float weight, const SlerpPrecision precision);
 	MMatrix			blendMatrices(const MMatrix& restMatrix, const MMatrixArray& matrices, const MFloatArray& weights);
+	MMatrix			blendMatrices(const MMatrix& restMatrix, const MMatrixArray& matrices, const MFloatArray& weights, const SlerpPrecision precision);
+	MMatrix			blendMatrices(const MMatrix& restMatrix, const MMatrixArray& matrices, const MFloatArray& weights, const BlendMode mode);
+	MMatrix			blendMatrices(const MMatrix& restMatrix, const MMatrixArray& matrices, const MFloatArray& weights, const BlendMode mode, const SlerpPrecision precision);
+	MMatrix			blendDualQuaternions(const MMatrix& restMatrix, const MMatrixArray& matrices, const MFloatArray& weights);
+	MMatrix			averageMatrices(const MMatrix& restMatrix, const MMatrixArray& matrices, const MFloatArray& weights);
 
 	MDistance		distanceBetween(const MMatrix& startMatrix, const MMatrix& endMatrix);
 	MAngle			angleBetween(const MMatrix& startMatrix, const MMatrix& endMatrix);
@@ -198,6 +321,7 @@ namespace Maxformations
 	MObject			createMatrixData(const MTransformationMatrix& transform);
 	MMatrix			getMatrixData(const MObject& matrixData);
 	MTransformationMatrix	getTransformData(const MObject& matrixData);
+	MStatus			setMatrixData(MDataHandle& handle, const MTransformationMatrix& transform);
 
 	MStatus			resetMatrixPlug(MPlug& plug);
 
@@ -216,11 +340,167 @@ namespace Maxformations
 	bool			hasTypeId(const MObject& node, const MTypeId& typeId, MStatus* status);
 
 	bool			isSceneLoading();
+	MStatus			registerSceneCallbacks();
+	MStatus			deregisterSceneCallbacks();
+	bool			deferUntilLoaded(const MObject& node, DeferredFunction function);
+	MStatus			flushDeferred(const bool force);
+	unsigned int	numDeferred();
+	void			updateSceneState();
 	MVector			getSceneUpVector();
 
 	MString			stringify(const MVector& vector);
 	MString			stringify(const MPoint& point);
 	MString			stringify(const MMatrix& matrix);
 
+	MaxformCore::Vector3	toCoreVector(const MVector& vector);
+	MaxformCore::Vector3	toCoreVector(const MPoint& point);
+	std::vector<MaxformCore::Vector3>	toCoreVectors(const MPointArray& points);
+	MPoint			fromCoreVector(const MaxformCore::Vector3& vector);
+	MPointArray		fromCoreVectors(const std::vector<MaxformCore::Vector3>& vectors);
+	MaxformCore::Quaternion	toCoreQuaternion(const MQuaternion& quat);
+	MQuaternion		fromCoreQuaternion(const MaxformCore::Quaternion& quat);
+	MaxformCore::Matrix4	toCoreMatrix(const MMatrix& matrix);
+	void			toCoreMatrices(const MMatrixArray& matrices, MaxformCore::MatrixBatch& batch);
+	void			fromCoreMatrices(const MaxformCore::MatrixBatch& batch, MMatrixArray& matrices);
+
+	template<unsigned int First, unsigned int Second, unsigned int Third, MVector(*Extract)(const MMatrix&)> struct AxisSequence
+	/**
+	Compile-time description of an axis order.
+	The axis indices are applied in sequence when composing rotations and the extractor decomposes them back into euler angles.
+	*/
+	{
+
+		static const unsigned int first = First;
+		static const unsigned int second = Second;
+		static const unsigned int third = Third;
+
+		static MVector extract(const MMatrix& matrix) { return Extract(matrix); };
+
+	};
+
+	template<AxisOrder O> struct AxisOrderTraits;
+
+	template<> struct AxisOrderTraits<AxisOrder::xyz> : AxisSequence<0, 1, 2, matrixToEulerXYZ> {};
+	template<> struct AxisOrderTraits<AxisOrder::xzy> : AxisSequence<0, 2, 1, matrixToEulerXZY> {};
+	template<> struct AxisOrderTraits<AxisOrder::yzx> : AxisSequence<1, 2, 0, matrixToEulerYZX> {};
+	template<> struct AxisOrderTraits<AxisOrder::yxz> : AxisSequence<1, 0, 2, matrixToEulerYXZ> {};
+	template<> struct AxisOrderTraits<AxisOrder::zxy> : AxisSequence<2, 0, 1, matrixToEulerZXY> {};
+	template<> struct AxisOrderTraits<AxisOrder::zyx> : AxisSequence<2, 1, 0, matrixToEulerZYX> {};
+	template<> struct AxisOrderTraits<AxisOrder::xyx> : AxisSequence<0, 1, 0, matrixToEulerXYX> {};
+	template<> struct AxisOrderTraits<AxisOrder::yzy> : AxisSequence<1, 2, 1, matrixToEulerYZY> {};
+	template<> struct AxisOrderTraits<AxisOrder::zxz> : AxisSequence<2, 0, 2, matrixToEulerZXZ> {};
+
+	template<unsigned int Axis> void rotateRows(double(&rows)[4][4], const double angle)
+	/**
+	Post-multiplies the upper 3x3 of the supplied rows by a rotation around the specified axis.
+	Only the two columns perpendicular to the axis are touched!
+
+	@param rows: The rows to rotate in place.
+	@param angle: The angle in radians.
+	@return: Void.
+	*/
+	{
+
+		const unsigned int i = (Axis + 1) % 3;
+		const unsigned int j = (Axis + 2) % 3;
+
+		double cosine = std::cos(angle);
+		double sine = std::sin(angle);
+
+		double a, b;
+
+		for (unsigned int row = 0; row < 3; row++)
+		{
+
+			a = rows[row][i];
+			b = rows[row][j];
+
+			rows[row][i] = (cosine * a) - (sine * b);
+			rows[row][j] = (sine * a) + (cosine * b);
+
+		}
+
+	};
+
+	template<AxisOrder O> MMatrix createRotationMatrix(const double x, const double y, const double z)
+	/**
+	Creates a rotation matrix from the supplied angles using an axis order known at compile time.
+	Repeated axis orders, such as `xyx`, reuse the angle belonging to the repeated axis.
+
+	@param x: The X angle in radians.
+	@param y: The Y angle in radians.
+	@param z: The Z angle in radians.
+	@return: The new rotation matrix.
+	*/
+	{
+
+		typedef AxisOrderTraits<O> Traits;
+
+		double angles[3] = { x, y, z };
+
+		double rows[4][4] = {
+			{ 1.0, 0.0, 0.0, 0.0 },
+			{ 0.0, 1.0, 0.0, 0.0 },
+			{ 0.0, 0.0, 1.0, 0.0 },
+			{ 0.0, 0.0, 0.0, 1.0 }
+		};
+
+		Maxformations::rotateRows<Traits::first>(rows, angles[Traits::first]);
+		Maxformations::rotateRows<Traits::second>(rows, angles[Traits::second]);
+		Maxformations::rotateRows<Traits::third>(rows, angles[Traits::third]);
+
+		return MMatrix(rows);
+
+	};
+
+	template<AxisOrder O> MVector matrixToEulerAngles(const MMatrix& matrix)
+	/**
+	Converts the supplied transform matrix into euler angles using an axis order known at compile time.
+
+	@param matrix: The matrix to convert.
+	@return: The angles in radians.
+	*/
+	{
+
+		return AxisOrderTraits<O>::extract(matrix);
+
+	};
+
+	template<AxisOrder O> MVectorArray matrixToEulerAngles(const MMatrixArray& matrices)
+	/**
+	Converts the supplied transform matrices into euler angles using an axis order known at compile time.
+
+	@param matrices: The matrices to convert.
+	@return: The angles in radians.
+	*/
+	{
+
+		unsigned int matrixCount = matrices.length();
+		MVectorArray angles = MVectorArray(matrixCount);
+
+		for (unsigned int i = 0; i < matrixCount; i++)
+		{
+
+			angles[i] = AxisOrderTraits<O>::extract(matrices[i]);
+
+		}
+
+		return angles;
+
+	};
+
+	template<AxisOrder O> MQuaternion eulerAnglesToQuaternion(const MVector& radians)
+	/**
+	Converts the supplied euler angles into a quaternion using an axis order known at compile time.
+
+	@param radians: The XYZ values in radians.
+	@return: The transform orientation as a quaternion.
+	*/
+	{
+
+		return Maxformations::matrixToQuaternion(Maxformations::createRotationMatrix<O>(radians.x, radians.y, radians.z));
+
+	};
+
 };
 #endif
\ No newline at end of file
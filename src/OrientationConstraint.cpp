@@ -11,6 +11,8 @@
 
 MObject OrientationConstraint::localOrWorld;
 MObject OrientationConstraint::relative;
+MObject OrientationConstraint::blendMode;
+MObject OrientationConstraint::slerpPrecision;
 MObject OrientationConstraint::offsetRotate;
 MObject OrientationConstraint::offsetRotateX;
 MObject OrientationConstraint::offsetRotateY;
@@ -38,6 +40,7 @@ MObject OrientationConstraint::constraintInverseMatrix;
 MObject OrientationConstraint::constraintWorldMatrix;
 MObject OrientationConstraint::constraintWorldInverseMatrix;
 MObject OrientationConstraint::constraintParentInverseMatrix;
+MObject OrientationConstraint::evaluatedTargets;
 
 MString	OrientationConstraint::inputCategory("Input");
 MString	OrientationConstraint::offsetCategory("Offset");
@@ -70,6 +73,8 @@ Only these values should be used when performing computations!
 
 	MStatus status;
 
+	MAXFORM_PROFILE_COMPUTE("OrientationConstraint::compute", this->thisMObject());
+
 	// Check requested attribute
 	//
 	MObject attribute = plug.attribute(&status);
@@ -81,177 +86,390 @@ Only these values should be used when performing computations!
 	if (fnAttribute.hasCategory(OrientationConstraint::outputCategory))
 	{
 
-		// Get input data handles
+		// Get constraint matrices
+		// Any subsequent output requests within the same evaluation are derived from the cached matrices!
 		//
-		MDataHandle relativeHandle = data.inputValue(OrientationConstraint::relative, &status);
+		MDGContext context = data.context(&status);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle offsetRotateHandle = data.inputValue(OrientationConstraint::offsetRotate, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		MMatrix constraintMatrix, constraintWorldMatrix;
+		bool isCached = this->cache.get(context, constraintMatrix, constraintWorldMatrix);
+		MAXFORM_RECORD_CACHE_ACCESS(isCached);
 
-		MDataHandle localOrWorldHandle = data.inputValue(OrientationConstraint::localOrWorld, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		if (!isCached)
+		{
 
-		MDataHandle enableRestPositionHandle = data.inputValue(OrientationConstraint::enableRestPosition, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			status = this->computeMatrices(data, constraintMatrix, constraintWorldMatrix);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle restRotateHandle = data.inputValue(OrientationConstraint::restRotate, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			this->cache.set(context, constraintMatrix, constraintWorldMatrix);
 
-		MDataHandle constraintRotateOrderHandle = data.inputValue(OrientationConstraint::constraintRotateOrder, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		}
 
-		MDataHandle constraintParentInverseMatrixHandle = data.inputValue(OrientationConstraint::constraintParentInverseMatrix, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		// Update requested output
+		//
+		MObject output = plug.isChild() ? plug.parent().attribute() : attribute;
 
-		MArrayDataHandle targetArrayHandle = data.inputArrayValue(OrientationConstraint::target, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		if (output == OrientationConstraint::constraintRotate)
+		{
 
-		// Get values from handles
-		//
-		bool localOrWorld = localOrWorldHandle.asBool();
-		bool relative = relativeHandle.asBool();
-		MVector offsetRotate = offsetRotateHandle.asVector();
-		MMatrix offsetMatrix = relative ? Maxformations::createRotationMatrix(offsetRotate) : MMatrix::identity;
-		
-		MEulerRotation::RotationOrder constraintRotateOrder = MEulerRotation::RotationOrder(constraintRotateOrderHandle.asShort());
-		MMatrix constraintParentInverseMatrix = constraintParentInverseMatrixHandle.asMatrix();
-		MMatrix constraintParentMatrix = constraintParentInverseMatrix.inverse();
-
-		bool restEnabled = enableRestPositionHandle.asBool();
-		MVector restRotate = restRotateHandle.asVector();
-		MMatrix restRotateMatrix = Maxformations::createRotationMatrix(restRotate, constraintRotateOrder);
-		MMatrix restMatrix = restEnabled ? restRotateMatrix : MMatrix::identity;
-		MMatrix restWorldMatrix = restMatrix * constraintParentMatrix;
-
-		// Collect target matrices
-		//
-		unsigned int targetCount = targetArrayHandle.elementCount();
+			MDataHandle constraintRotateOrderHandle = data.inputValue(OrientationConstraint::constraintRotateOrder, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MFloatArray targetWeights = MFloatArray(targetCount);
-		MMatrixArray targetMatrices = MMatrixArray(targetCount);
-		MMatrixArray targetWorldMatrices = MMatrixArray(targetCount);
+			MDataHandle constraintRotateXHandle = data.outputValue(OrientationConstraint::constraintRotateX, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle targetHandle, targetWeightHandle, targetMatrixHandle, targetParentMatrixHandle, targetOffsetRotateHandle;
-		MMatrix targetMatrix, targetParentMatrix, targetOffsetMatrix;
-		
-		for (unsigned int i = 0; i < targetCount; i++)
-		{
+			MDataHandle constraintRotateYHandle = data.outputValue(OrientationConstraint::constraintRotateY, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-			// Jump to array element
-			//
-			status = targetArrayHandle.jumpToArrayElement(i);
+			MDataHandle constraintRotateZHandle = data.outputValue(OrientationConstraint::constraintRotateZ, &status);
 			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-			targetHandle = targetArrayHandle.inputValue(&status);
+			MEulerRotation::RotationOrder constraintRotateOrder = MEulerRotation::RotationOrder(constraintRotateOrderHandle.asShort());
+			MEulerRotation constraintRotate = Maxformations::matrixToEulerRotation(constraintMatrix, constraintRotateOrder);
+
+			constraintRotateXHandle.setMAngle(MAngle(constraintRotate.x, MAngle::kRadians));
+			constraintRotateYHandle.setMAngle(MAngle(constraintRotate.y, MAngle::kRadians));
+			constraintRotateZHandle.setMAngle(MAngle(constraintRotate.z, MAngle::kRadians));
+
+			constraintRotateXHandle.setClean();
+			constraintRotateYHandle.setClean();
+			constraintRotateZHandle.setClean();
+
+		}
+		else if (output == OrientationConstraint::constraintMatrix)
+		{
+
+			MDataHandle constraintMatrixHandle = data.outputValue(OrientationConstraint::constraintMatrix, &status);
 			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-			// Get target data handles
-			//
-			targetWeightHandle = targetHandle.child(OrientationConstraint::targetWeight);
-			targetMatrixHandle = targetHandle.child(OrientationConstraint::targetMatrix);
-			targetParentMatrixHandle = targetHandle.child(OrientationConstraint::targetParentMatrix);
-			targetOffsetRotateHandle = targetHandle.child(OrientationConstraint::targetOffsetRotate);
+			constraintMatrixHandle.setMMatrix(constraintMatrix);
+			constraintMatrixHandle.setClean();
 
-			// Get target weight
-			//
-			targetWeights[i] = Maxformations::clamp(targetWeightHandle.asFloat(), 0.0f, 100.0f) / 100.0f;
+		}
+		else if (output == OrientationConstraint::constraintInverseMatrix)
+		{
 
-			// Get target matrices
-			//
-			targetMatrix = targetMatrixHandle.asMatrix();
-			targetParentMatrix = targetParentMatrixHandle.asMatrix();
-			targetOffsetMatrix = relative ? Maxformations::createRotationMatrix(targetOffsetRotateHandle.asVector()) : MMatrix::identity;
+			MDataHandle constraintInverseMatrixHandle = data.outputValue(OrientationConstraint::constraintInverseMatrix, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-			targetMatrices[i] = Maxformations::createRotationMatrix(targetOffsetMatrix * Maxformations::normalizeMatrix(targetMatrix));
-			targetWorldMatrices[i] = Maxformations::createRotationMatrix(targetOffsetMatrix * Maxformations::normalizeMatrix(targetMatrix * targetParentMatrix));
+			constraintInverseMatrixHandle.setMMatrix(Maxformations::invertMatrix(constraintMatrix));
+			constraintInverseMatrixHandle.setClean();
 
 		}
+		else if (output == OrientationConstraint::constraintWorldMatrix)
+		{
 
-		// Calculate weighted constraint matrix
-		//
-		MMatrix orientationMatrix, constraintMatrix, constraintWorldMatrix;
+			MDataHandle constraintWorldMatrixHandle = data.outputValue(OrientationConstraint::constraintWorldMatrix, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		if (localOrWorld)  // Local
+			constraintWorldMatrixHandle.setMMatrix(constraintWorldMatrix);
+			constraintWorldMatrixHandle.setClean();
+
+		}
+		else if (output == OrientationConstraint::constraintWorldInverseMatrix)
 		{
 
-			orientationMatrix = Maxformations::blendMatrices(restMatrix, targetMatrices, targetWeights);
+			MDataHandle constraintWorldInverseMatrixHandle = data.outputValue(OrientationConstraint::constraintWorldInverseMatrix, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-			constraintMatrix = offsetMatrix * orientationMatrix;
-			constraintWorldMatrix = constraintMatrix * constraintParentMatrix;
+			constraintWorldInverseMatrixHandle.setMMatrix(Maxformations::invertMatrix(constraintWorldMatrix));
+			constraintWorldInverseMatrixHandle.setClean();
 
 		}
-		else  // World
+		else if (output == OrientationConstraint::evaluatedTargets)
 		{
 
-			orientationMatrix = Maxformations::blendMatrices(restWorldMatrix, targetWorldMatrices, targetWeights);
+			// The evaluated target count is written alongside the constraint matrices
+			//
+			MDataHandle evaluatedTargetsHandle = data.outputValue(OrientationConstraint::evaluatedTargets, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-			constraintWorldMatrix = offsetMatrix * orientationMatrix;
-			constraintMatrix = constraintWorldMatrix * constraintParentInverseMatrix;
+			evaluatedTargetsHandle.setClean();
 
 		}
+		else
+		{
+
+			return MS::kUnknownParameter;
 
-		// Get output data handles
+		}
+
+		// Mark data block as clean
 		//
-		MDataHandle constraintRotateXHandle = data.outputValue(OrientationConstraint::constraintRotateX, &status);
+		status = data.setClean(plug);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle constraintRotateYHandle = data.outputValue(OrientationConstraint::constraintRotateY, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		return MS::kSuccess;
 
-		MDataHandle constraintRotateZHandle = data.outputValue(OrientationConstraint::constraintRotateZ, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+	}
+	else
+	{
 
-		MDataHandle constraintMatrixHandle = data.outputValue(OrientationConstraint::constraintMatrix, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		return MS::kUnknownParameter;
 
-		MDataHandle constraintInverseMatrixHandle = data.outputValue(OrientationConstraint::constraintInverseMatrix, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+	}
+
+}
+
+
+MStatus OrientationConstraint::computeMatrices(MDataBlock& data, MMatrix& constraintMatrix, MMatrix& constraintWorldMatrix)
+/**
+Computes the blended constraint matrices from the node's inputs.
+This is only called once per evaluation, see `compute` for how the individual outputs are derived.
+
+@param data: Data block containing storage for the node's attributes.
+@param constraintMatrix: The passed matrix to populate.
+@param constraintWorldMatrix: The passed world matrix to populate.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Get input data handles
+	//
+	MDataHandle relativeHandle = data.inputValue(OrientationConstraint::relative, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle blendModeHandle = data.inputValue(OrientationConstraint::blendMode, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle slerpPrecisionHandle = data.inputValue(OrientationConstraint::slerpPrecision, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle offsetRotateHandle = data.inputValue(OrientationConstraint::offsetRotate, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle localOrWorldHandle = data.inputValue(OrientationConstraint::localOrWorld, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle enableRestPositionHandle = data.inputValue(OrientationConstraint::enableRestPosition, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle restRotateHandle = data.inputValue(OrientationConstraint::restRotate, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle constraintWorldMatrixHandle = data.outputValue(OrientationConstraint::constraintWorldMatrix, &status);
+	MDataHandle constraintRotateOrderHandle = data.inputValue(OrientationConstraint::constraintRotateOrder, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle constraintParentInverseMatrixHandle = data.inputValue(OrientationConstraint::constraintParentInverseMatrix, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MArrayDataHandle targetArrayHandle = data.inputArrayValue(OrientationConstraint::target, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Get values from handles
+	//
+	bool localOrWorld = localOrWorldHandle.asBool();
+	bool relative = relativeHandle.asBool();
+	Maxformations::BlendMode blendMode = Maxformations::BlendMode(blendModeHandle.asShort());
+	Maxformations::SlerpPrecision precision = Maxformations::SlerpPrecision(slerpPrecisionHandle.asShort());
+	MVector offsetRotate = offsetRotateHandle.asVector();
+	MMatrix offsetMatrix = relative ? Maxformations::createRotationMatrix(offsetRotate) : MMatrix::identity;
+	
+	MEulerRotation::RotationOrder constraintRotateOrder = MEulerRotation::RotationOrder(constraintRotateOrderHandle.asShort());
+	MMatrix constraintParentInverseMatrix = constraintParentInverseMatrixHandle.asMatrix();
+	MMatrix constraintParentMatrix = Maxformations::invertMatrix(constraintParentInverseMatrix);
+
+	bool restEnabled = enableRestPositionHandle.asBool();
+	MVector restRotate = restRotateHandle.asVector();
+	MMatrix restRotateMatrix = Maxformations::createRotationMatrix(restRotate, constraintRotateOrder);
+	MMatrix restMatrix = restEnabled ? restRotateMatrix : MMatrix::identity;
+	MMatrix restWorldMatrix = restMatrix * constraintParentMatrix;
+
+	// Collect target matrices
+	//
+	unsigned int targetCount = targetArrayHandle.elementCount();
+
+	MFloatArray targetWeights;
+	MMatrixArray targetMatrices;
+	MMatrixArray targetWorldMatrices;
+
+	float weight;
+
+	MDataHandle targetHandle, targetWeightHandle, targetMatrixHandle, targetParentMatrixHandle, targetOffsetRotateHandle;
+	MMatrix targetMatrix, targetParentMatrix, targetOffsetMatrix;
+	
+	for (unsigned int i = 0; i < targetCount; i++)
+	{
+
+		// Jump to array element
+		//
+		status = targetArrayHandle.jumpToArrayElement(i);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle constraintWorldInverseMatrixHandle = data.outputValue(OrientationConstraint::constraintWorldInverseMatrix, &status);
+		targetHandle = targetArrayHandle.inputValue(&status);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		// Update output data handles
+		// Get target data handles
 		//
-		MEulerRotation constraintRotate = Maxformations::matrixToEulerRotation(constraintMatrix, constraintRotateOrder);
+		targetWeightHandle = targetHandle.child(OrientationConstraint::targetWeight);
+		targetMatrixHandle = targetHandle.child(OrientationConstraint::targetMatrix);
+		targetParentMatrixHandle = targetHandle.child(OrientationConstraint::targetParentMatrix);
+		targetOffsetRotateHandle = targetHandle.child(OrientationConstraint::targetOffsetRotate);
 
-		constraintRotateXHandle.setMAngle(MAngle(constraintRotate.x, MAngle::kRadians));
-		constraintRotateYHandle.setMAngle(MAngle(constraintRotate.y, MAngle::kRadians));
-		constraintRotateZHandle.setMAngle(MAngle(constraintRotate.z, MAngle::kRadians));
+		// Get target weight
+		//
+		weight = Maxformations::clamp(targetWeightHandle.asFloat(), 0.0f, 100.0f) / 100.0f;
 
-		constraintRotateXHandle.setClean();
-		constraintRotateYHandle.setClean();
-		constraintRotateZHandle.setClean();
+		if (weight == 0.0f)
+		{
 
-		constraintMatrixHandle.setMMatrix(constraintMatrix);
-		constraintInverseMatrixHandle.setMMatrix(constraintMatrix.inverse());
-		constraintWorldMatrixHandle.setMMatrix(constraintWorldMatrix);
-		constraintWorldInverseMatrixHandle.setMMatrix(constraintWorldMatrix.inverse());
+			continue;  // Skip targets that don't contribute!
 
-		constraintMatrixHandle.setClean();
-		constraintInverseMatrixHandle.setClean();
-		constraintWorldMatrixHandle.setClean();
-		constraintWorldInverseMatrixHandle.setClean();
+		}
 
-		// Mark data block as clean
+		targetWeights.append(weight);
+
+		// Get target matrices
 		//
-		status = data.setClean(plug);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		targetMatrix = targetMatrixHandle.asMatrix();
+		targetParentMatrix = targetParentMatrixHandle.asMatrix();
+		targetOffsetMatrix = relative ? Maxformations::createRotationMatrix(targetOffsetRotateHandle.asVector()) : MMatrix::identity;
 
-		return MS::kSuccess;
+		targetMatrices.append(Maxformations::createRotationMatrix(targetOffsetMatrix * Maxformations::normalizeMatrix(targetMatrix)));
+		targetWorldMatrices.append(Maxformations::createRotationMatrix(targetOffsetMatrix * Maxformations::normalizeMatrix(targetMatrix * targetParentMatrix)));
 
 	}
-	else
+
+	// Update evaluated target count
+	//
+	MDataHandle evaluatedTargetsHandle = data.outputValue(OrientationConstraint::evaluatedTargets, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	evaluatedTargetsHandle.setInt(int(targetWeights.length()));
+	evaluatedTargetsHandle.setClean();
+
+	// Calculate weighted constraint matrix
+	// Larger target counts are averaged in a single pass rather than through chained slerps!
+	//
+	MMatrix orientationMatrix;
+
+	if (localOrWorld)  // Local
 	{
 
-		return MS::kUnknownParameter;
+		if (blendMode == Maxformations::BlendMode::Slerp && targetWeights.length() > Maxformations::AVERAGE_THRESHOLD)
+		{
+
+			orientationMatrix = Maxformations::averageMatrices(restMatrix, targetMatrices, targetWeights);
+
+		}
+		else
+		{
+
+			orientationMatrix = Maxformations::blendMatrices(restMatrix, targetMatrices, targetWeights, blendMode, precision);
+
+		}
+
+		constraintMatrix = offsetMatrix * orientationMatrix;
+		constraintWorldMatrix = constraintMatrix * constraintParentMatrix;
 
 	}
+	else  // World
+	{
 
-}
+		if (blendMode == Maxformations::BlendMode::Slerp && targetWeights.length() > Maxformations::AVERAGE_THRESHOLD)
+		{
+
+			orientationMatrix = Maxformations::averageMatrices(restWorldMatrix, targetWorldMatrices, targetWeights);
+
+		}
+		else
+		{
+
+			orientationMatrix = Maxformations::blendMatrices(restWorldMatrix, targetWorldMatrices, targetWeights, blendMode, precision);
+
+		}
+
+		constraintWorldMatrix = offsetMatrix * orientationMatrix;
+		constraintMatrix = constraintWorldMatrix * constraintParentInverseMatrix;
+
+	}
+
+	return MS::kSuccess;
+
+};
+
+
+MStatus OrientationConstraint::setDependentsDirty(const MPlug& plug, MPlugArray& plugArray)
+/**
+This method can be overridden in user defined nodes to specify which plugs should be set dirty based upon an input plug which Maya is marking dirty.
+Any input change invalidates the cached constraint matrices.
+
+@param plug: Plug which is being set dirty by Maya.
+@param plugArray: The programmer should add any plugs which they want to set dirty to this list.
+@return: Return status.
+*/
+{
+
+	this->cache.invalidate();
+
+	return MPxConstraint::setDependentsDirty(plug, plugArray);
+
+};
+
+
+MStatus OrientationConstraint::preEvaluation(const MDGContext& context, const MEvaluationNode& evaluationNode)
+/**
+Prepares the node for evaluation by the evaluation manager.
+Dirty propagation is skipped in this case so the cached constraint matrices are invalidated here instead.
+
+@param context: Context in which the evaluation will happen.
+@param evaluationNode: Evaluation node which contains information about the dirty plugs that are about to be evaluated.
+@return: Return status.
+*/
+{
+
+	if (context.isNormal())
+	{
+
+		this->cache.invalidate();
+
+	}
+
+	return MPxConstraint::preEvaluation(context, evaluationNode);
+
+};
+
+
+MPxNode::SchedulingType OrientationConstraint::schedulingType() const
+/**
+When overridden this method controls the degree of parallelism supported by the node during threaded evaluation.
+The cached constraint matrices are guarded by their own lock so this constraint can evaluate in parallel!
+
+@return: The scheduling type.
+*/
+{
+
+	return MPxNode::kParallel;
+
+};
+
+
+void OrientationConstraint::getCacheSetup(const MEvaluationNode& evaluationNode, MNodeCacheDisablingInfo& disablingInfo, MNodeCacheSetupInfo& cacheSetupInfo, MObjectArray& monitoredAttributes) const
+/**
+Provide node-specific setup info for the Cached Playback system.
+The cached constraint matrices are only trusted for normal contexts so background evaluations always recompute them!
+
+@param evaluationNode: This node's evaluation node, contains animated plug information.
+@param disablingInfo: Information about why the node disables Cached Playback to be reported to the user.
+@param cacheSetupInfo: Preferences and requirements this node has for Cached Playback.
+@param monitoredAttributes: Attributes impacting the behavior of this method that will be monitored for change.
+@return: void.
+*/
+{
+
+	// Call parent function
+	//
+	MPxConstraint::getCacheSetup(evaluationNode, disablingInfo, cacheSetupInfo, monitoredAttributes);
+	assert(!disablingInfo.getCacheDisabled());
+
+	// Update caching preference
+	//
+	cacheSetupInfo.setPreference(MNodeCacheSetupInfo::kWantToCacheByDefault, true);
+
+};
 
 
 const MObject OrientationConstraint::targetAttribute() const
@@ -347,6 +565,26 @@ Use this function to define any static attributes.
 
 	CHECK_MSTATUS(fnNumericAttr.addToCategory(OrientationConstraint::inputCategory));
 
+	// ".blendMode" attribute
+	//
+	OrientationConstraint::blendMode = fnEnumAttr.create("blendMode", "bm", short(0), &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnEnumAttr.addField("Slerp", 0));
+	CHECK_MSTATUS(fnEnumAttr.addField("Dual Quaternion", 1));
+	CHECK_MSTATUS(fnEnumAttr.addToCategory(OrientationConstraint::inputCategory));
+
+	// ".slerpPrecision" attribute
+	// The default is always exact so saved scenes evaluate the same regardless of the global slerp precision!
+	//
+	OrientationConstraint::slerpPrecision = fnEnumAttr.create("slerpPrecision", "sp", short(Maxformations::SlerpPrecision::Exact), &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnEnumAttr.addField("Exact", 0));
+	CHECK_MSTATUS(fnEnumAttr.addField("Polynomial", 1));
+	CHECK_MSTATUS(fnEnumAttr.addField("Nlerp", 2));
+	CHECK_MSTATUS(fnEnumAttr.addToCategory(OrientationConstraint::inputCategory));
+
 	// ".offsetRotateX" attribute
 	//
 	OrientationConstraint::offsetRotateX = fnUnitAttr.create("offsetRotateX", "orx", MFnUnitAttribute::kAngle, 0.0, &status);
@@ -588,10 +826,21 @@ Use this function to define any static attributes.
 	CHECK_MSTATUS(fnMatrixAttr.setStorable(false));
 	CHECK_MSTATUS(fnMatrixAttr.addToCategory(OrientationConstraint::outputCategory));
 
+	// ".evaluatedTargets" attribute
+	//
+	OrientationConstraint::evaluatedTargets = fnNumericAttr.create("evaluatedTargets", "evt", MFnNumericData::kInt, 0, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnNumericAttr.setWritable(false));
+	CHECK_MSTATUS(fnNumericAttr.setStorable(false));
+	CHECK_MSTATUS(fnNumericAttr.addToCategory(OrientationConstraint::outputCategory));
+
 	// Add attributes
 	//
 	CHECK_MSTATUS(OrientationConstraint::addAttribute(OrientationConstraint::localOrWorld));
 	CHECK_MSTATUS(OrientationConstraint::addAttribute(OrientationConstraint::relative));
+	CHECK_MSTATUS(OrientationConstraint::addAttribute(OrientationConstraint::blendMode));
+	CHECK_MSTATUS(OrientationConstraint::addAttribute(OrientationConstraint::slerpPrecision));
 	CHECK_MSTATUS(OrientationConstraint::addAttribute(OrientationConstraint::offsetRotate));
 	CHECK_MSTATUS(OrientationConstraint::addAttribute(OrientationConstraint::restRotate));
 	CHECK_MSTATUS(OrientationConstraint::addAttribute(OrientationConstraint::target));
@@ -602,31 +851,87 @@ Use this function to define any static attributes.
 	CHECK_MSTATUS(OrientationConstraint::addAttribute(OrientationConstraint::constraintWorldMatrix));
 	CHECK_MSTATUS(OrientationConstraint::addAttribute(OrientationConstraint::constraintWorldInverseMatrix));
 	CHECK_MSTATUS(OrientationConstraint::addAttribute(OrientationConstraint::constraintParentInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::addAttribute(OrientationConstraint::evaluatedTargets));
 
 	// Define attribute relationships
 	//
-	MObjectArray inputs, outputs;
-
-	status = Maxformations::getAttributesByCategory(OrientationConstraint::id, OrientationConstraint::inputCategory, inputs);
-	CHECK_MSTATUS_AND_RETURN_IT(status);
-
-	status = Maxformations::getAttributesByCategory(OrientationConstraint::id, OrientationConstraint::outputCategory, outputs);
-	CHECK_MSTATUS_AND_RETURN_IT(status);
-
-	unsigned int inputCount = inputs.length();
-	unsigned int outputCount = outputs.length();
-
-	for (unsigned int i = 0; i < inputCount; i++)
-	{
-
-		for (unsigned int j = 0; j < outputCount; j++)
-		{
-
-			CHECK_MSTATUS(OrientationConstraint::attributeAffects(inputs[i], outputs[j]));
-
-		}
-
-	}
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::localOrWorld, OrientationConstraint::constraintRotate));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::relative, OrientationConstraint::constraintRotate));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::offsetRotate, OrientationConstraint::constraintRotate));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::enableRestPosition, OrientationConstraint::constraintRotate));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::restRotate, OrientationConstraint::constraintRotate));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::constraintRotateOrder, OrientationConstraint::constraintRotate));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::constraintParentInverseMatrix, OrientationConstraint::constraintRotate));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::blendMode, OrientationConstraint::constraintRotate));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::slerpPrecision, OrientationConstraint::constraintRotate));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::target, OrientationConstraint::constraintRotate));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::targetWeight, OrientationConstraint::constraintRotate));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::targetMatrix, OrientationConstraint::constraintRotate));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::targetParentMatrix, OrientationConstraint::constraintRotate));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::targetOffsetRotate, OrientationConstraint::constraintRotate));
+
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::localOrWorld, OrientationConstraint::constraintMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::relative, OrientationConstraint::constraintMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::offsetRotate, OrientationConstraint::constraintMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::enableRestPosition, OrientationConstraint::constraintMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::restRotate, OrientationConstraint::constraintMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::constraintRotateOrder, OrientationConstraint::constraintMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::constraintParentInverseMatrix, OrientationConstraint::constraintMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::blendMode, OrientationConstraint::constraintMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::slerpPrecision, OrientationConstraint::constraintMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::target, OrientationConstraint::constraintMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::targetWeight, OrientationConstraint::constraintMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::targetMatrix, OrientationConstraint::constraintMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::targetParentMatrix, OrientationConstraint::constraintMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::targetOffsetRotate, OrientationConstraint::constraintMatrix));
+
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::localOrWorld, OrientationConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::relative, OrientationConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::offsetRotate, OrientationConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::enableRestPosition, OrientationConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::restRotate, OrientationConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::constraintRotateOrder, OrientationConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::constraintParentInverseMatrix, OrientationConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::blendMode, OrientationConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::slerpPrecision, OrientationConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::target, OrientationConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::targetWeight, OrientationConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::targetMatrix, OrientationConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::targetParentMatrix, OrientationConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::targetOffsetRotate, OrientationConstraint::constraintInverseMatrix));
+
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::localOrWorld, OrientationConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::relative, OrientationConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::offsetRotate, OrientationConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::enableRestPosition, OrientationConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::restRotate, OrientationConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::constraintRotateOrder, OrientationConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::constraintParentInverseMatrix, OrientationConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::blendMode, OrientationConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::slerpPrecision, OrientationConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::target, OrientationConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::targetWeight, OrientationConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::targetMatrix, OrientationConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::targetParentMatrix, OrientationConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::targetOffsetRotate, OrientationConstraint::constraintWorldMatrix));
+
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::localOrWorld, OrientationConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::relative, OrientationConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::offsetRotate, OrientationConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::enableRestPosition, OrientationConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::restRotate, OrientationConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::constraintRotateOrder, OrientationConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::constraintParentInverseMatrix, OrientationConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::blendMode, OrientationConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::slerpPrecision, OrientationConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::target, OrientationConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::targetWeight, OrientationConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::targetMatrix, OrientationConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::targetParentMatrix, OrientationConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::targetOffsetRotate, OrientationConstraint::constraintWorldInverseMatrix));
+
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::target, OrientationConstraint::evaluatedTargets));
+	CHECK_MSTATUS(OrientationConstraint::attributeAffects(OrientationConstraint::targetWeight, OrientationConstraint::evaluatedTargets));
 
 	return MS::kSuccess;
 
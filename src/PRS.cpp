@@ -7,6 +7,7 @@
 //
 
 #include "PRS.h"
+#include "MaxformEvaluator.h"
 
 MObject	PRS::position;
 MObject	PRS::x_position;
@@ -55,6 +56,9 @@ Only these values should be used when performing computations!
 
 	MStatus status;
 
+	MAXFORM_PROFILE_COMPUTE("PRS::compute", this->thisMObject());
+	MaxformEvaluator::recordCompute(this->thisMObject());
+
 	// Evaluate requested plug
 	//
 	if (plug == PRS::value)
@@ -107,9 +111,8 @@ Only these values should be used when performing computations!
 		double yRotation = yRotationHandle.asAngle().asRadians();
 		double zRotation = zRotationHandle.asAngle().asRadians();
 
-		unsigned int axisOrder = axisOrderHandle.asShort();
-		MTransformationMatrix::RotationOrder rotationOrder = MTransformationMatrix::RotationOrder(axisOrder + 1);
-		double3 eulerAngles = { xRotation, yRotation, zRotation };
+		MVector rotation = MVector(xRotation, yRotation, zRotation);
+		short axisOrder = axisOrderHandle.asShort();
 
 		// Get orientation value
 		//
@@ -117,8 +120,7 @@ Only these values should be used when performing computations!
 		double yOrientation = yOrientationHandle.asAngle().asRadians();
 		double zOrientation = zOrientationHandle.asAngle().asRadians();
 
-		MEulerRotation::RotationOrder rotateOrder = MEulerRotation::RotationOrder(axisOrder);
-		MQuaternion orientation = MEulerRotation(xOrientation, yOrientation, zOrientation, rotateOrder).asQuaternion();
+		MVector orientation = MVector(xOrientation, yOrientation, zOrientation);
 
 		// Get scale value
 		//
@@ -126,17 +128,11 @@ Only these values should be used when performing computations!
 		double yScale = yScaleHandle.asDouble();
 		double zScale = zScaleHandle.asDouble();
 
-		double3 scale = { xScale, yScale, zScale };
+		MVector scale = MVector(xScale, yScale, zScale);
 		
 		// Compose transform matrix
 		//
-		MTransformationMatrix transform = MTransformationMatrix(MMatrix::identity);
-		transform.setTranslation(position, MSpace::kTransform);
-		transform.setRotation(eulerAngles, rotationOrder);
-		transform.setRotationOrientation(orientation);
-		transform.setScale(scale, MSpace::kTransform);
-
-		MObject transformData = Maxformations::createMatrixData(transform);
+		MTransformationMatrix transform = PRS::createTransform(position, rotation, orientation, scale, axisOrder);
 
 		// Get output data handles
 		//
@@ -144,8 +140,11 @@ Only these values should be used when performing computations!
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
 		// Update output data handles
+		// If possible, reuse the existing matrix data rather than allocating a new data object each evaluation
 		//
-		valueHandle.setMObject(transformData);
+		status = Maxformations::setMatrixData(valueHandle, transform);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
 		valueHandle.setClean();
 
 		// Mark plug as clean
@@ -166,6 +165,39 @@ Only these values should be used when performing computations!
 };
 
 
+
+MTransformationMatrix PRS::createTransform(const MVector& position, const MVector& rotation, const MVector& orientation, const MVector& scale, const short axisOrder)
+/**
+Returns a transformation matrix composed from the supplied PRS values.
+The components are kept intact since the maxform relies on the rotation orientation!
+
+@param position: The position in centimeters.
+@param rotation: The euler rotation in radians.
+@param orientation: The euler orientation in radians.
+@param scale: The scale.
+@param axisOrder: The axis order for both the rotation and orientation.
+@return: The transformation matrix.
+*/
+{
+
+	MTransformationMatrix::RotationOrder rotationOrder = MTransformationMatrix::RotationOrder(axisOrder + 1);
+	double3 eulerAngles = { rotation.x, rotation.y, rotation.z };
+
+	MEulerRotation::RotationOrder rotateOrder = MEulerRotation::RotationOrder(axisOrder);
+	MQuaternion rotationOrientation = MEulerRotation(orientation.x, orientation.y, orientation.z, rotateOrder).asQuaternion();
+
+	double3 scaleValues = { scale.x, scale.y, scale.z };
+
+	MTransformationMatrix transform;
+	transform.setTranslation(position, MSpace::kTransform);
+	transform.setRotation(eulerAngles, rotationOrder);
+	transform.setRotationOrientation(rotationOrientation);
+	transform.setScale(scaleValues, MSpace::kTransform);
+
+	return transform;
+
+};
+
 bool PRS::isAbstractClass() const
 /**
 Override this class to return true if this node is an abstract node.
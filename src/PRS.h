@@ -45,6 +45,8 @@ public:
 	static  void*		creator();
 	static  MStatus		initialize();
 
+	static	MTransformationMatrix	createTransform(const MVector& position, const MVector& rotation, const MVector& orientation, const MVector& scale, const short axisOrder);
+
 public:
 
 	static	MObject		position;
@@ -23,6 +23,8 @@ MObject PathConstraint::worldUpVectorY;
 MObject PathConstraint::worldUpVectorZ;
 MObject PathConstraint::worldUpMatrix;
 MObject PathConstraint::relative;
+MObject PathConstraint::blendMode;
+MObject PathConstraint::slerpPrecision;
 MObject PathConstraint::offsetTranslate;
 MObject PathConstraint::offsetTranslateX;
 MObject PathConstraint::offsetTranslateY;
@@ -58,6 +60,7 @@ MObject PathConstraint::constraintInverseMatrix;
 MObject PathConstraint::constraintWorldMatrix;
 MObject PathConstraint::constraintWorldInverseMatrix;
 MObject PathConstraint::constraintParentInverseMatrix;
+MObject PathConstraint::evaluatedTargets;
 
 MString	PathConstraint::inputCategory("Input");
 MString	PathConstraint::offsetCategory("Offset");
@@ -90,6 +93,8 @@ Only these values should be used when performing computations!
 
 	MStatus status;
 
+	MAXFORM_PROFILE_COMPUTE("PathConstraint::compute", this->thisMObject());
+
 	// Check requested attribute
 	//
 	MObject attribute = plug.attribute(&status);
@@ -101,270 +106,460 @@ Only these values should be used when performing computations!
 	if (fnAttribute.hasCategory(PathConstraint::outputCategory))
 	{
 
-		// Get input data handles
+		// Get constraint matrices
+		// Any subsequent output requests within the same evaluation are derived from the cached matrices!
 		//
-		MDataHandle percentHandle = data.inputValue(PathConstraint::percent, &status);
+		MDGContext context = data.context(&status);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle loopHandle = data.inputValue(PathConstraint::loop, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		MMatrix constraintMatrix, constraintWorldMatrix;
+		bool isCached = this->cache.get(context, constraintMatrix, constraintWorldMatrix);
+		MAXFORM_RECORD_CACHE_ACCESS(isCached);
 
-		MDataHandle forwardAxisHandle = data.inputValue(PathConstraint::forwardAxis, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		if (!isCached)
+		{
 
-		MDataHandle forwardAxisFlipHandle = data.inputValue(PathConstraint::forwardAxisFlip, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			status = this->computeMatrices(data, constraintMatrix, constraintWorldMatrix);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle twistHandle = data.inputValue(PathConstraint::twist, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			this->cache.set(context, constraintMatrix, constraintWorldMatrix);
 
-		MDataHandle upAxisHandle = data.inputValue(PathConstraint::upAxis, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		}
 
-		MDataHandle upAxisFlipHandle = data.inputValue(PathConstraint::upAxisFlip, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		// Update requested output
+		//
+		MObject output = plug.isChild() ? plug.parent().attribute() : attribute;
 
-		MDataHandle worldUpTypeHandle = data.inputValue(PathConstraint::worldUpType, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		if (output == PathConstraint::constraintTranslate)
+		{
 
-		MDataHandle worldUpVectorHandle = data.inputValue(PathConstraint::worldUpVector, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			MDataHandle constraintTranslateXHandle = data.outputValue(PathConstraint::constraintTranslateX, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle worldUpMatrixHandle = data.inputValue(PathConstraint::worldUpMatrix, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			MDataHandle constraintTranslateYHandle = data.outputValue(PathConstraint::constraintTranslateY, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle relativeHandle = data.inputValue(PathConstraint::relative, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			MDataHandle constraintTranslateZHandle = data.outputValue(PathConstraint::constraintTranslateZ, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle offsetTranslateHandle = data.inputValue(PathConstraint::offsetTranslate, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			MVector constraintTranslate = Maxformations::matrixToPosition(constraintMatrix);
 
-		MDataHandle offsetRotateHandle = data.inputValue(PathConstraint::offsetRotate, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			constraintTranslateXHandle.setMDistance(MDistance(constraintTranslate.x, MDistance::kCentimeters));
+			constraintTranslateYHandle.setMDistance(MDistance(constraintTranslate.y, MDistance::kCentimeters));
+			constraintTranslateZHandle.setMDistance(MDistance(constraintTranslate.z, MDistance::kCentimeters));
 
-		MDataHandle enableRestPositionHandle = data.inputValue(PathConstraint::enableRestPosition, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			constraintTranslateXHandle.setClean();
+			constraintTranslateYHandle.setClean();
+			constraintTranslateZHandle.setClean();
 
-		MDataHandle restTranslateHandle = data.inputValue(PathConstraint::restTranslate, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		}
+		else if (output == PathConstraint::constraintRotate)
+		{
 
-		MDataHandle restRotateHandle = data.inputValue(PathConstraint::restRotate, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			MDataHandle constraintRotateOrderHandle = data.inputValue(PathConstraint::constraintRotateOrder, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle constraintRotateOrderHandle = data.inputValue(PathConstraint::constraintRotateOrder, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			MDataHandle constraintRotateXHandle = data.outputValue(PathConstraint::constraintRotateX, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle constraintParentInverseMatrixHandle = data.inputValue(PathConstraint::constraintParentInverseMatrix, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			MDataHandle constraintRotateYHandle = data.outputValue(PathConstraint::constraintRotateY, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MArrayDataHandle targetArrayHandle = data.inputArrayValue(PathConstraint::target, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			MDataHandle constraintRotateZHandle = data.outputValue(PathConstraint::constraintRotateZ, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		// Get values from handles
-		//
-		double percentage = percentHandle.asDouble();
-		double fraction = percentage / 100.0;
-		bool looping = loopHandle.asBool();
-
-		WorldUpType worldUpType = WorldUpType(worldUpTypeHandle.asShort());
-		MVector worldUpVector = worldUpVectorHandle.asVector();
-		MMatrix worldUpMatrix = worldUpMatrixHandle.asMatrix();
-		WorldUpSettings worldUpSettings = { worldUpType, worldUpVector, worldUpMatrix };
-
-		int forwardAxis = forwardAxisHandle.asShort();
-		bool forwardAxisFlip = forwardAxisFlipHandle.asBool();
-		int upAxis = upAxisHandle.asShort();
-		bool upAxisFlip = upAxisFlipHandle.asBool();
-		MAngle twistAngle = twistHandle.asAngle();
-		AxisSettings axisSettings = { forwardAxis, forwardAxisFlip, upAxis, upAxisFlip, twistAngle, worldUpSettings };
-
-		MEulerRotation::RotationOrder constraintRotateOrder = MEulerRotation::RotationOrder(constraintRotateOrderHandle.asShort());
-		MMatrix constraintParentInverseMatrix = constraintParentInverseMatrixHandle.asMatrix();
-		MMatrix constraintParentMatrix = constraintParentInverseMatrix.inverse();
-
-		bool relative = relativeHandle.asBool();
-		MVector offsetTranslate = offsetTranslateHandle.asVector();
-		MMatrix offsetTranslateMatrix = Maxformations::createPositionMatrix(offsetTranslate);
-		MVector offsetRotate = offsetRotateHandle.asVector();
-		MMatrix offsetRotateMatrix = Maxformations::createRotationMatrix(offsetRotate);
-		MMatrix offsetMatrix = relative ? (offsetRotateMatrix * offsetTranslateMatrix) : MMatrix::identity;
-
-		bool restEnabled = enableRestPositionHandle.asBool();
-		MVector restTranslate = restTranslateHandle.asVector();
-		MMatrix restTranslateMatrix = Maxformations::createPositionMatrix(restTranslate);
-		MVector restRotate = restRotateHandle.asVector();
-		MMatrix restRotateMatrix = Maxformations::createRotationMatrix(restRotate, constraintRotateOrder);
-		MMatrix restMatrix = restEnabled ? (restRotateMatrix * restTranslateMatrix) : MMatrix::identity;
-		MMatrix restWorldMatrix = restMatrix * constraintParentMatrix;
-
-		// Create forward twist matrix
-		//
-		MMatrix twistMatrix;
+			MEulerRotation::RotationOrder constraintRotateOrder = MEulerRotation::RotationOrder(constraintRotateOrderHandle.asShort());
+			MEulerRotation constraintRotate = Maxformations::matrixToEulerRotation(constraintMatrix, constraintRotateOrder);
 
-		status = Maxformations::createTwistMatrix(forwardAxis, twistAngle, twistMatrix);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			constraintRotateXHandle.setMAngle(MAngle(constraintRotate.x, MAngle::kRadians));
+			constraintRotateYHandle.setMAngle(MAngle(constraintRotate.y, MAngle::kRadians));
+			constraintRotateZHandle.setMAngle(MAngle(constraintRotate.z, MAngle::kRadians));
 
-		// Initialize target matrices
-		//
-		unsigned int targetCount = targetArrayHandle.elementCount();
+			constraintRotateXHandle.setClean();
+			constraintRotateYHandle.setClean();
+			constraintRotateZHandle.setClean();
 
-		MFloatArray targetWeights = MFloatArray(targetCount);
-		MMatrixArray targetMatrices = MMatrixArray(targetCount);
+		}
+		else if (output == PathConstraint::constraintMatrix)
+		{
 
-		// Iterate through targets
-		//
-		MDataHandle targetHandle, targetWeightHandle, targetCurveHandle;
+			MDataHandle constraintMatrixHandle = data.outputValue(PathConstraint::constraintMatrix, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MObject curve;
-		MFnNurbsCurve fnCurve;
-		double curveLength, fractionalLength, parameter;
-		MPoint position;
-		MVector forwardVector, upVector;
-		MMatrix targetMatrix;
+			constraintMatrixHandle.setMMatrix(constraintMatrix);
+			constraintMatrixHandle.setClean();
 
-		for (unsigned int i = 0; i < targetCount; i++)
+		}
+		else if (output == PathConstraint::constraintInverseMatrix)
 		{
 
-			// Jump to array element
-			//
-			status = targetArrayHandle.jumpToArrayElement(i);
-			CHECK_MSTATUS_AND_RETURN_IT(status);
-
-			targetHandle = targetArrayHandle.inputValue(&status);
+			MDataHandle constraintInverseMatrixHandle = data.outputValue(PathConstraint::constraintInverseMatrix, &status);
 			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-			// Get target data handles
-			//
-			targetWeightHandle = targetHandle.child(PathConstraint::targetWeight);
-			targetCurveHandle = targetHandle.child(PathConstraint::targetCurve);
-
-			// Get weight value
-			//
-			targetWeights[i] = Maxformations::clamp(targetWeightHandle.asFloat(), 0.0f, 100.0f) / 100.0;
+			constraintInverseMatrixHandle.setMMatrix(Maxformations::invertMatrix(constraintMatrix));
+			constraintInverseMatrixHandle.setClean();
 
-			// Get curve length
-			//
-			curve = targetCurveHandle.asNurbsCurve();
+		}
+		else if (output == PathConstraint::constraintWorldMatrix)
+		{
 
-			status = fnCurve.setObject(curve);
+			MDataHandle constraintWorldMatrixHandle = data.outputValue(PathConstraint::constraintWorldMatrix, &status);
 			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-			curveLength = fnCurve.length(1e-3, &status);
-			CHECK_MSTATUS_AND_RETURN_IT(status);
+			constraintWorldMatrixHandle.setMMatrix(constraintWorldMatrix);
+			constraintWorldMatrixHandle.setClean();
 
-			// Find parameter from percentage
-			//
-			if (looping)
-			{
+		}
+		else if (output == PathConstraint::constraintWorldInverseMatrix)
+		{
 
-				fraction = Maxformations::loop(fraction, 0.0, 1.0);
-				
-			}
+			MDataHandle constraintWorldInverseMatrixHandle = data.outputValue(PathConstraint::constraintWorldInverseMatrix, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-			fractionalLength = fraction * curveLength;
+			constraintWorldInverseMatrixHandle.setMMatrix(Maxformations::invertMatrix(constraintWorldMatrix));
+			constraintWorldInverseMatrixHandle.setClean();
 
-			parameter = fnCurve.findParamFromLength(fractionalLength, &status);
-			CHECK_MSTATUS_AND_RETURN_IT(status);
+		}
+		else if (output == PathConstraint::evaluatedTargets)
+		{
 
-			// Create matrix from curve
+			// The evaluated target count is written alongside the constraint matrices
 			//
-			status = PathConstraint::createMatrixFromCurve(curve, parameter, axisSettings, targetMatrix);
+			MDataHandle evaluatedTargetsHandle = data.outputValue(PathConstraint::evaluatedTargets, &status);
 			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-			targetMatrices[i] = targetMatrix;
+			evaluatedTargetsHandle.setClean();
 
 		}
+		else
+		{
 
-		// Calculate weighted constraint matrix
-		//
-		MMatrix matrix = Maxformations::blendMatrices(restWorldMatrix, targetMatrices, targetWeights);
+			return MS::kUnknownParameter;
 
-		MMatrix constraintWorldMatrix = offsetMatrix * matrix;
-		MMatrix constraintMatrix = constraintWorldMatrix * constraintParentInverseMatrix;
+		}
 
-		// Get output data handles
+		// Mark data block as clean
 		//
-		MDataHandle constraintTranslateXHandle = data.outputValue(PathConstraint::constraintTranslateX, &status);
+		status = data.setClean(plug);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle constraintTranslateYHandle = data.outputValue(PathConstraint::constraintTranslateY, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		return MS::kSuccess;
 
-		MDataHandle constraintTranslateZHandle = data.outputValue(PathConstraint::constraintTranslateZ, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+	}
+	else
+	{
 
-		MDataHandle constraintRotateXHandle = data.outputValue(PathConstraint::constraintRotateX, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		return MS::kUnknownParameter;
 
-		MDataHandle constraintRotateYHandle = data.outputValue(PathConstraint::constraintRotateY, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+	}
 
-		MDataHandle constraintRotateZHandle = data.outputValue(PathConstraint::constraintRotateZ, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+};
 
-		MDataHandle constraintMatrixHandle = data.outputValue(PathConstraint::constraintMatrix, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle constraintInverseMatrixHandle = data.outputValue(PathConstraint::constraintInverseMatrix, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+MStatus PathConstraint::computeMatrices(MDataBlock& data, MMatrix& constraintMatrix, MMatrix& constraintWorldMatrix)
+/**
+Computes the blended constraint matrices from the node's inputs.
+This is only called once per evaluation, see `compute` for how the individual outputs are derived.
+
+@param data: Data block containing storage for the node's attributes.
+@param constraintMatrix: The passed matrix to populate.
+@param constraintWorldMatrix: The passed world matrix to populate.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Get input data handles
+	//
+	MDataHandle percentHandle = data.inputValue(PathConstraint::percent, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle loopHandle = data.inputValue(PathConstraint::loop, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle forwardAxisHandle = data.inputValue(PathConstraint::forwardAxis, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle forwardAxisFlipHandle = data.inputValue(PathConstraint::forwardAxisFlip, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle twistHandle = data.inputValue(PathConstraint::twist, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle upAxisHandle = data.inputValue(PathConstraint::upAxis, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle upAxisFlipHandle = data.inputValue(PathConstraint::upAxisFlip, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle worldUpTypeHandle = data.inputValue(PathConstraint::worldUpType, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle worldUpVectorHandle = data.inputValue(PathConstraint::worldUpVector, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle worldUpMatrixHandle = data.inputValue(PathConstraint::worldUpMatrix, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle relativeHandle = data.inputValue(PathConstraint::relative, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle blendModeHandle = data.inputValue(PathConstraint::blendMode, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle slerpPrecisionHandle = data.inputValue(PathConstraint::slerpPrecision, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle offsetTranslateHandle = data.inputValue(PathConstraint::offsetTranslate, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle offsetRotateHandle = data.inputValue(PathConstraint::offsetRotate, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle enableRestPositionHandle = data.inputValue(PathConstraint::enableRestPosition, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle restTranslateHandle = data.inputValue(PathConstraint::restTranslate, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle restRotateHandle = data.inputValue(PathConstraint::restRotate, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle constraintRotateOrderHandle = data.inputValue(PathConstraint::constraintRotateOrder, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle constraintParentInverseMatrixHandle = data.inputValue(PathConstraint::constraintParentInverseMatrix, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MArrayDataHandle targetArrayHandle = data.inputArrayValue(PathConstraint::target, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Get values from handles
+	//
+	double percentage = percentHandle.asDouble();
+	double fraction = percentage / 100.0;
+	bool looping = loopHandle.asBool();
+
+	WorldUpType worldUpType = WorldUpType(worldUpTypeHandle.asShort());
+	MVector worldUpVector = worldUpVectorHandle.asVector();
+	MMatrix worldUpMatrix = worldUpMatrixHandle.asMatrix();
+	WorldUpSettings worldUpSettings = { worldUpType, worldUpVector, worldUpMatrix };
+
+	int forwardAxis = forwardAxisHandle.asShort();
+	bool forwardAxisFlip = forwardAxisFlipHandle.asBool();
+	int upAxis = upAxisHandle.asShort();
+	bool upAxisFlip = upAxisFlipHandle.asBool();
+	MAngle twistAngle = twistHandle.asAngle();
+	AxisSettings axisSettings = { forwardAxis, forwardAxisFlip, upAxis, upAxisFlip, twistAngle, worldUpSettings };
+
+	MEulerRotation::RotationOrder constraintRotateOrder = MEulerRotation::RotationOrder(constraintRotateOrderHandle.asShort());
+	MMatrix constraintParentInverseMatrix = constraintParentInverseMatrixHandle.asMatrix();
+	MMatrix constraintParentMatrix = Maxformations::invertMatrix(constraintParentInverseMatrix);
+
+	bool relative = relativeHandle.asBool();
+	Maxformations::BlendMode blendMode = Maxformations::BlendMode(blendModeHandle.asShort());
+	Maxformations::SlerpPrecision precision = Maxformations::SlerpPrecision(slerpPrecisionHandle.asShort());
+	MVector offsetTranslate = offsetTranslateHandle.asVector();
+	MMatrix offsetTranslateMatrix = Maxformations::createPositionMatrix(offsetTranslate);
+	MVector offsetRotate = offsetRotateHandle.asVector();
+	MMatrix offsetRotateMatrix = Maxformations::createRotationMatrix(offsetRotate);
+	MMatrix offsetMatrix = relative ? (offsetRotateMatrix * offsetTranslateMatrix) : MMatrix::identity;
+
+	bool restEnabled = enableRestPositionHandle.asBool();
+	MVector restTranslate = restTranslateHandle.asVector();
+	MMatrix restTranslateMatrix = Maxformations::createPositionMatrix(restTranslate);
+	MVector restRotate = restRotateHandle.asVector();
+	MMatrix restRotateMatrix = Maxformations::createRotationMatrix(restRotate, constraintRotateOrder);
+	MMatrix restMatrix = restEnabled ? (restRotateMatrix * restTranslateMatrix) : MMatrix::identity;
+	MMatrix restWorldMatrix = restMatrix * constraintParentMatrix;
+
+	// Create forward twist matrix
+	//
+	MMatrix twistMatrix;
+
+	status = Maxformations::createTwistMatrix(forwardAxis, twistAngle, twistMatrix);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Initialize target matrices
+	//
+	unsigned int targetCount = targetArrayHandle.elementCount();
 
-		MDataHandle constraintWorldMatrixHandle = data.outputValue(PathConstraint::constraintWorldMatrix, &status);
+	MFloatArray targetWeights;
+	MMatrixArray targetMatrices;
+
+	float weight;
+
+	// Iterate through targets
+	//
+	MDataHandle targetHandle, targetWeightHandle, targetCurveHandle;
+
+	MObject curve;
+	MFnNurbsCurve fnCurve;
+	double curveLength, fractionalLength, parameter;
+	MPoint position;
+	MVector forwardVector, upVector;
+	MMatrix targetMatrix;
+
+	for (unsigned int i = 0; i < targetCount; i++)
+	{
+
+		// Jump to array element
+		//
+		status = targetArrayHandle.jumpToArrayElement(i);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle constraintWorldInverseMatrixHandle = data.outputValue(PathConstraint::constraintWorldInverseMatrix, &status);
+		targetHandle = targetArrayHandle.inputValue(&status);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		// Update constraint translation
+		// Get target data handles
 		//
-		MVector constraintTranslate = Maxformations::matrixToPosition(constraintMatrix);
+		targetWeightHandle = targetHandle.child(PathConstraint::targetWeight);
+		targetCurveHandle = targetHandle.child(PathConstraint::targetCurve);
 
-		constraintTranslateXHandle.setMDistance(MDistance(constraintTranslate.x, MDistance::kCentimeters));
-		constraintTranslateYHandle.setMDistance(MDistance(constraintTranslate.y, MDistance::kCentimeters));
-		constraintTranslateZHandle.setMDistance(MDistance(constraintTranslate.z, MDistance::kCentimeters));
+		// Get weight value
+		//
+		weight = Maxformations::clamp(targetWeightHandle.asFloat(), 0.0f, 100.0f) / 100.0;
+
+		if (weight == 0.0f)
+		{
+
+			continue;  // Skip targets that don't contribute!
 
-		constraintTranslateXHandle.setClean();
-		constraintTranslateYHandle.setClean();
-		constraintTranslateZHandle.setClean();
+		}
+
+		targetWeights.append(weight);
 
-		// Update constraint rotation
+		// Get curve length
 		//
-		MEulerRotation constraintRotate = Maxformations::matrixToEulerRotation(constraintMatrix, constraintRotateOrder);
+		curve = targetCurveHandle.asNurbsCurve();
 
-		constraintRotateXHandle.setMAngle(MAngle(constraintRotate.x, MAngle::kRadians));
-		constraintRotateYHandle.setMAngle(MAngle(constraintRotate.y, MAngle::kRadians));
-		constraintRotateZHandle.setMAngle(MAngle(constraintRotate.z, MAngle::kRadians));
+		status = fnCurve.setObject(curve);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		constraintRotateXHandle.setClean();
-		constraintRotateYHandle.setClean();
-		constraintRotateZHandle.setClean();
+		curveLength = fnCurve.length(1e-3, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		// Update constraint matrices
+		// Find parameter from percentage
 		//
-		constraintMatrixHandle.setMMatrix(constraintMatrix);
-		constraintInverseMatrixHandle.setMMatrix(constraintMatrix.inverse());
-		constraintWorldMatrixHandle.setMMatrix(constraintWorldMatrix);
-		constraintWorldInverseMatrixHandle.setMMatrix(constraintWorldMatrix.inverse());
+		if (looping)
+		{
+
+			fraction = Maxformations::loop(fraction, 0.0, 1.0);
+			
+		}
 
-		constraintMatrixHandle.setClean();
-		constraintInverseMatrixHandle.setClean();
-		constraintWorldMatrixHandle.setClean();
-		constraintWorldInverseMatrixHandle.setClean();
+		fractionalLength = fraction * curveLength;
 
-		// Mark data block as clean
+		parameter = fnCurve.findParamFromLength(fractionalLength, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		// Create matrix from curve
 		//
-		status = data.setClean(plug);
+		status = PathConstraint::createMatrixFromCurve(curve, parameter, axisSettings, targetMatrix);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		return MS::kSuccess;
+		targetMatrices.append(targetMatrix);
 
 	}
-	else
+
+	// Update evaluated target count
+	//
+	MDataHandle evaluatedTargetsHandle = data.outputValue(PathConstraint::evaluatedTargets, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	evaluatedTargetsHandle.setInt(int(targetWeights.length()));
+	evaluatedTargetsHandle.setClean();
+
+	// Calculate weighted constraint matrix
+	//
+	MMatrix matrix = Maxformations::blendMatrices(restWorldMatrix, targetMatrices, targetWeights, blendMode, precision);
+
+	constraintWorldMatrix = offsetMatrix * matrix;
+	constraintMatrix = constraintWorldMatrix * constraintParentInverseMatrix;
+
+	return MS::kSuccess;
+
+};
+
+
+MStatus PathConstraint::setDependentsDirty(const MPlug& plug, MPlugArray& plugArray)
+/**
+This method can be overridden in user defined nodes to specify which plugs should be set dirty based upon an input plug which Maya is marking dirty.
+Any input change invalidates the cached constraint matrices.
+
+@param plug: Plug which is being set dirty by Maya.
+@param plugArray: The programmer should add any plugs which they want to set dirty to this list.
+@return: Return status.
+*/
+{
+
+	this->cache.invalidate();
+
+	return MPxConstraint::setDependentsDirty(plug, plugArray);
+
+};
+
+
+MStatus PathConstraint::preEvaluation(const MDGContext& context, const MEvaluationNode& evaluationNode)
+/**
+Prepares the node for evaluation by the evaluation manager.
+Dirty propagation is skipped in this case so the cached constraint matrices are invalidated here instead.
+
+@param context: Context in which the evaluation will happen.
+@param evaluationNode: Evaluation node which contains information about the dirty plugs that are about to be evaluated.
+@return: Return status.
+*/
+{
+
+	if (context.isNormal())
 	{
 
-		return MS::kUnknownParameter;
+		this->cache.invalidate();
 
 	}
 
+	return MPxConstraint::preEvaluation(context, evaluationNode);
+
+};
+
+
+MPxNode::SchedulingType PathConstraint::schedulingType() const
+/**
+When overridden this method controls the degree of parallelism supported by the node during threaded evaluation.
+The scene up-axis is read from the cached value in Maxformations and the constraint matrices are guarded by their own lock, so this constraint can evaluate in parallel!
+
+@return: The scheduling type.
+*/
+{
+
+	return MPxNode::kParallel;
+
+};
+
+
+void PathConstraint::getCacheSetup(const MEvaluationNode& evaluationNode, MNodeCacheDisablingInfo& disablingInfo, MNodeCacheSetupInfo& cacheSetupInfo, MObjectArray& monitoredAttributes) const
+/**
+Provide node-specific setup info for the Cached Playback system.
+The cached constraint matrices are only trusted for normal contexts so background evaluations always recompute them!
+
+@param evaluationNode: This node's evaluation node, contains animated plug information.
+@param disablingInfo: Information about why the node disables Cached Playback to be reported to the user.
+@param cacheSetupInfo: Preferences and requirements this node has for Cached Playback.
+@param monitoredAttributes: Attributes impacting the behavior of this method that will be monitored for change.
+@return: void.
+*/
+{
+
+	// Call parent function
+	//
+	MPxConstraint::getCacheSetup(evaluationNode, disablingInfo, cacheSetupInfo, monitoredAttributes);
+	assert(!disablingInfo.getCacheDisabled());
+
+	// Update caching preference
+	//
+	cacheSetupInfo.setPreference(MNodeCacheSetupInfo::kWantToCacheByDefault, true);
+
 };
 
 
@@ -383,6 +578,8 @@ Samples the supplied curve at the specified parameter.
 
 	MStatus status;
 
+	MAXFORM_PROFILE_SOLVER("PathConstraint::createMatrixFromCurve");
+
 	// Get curve point
 	//
 	MPoint origin = MPoint::origin;
@@ -511,7 +708,7 @@ Returns the up vector based on the selected world up type.
 	case WorldUpType::SceneUp:
 	{
 
-		upVector = MGlobal::upAxis();
+		upVector = Maxformations::getSceneUpVector();
 
 	}
 	break;
@@ -839,6 +1036,26 @@ Use this function to define any static attributes.
 
 	CHECK_MSTATUS(fnNumericAttr.addToCategory(PathConstraint::inputCategory));
 
+	// ".blendMode" attribute
+	//
+	PathConstraint::blendMode = fnEnumAttr.create("blendMode", "bm", short(0), &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnEnumAttr.addField("Slerp", 0));
+	CHECK_MSTATUS(fnEnumAttr.addField("Dual Quaternion", 1));
+	CHECK_MSTATUS(fnEnumAttr.addToCategory(PathConstraint::inputCategory));
+
+	// ".slerpPrecision" attribute
+	// The default is always exact so saved scenes evaluate the same regardless of the global slerp precision!
+	//
+	PathConstraint::slerpPrecision = fnEnumAttr.create("slerpPrecision", "sp", short(Maxformations::SlerpPrecision::Exact), &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnEnumAttr.addField("Exact", 0));
+	CHECK_MSTATUS(fnEnumAttr.addField("Polynomial", 1));
+	CHECK_MSTATUS(fnEnumAttr.addField("Nlerp", 2));
+	CHECK_MSTATUS(fnEnumAttr.addToCategory(PathConstraint::inputCategory));
+
 	// ".offsetTranslateX" attribute
 	//
 	PathConstraint::offsetTranslateX = fnUnitAttr.create("offsetTranslateX", "otx", MFnUnitAttribute::kDistance, 0.0, &status);
@@ -1134,6 +1351,15 @@ Use this function to define any static attributes.
 	CHECK_MSTATUS(fnMatrixAttr.setStorable(false));
 	CHECK_MSTATUS(fnMatrixAttr.addToCategory(PathConstraint::outputCategory));
 
+	// ".evaluatedTargets" attribute
+	//
+	PathConstraint::evaluatedTargets = fnNumericAttr.create("evaluatedTargets", "evt", MFnNumericData::kInt, 0, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnNumericAttr.setWritable(false));
+	CHECK_MSTATUS(fnNumericAttr.setStorable(false));
+	CHECK_MSTATUS(fnNumericAttr.addToCategory(PathConstraint::outputCategory));
+
 	// Add attributes
 	//
 	CHECK_MSTATUS(PathConstraint::addAttribute(PathConstraint::percent));
@@ -1149,6 +1375,8 @@ Use this function to define any static attributes.
 	CHECK_MSTATUS(PathConstraint::addAttribute(PathConstraint::restTranslate));
 	CHECK_MSTATUS(PathConstraint::addAttribute(PathConstraint::restRotate));
 	CHECK_MSTATUS(PathConstraint::addAttribute(PathConstraint::relative));
+	CHECK_MSTATUS(PathConstraint::addAttribute(PathConstraint::blendMode));
+	CHECK_MSTATUS(PathConstraint::addAttribute(PathConstraint::slerpPrecision));
 	CHECK_MSTATUS(PathConstraint::addAttribute(PathConstraint::offsetTranslate));
 	CHECK_MSTATUS(PathConstraint::addAttribute(PathConstraint::offsetRotate));
 	CHECK_MSTATUS(PathConstraint::addAttribute(PathConstraint::target));
@@ -1160,31 +1388,154 @@ Use this function to define any static attributes.
 	CHECK_MSTATUS(PathConstraint::addAttribute(PathConstraint::constraintWorldMatrix));
 	CHECK_MSTATUS(PathConstraint::addAttribute(PathConstraint::constraintWorldInverseMatrix));
 	CHECK_MSTATUS(PathConstraint::addAttribute(PathConstraint::constraintParentInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::addAttribute(PathConstraint::evaluatedTargets));
 
 	// Define attribute relationships
-	//
-	MObjectArray inputs, outputs;
-
-	status = Maxformations::getAttributesByCategory(PathConstraint::id, PathConstraint::inputCategory, inputs);
-	CHECK_MSTATUS_AND_RETURN_IT(status);
-
-	status = Maxformations::getAttributesByCategory(PathConstraint::id, PathConstraint::outputCategory, outputs);
-	CHECK_MSTATUS_AND_RETURN_IT(status);
-
-	unsigned int inputCount = inputs.length();
-	unsigned int outputCount = outputs.length();
-
-	for (unsigned int i = 0; i < inputCount; i++)
-	{
-
-		for (unsigned int j = 0; j < outputCount; j++)
-		{
-
-			CHECK_MSTATUS(PathConstraint::attributeAffects(inputs[i], outputs[j]));
-
-		}
-
-	}
+	// The rest and offset translations only reach the translation outputs while the offset rotation only reaches the rotation outputs!
+	//
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::percent, PathConstraint::constraintTranslate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::loop, PathConstraint::constraintTranslate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::forwardAxis, PathConstraint::constraintTranslate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::forwardAxisFlip, PathConstraint::constraintTranslate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::twist, PathConstraint::constraintTranslate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::upAxis, PathConstraint::constraintTranslate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::upAxisFlip, PathConstraint::constraintTranslate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::worldUpType, PathConstraint::constraintTranslate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::worldUpVector, PathConstraint::constraintTranslate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::worldUpMatrix, PathConstraint::constraintTranslate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::relative, PathConstraint::constraintTranslate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::enableRestPosition, PathConstraint::constraintTranslate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::restRotate, PathConstraint::constraintTranslate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::constraintRotateOrder, PathConstraint::constraintTranslate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::constraintParentInverseMatrix, PathConstraint::constraintTranslate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::blendMode, PathConstraint::constraintTranslate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::slerpPrecision, PathConstraint::constraintTranslate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::target, PathConstraint::constraintTranslate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::targetWeight, PathConstraint::constraintTranslate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::targetCurve, PathConstraint::constraintTranslate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::offsetTranslate, PathConstraint::constraintTranslate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::restTranslate, PathConstraint::constraintTranslate));
+
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::percent, PathConstraint::constraintRotate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::loop, PathConstraint::constraintRotate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::forwardAxis, PathConstraint::constraintRotate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::forwardAxisFlip, PathConstraint::constraintRotate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::twist, PathConstraint::constraintRotate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::upAxis, PathConstraint::constraintRotate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::upAxisFlip, PathConstraint::constraintRotate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::worldUpType, PathConstraint::constraintRotate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::worldUpVector, PathConstraint::constraintRotate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::worldUpMatrix, PathConstraint::constraintRotate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::relative, PathConstraint::constraintRotate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::enableRestPosition, PathConstraint::constraintRotate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::restRotate, PathConstraint::constraintRotate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::constraintRotateOrder, PathConstraint::constraintRotate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::constraintParentInverseMatrix, PathConstraint::constraintRotate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::blendMode, PathConstraint::constraintRotate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::slerpPrecision, PathConstraint::constraintRotate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::target, PathConstraint::constraintRotate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::targetWeight, PathConstraint::constraintRotate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::targetCurve, PathConstraint::constraintRotate));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::offsetRotate, PathConstraint::constraintRotate));
+
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::percent, PathConstraint::constraintMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::loop, PathConstraint::constraintMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::forwardAxis, PathConstraint::constraintMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::forwardAxisFlip, PathConstraint::constraintMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::twist, PathConstraint::constraintMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::upAxis, PathConstraint::constraintMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::upAxisFlip, PathConstraint::constraintMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::worldUpType, PathConstraint::constraintMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::worldUpVector, PathConstraint::constraintMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::worldUpMatrix, PathConstraint::constraintMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::relative, PathConstraint::constraintMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::enableRestPosition, PathConstraint::constraintMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::restRotate, PathConstraint::constraintMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::constraintRotateOrder, PathConstraint::constraintMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::constraintParentInverseMatrix, PathConstraint::constraintMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::blendMode, PathConstraint::constraintMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::slerpPrecision, PathConstraint::constraintMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::target, PathConstraint::constraintMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::targetWeight, PathConstraint::constraintMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::targetCurve, PathConstraint::constraintMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::offsetTranslate, PathConstraint::constraintMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::restTranslate, PathConstraint::constraintMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::offsetRotate, PathConstraint::constraintMatrix));
+
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::percent, PathConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::loop, PathConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::forwardAxis, PathConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::forwardAxisFlip, PathConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::twist, PathConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::upAxis, PathConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::upAxisFlip, PathConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::worldUpType, PathConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::worldUpVector, PathConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::worldUpMatrix, PathConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::relative, PathConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::enableRestPosition, PathConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::restRotate, PathConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::constraintRotateOrder, PathConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::constraintParentInverseMatrix, PathConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::blendMode, PathConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::slerpPrecision, PathConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::target, PathConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::targetWeight, PathConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::targetCurve, PathConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::offsetTranslate, PathConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::restTranslate, PathConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::offsetRotate, PathConstraint::constraintInverseMatrix));
+
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::percent, PathConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::loop, PathConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::forwardAxis, PathConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::forwardAxisFlip, PathConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::twist, PathConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::upAxis, PathConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::upAxisFlip, PathConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::worldUpType, PathConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::worldUpVector, PathConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::worldUpMatrix, PathConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::relative, PathConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::enableRestPosition, PathConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::restRotate, PathConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::constraintRotateOrder, PathConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::constraintParentInverseMatrix, PathConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::blendMode, PathConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::slerpPrecision, PathConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::target, PathConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::targetWeight, PathConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::targetCurve, PathConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::offsetTranslate, PathConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::restTranslate, PathConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::offsetRotate, PathConstraint::constraintWorldMatrix));
+
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::percent, PathConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::loop, PathConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::forwardAxis, PathConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::forwardAxisFlip, PathConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::twist, PathConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::upAxis, PathConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::upAxisFlip, PathConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::worldUpType, PathConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::worldUpVector, PathConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::worldUpMatrix, PathConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::relative, PathConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::enableRestPosition, PathConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::restRotate, PathConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::constraintRotateOrder, PathConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::constraintParentInverseMatrix, PathConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::blendMode, PathConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::slerpPrecision, PathConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::target, PathConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::targetWeight, PathConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::targetCurve, PathConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::offsetTranslate, PathConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::restTranslate, PathConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::offsetRotate, PathConstraint::constraintWorldInverseMatrix));
+
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::target, PathConstraint::evaluatedTargets));
+	CHECK_MSTATUS(PathConstraint::attributeAffects(PathConstraint::targetWeight, PathConstraint::evaluatedTargets));
 	
 	return status;
 
@@ -14,6 +14,12 @@
 #include <maya/MDataHandle.h>
 #include <maya/MArrayDataHandle.h>
 #include <maya/MPlug.h>
+#include <maya/MPlugArray.h>
+#include <maya/MDGContext.h>
+#include <maya/MEvaluationNode.h>
+#include <maya/MNodeCacheDisablingInfo.h>
+#include <maya/MNodeCacheSetupInfo.h>
+#include <maya/MObjectArray.h>
 #include <maya/MDistance.h>
 #include <maya/MAngle.h>
 #include <maya/MQuaternion.h>
@@ -37,6 +43,8 @@
 
 #include "Maxformations.h"
 
+#include <assert.h>
+
 
 enum class WorldUpType
 {
@@ -82,6 +90,12 @@ public:
 	virtual				~PathConstraint();
 
 	virtual MStatus		compute(const MPlug& plug, MDataBlock& data);
+	virtual	MStatus		setDependentsDirty(const MPlug& plug, MPlugArray& plugArray);
+	virtual	MStatus		preEvaluation(const MDGContext& context, const MEvaluationNode& evaluationNode);
+	virtual	SchedulingType	schedulingType() const;
+	virtual	void		getCacheSetup(const MEvaluationNode& evaluationNode, MNodeCacheDisablingInfo& disablingInfo, MNodeCacheSetupInfo& cacheSetupInfo, MObjectArray& monitoredAttributes) const;
+
+			MStatus		computeMatrices(MDataBlock& data, MMatrix& constraintMatrix, MMatrix& constraintWorldMatrix);
 
 	static  void*		creator();
 	static  MStatus		initialize();
@@ -114,6 +128,8 @@ public:
 	static  MObject		worldUpVectorZ;
 	static  MObject		worldUpMatrix;
 	static	MObject		relative;
+	static	MObject		blendMode;
+	static	MObject		slerpPrecision;
 	static	MObject		offsetTranslate;
 	static	MObject		offsetTranslateX;
 	static	MObject		offsetTranslateY;
@@ -149,6 +165,7 @@ public:
 	static	MObject		constraintWorldMatrix;
 	static	MObject		constraintWorldInverseMatrix;
 	static	MObject		constraintParentInverseMatrix;
+	static	MObject		evaluatedTargets;
 
 public:
 
@@ -162,6 +179,10 @@ public:
 
 	static	MTypeId		id;
 
+protected:
+
+	Maxformations::ConstraintCache	cache;
+
 };
 
 #endif
\ No newline at end of file
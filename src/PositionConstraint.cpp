@@ -10,6 +10,7 @@
 
 
 MObject PositionConstraint::relative;
+MObject PositionConstraint::blendMode;
 MObject PositionConstraint::offsetTranslate;
 MObject PositionConstraint::offsetTranslateX;
 MObject PositionConstraint::offsetTranslateY;
@@ -37,6 +38,7 @@ MObject PositionConstraint::constraintInverseMatrix;
 MObject PositionConstraint::constraintWorldMatrix;
 MObject PositionConstraint::constraintWorldInverseMatrix;
 MObject PositionConstraint::constraintParentInverseMatrix;
+MObject PositionConstraint::evaluatedTargets;
 
 MString	PositionConstraint::inputCategory("Input");
 MString	PositionConstraint::offsetCategory("Offset");
@@ -69,6 +71,8 @@ Only these values should be used when performing computations!
 
 	MStatus status;
 
+	MAXFORM_PROFILE_COMPUTE("PositionConstraint::compute", this->thisMObject());
+
 	// Check requested attribute
 	//
 	MObject attribute = plug.attribute(&status);
@@ -80,175 +84,357 @@ Only these values should be used when performing computations!
 	if (fnAttribute.hasCategory(PositionConstraint::outputCategory))
 	{
 
-		// Get input data handles
+		// Get constraint matrices
+		// Any subsequent output requests within the same evaluation are derived from the cached matrices!
 		//
-		MDataHandle relativeHandle = data.inputValue(PositionConstraint::relative, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
-
-		MDataHandle offsetTranslateHandle = data.inputValue(PositionConstraint::offsetTranslate, &status);
+		MDGContext context = data.context(&status);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle localOrWorldHandle = data.inputValue(PositionConstraint::localOrWorld, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		MMatrix constraintMatrix, constraintWorldMatrix;
+		bool isCached = this->cache.get(context, constraintMatrix, constraintWorldMatrix);
+		MAXFORM_RECORD_CACHE_ACCESS(isCached);
 
-		MDataHandle enableRestPositionHandle = data.inputValue(PositionConstraint::enableRestPosition, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		if (!isCached)
+		{
 
-		MDataHandle restTranslateHandle = data.inputValue(PositionConstraint::restTranslate, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			status = this->computeMatrices(data, constraintMatrix, constraintWorldMatrix);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle constraintParentInverseMatrixHandle = data.inputValue(PositionConstraint::constraintParentInverseMatrix, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+			this->cache.set(context, constraintMatrix, constraintWorldMatrix);
 
-		MArrayDataHandle targetArrayHandle = data.inputArrayValue(PositionConstraint::target, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		}
 
-		// Get values from handles
+		// Update requested output
 		//
-		bool localOrWorld = localOrWorldHandle.asBool();
-		bool relative = relativeHandle.asBool();
-		MVector offsetTranslate = offsetTranslateHandle.asVector();
-		MMatrix offsetMatrix = relative ? Maxformations::createPositionMatrix(offsetTranslate) : MMatrix::identity;
+		MObject output = plug.isChild() ? plug.parent().attribute() : attribute;
+
+		if (output == PositionConstraint::constraintTranslate)
+		{
+
+			MDataHandle constraintTranslateXHandle = data.outputValue(PositionConstraint::constraintTranslateX, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MMatrix constraintParentInverseMatrix = constraintParentInverseMatrixHandle.asMatrix();
-		MMatrix constraintParentMatrix = constraintParentInverseMatrix.inverse();
+			MDataHandle constraintTranslateYHandle = data.outputValue(PositionConstraint::constraintTranslateY, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		bool restEnabled = enableRestPositionHandle.asBool();
-		MVector restTranslate = restTranslateHandle.asVector();
-		MMatrix restTranslateMatrix = Maxformations::createPositionMatrix(restTranslate);
-		MMatrix restMatrix = restEnabled ? restTranslateMatrix : MMatrix::identity;
-		MMatrix restWorldMatrix = restTranslateMatrix * constraintParentMatrix;
+			MDataHandle constraintTranslateZHandle = data.outputValue(PositionConstraint::constraintTranslateZ, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		// Collect target matrices
-		//
-		unsigned int targetCount = targetArrayHandle.elementCount();
+			MVector constraintTranslate = Maxformations::matrixToPosition(constraintMatrix);
 
-		MFloatArray targetWeights = MFloatArray(targetCount);
-		MMatrixArray targetMatrices = MMatrixArray(targetCount);
-		MMatrixArray targetWorldMatrices = MMatrixArray(targetCount);
+			constraintTranslateXHandle.setMDistance(MDistance(constraintTranslate.x, MDistance::kCentimeters));
+			constraintTranslateYHandle.setMDistance(MDistance(constraintTranslate.y, MDistance::kCentimeters));
+			constraintTranslateZHandle.setMDistance(MDistance(constraintTranslate.z, MDistance::kCentimeters));
 
-		MDataHandle targetHandle, targetWeightHandle, targetMatrixHandle, targetParentMatrixHandle, targetOffsetTranslateHandle;
-		MVector targetOffsetTranslate;
-		MMatrix targetMatrix, targetParentMatrix, targetOffsetMatrix;
+			constraintTranslateXHandle.setClean();
+			constraintTranslateYHandle.setClean();
+			constraintTranslateZHandle.setClean();
 
-		for (unsigned int i = 0; i < targetCount; i++)
+		}
+		else if (output == PositionConstraint::constraintMatrix)
 		{
 
-			// Jump to array element
-			//
-			status = targetArrayHandle.jumpToArrayElement(i);
+			MDataHandle constraintMatrixHandle = data.outputValue(PositionConstraint::constraintMatrix, &status);
 			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-			targetHandle = targetArrayHandle.inputValue(&status);
+			constraintMatrixHandle.setMMatrix(constraintMatrix);
+			constraintMatrixHandle.setClean();
+
+		}
+		else if (output == PositionConstraint::constraintInverseMatrix)
+		{
+
+			MDataHandle constraintInverseMatrixHandle = data.outputValue(PositionConstraint::constraintInverseMatrix, &status);
 			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-			// Get target data handles
-			//
-			targetWeightHandle = targetHandle.child(PositionConstraint::targetWeight);
-			targetMatrixHandle = targetHandle.child(PositionConstraint::targetMatrix);
-			targetParentMatrixHandle = targetHandle.child(PositionConstraint::targetParentMatrix);
-			targetOffsetTranslateHandle = targetHandle.child(PositionConstraint::targetOffsetTranslate);
+			constraintInverseMatrixHandle.setMMatrix(Maxformations::invertMatrix(constraintMatrix));
+			constraintInverseMatrixHandle.setClean();
 
-			// Get target weight
-			//
-			targetWeights[i] = Maxformations::clamp(targetWeightHandle.asFloat(), 0.0f, 100.0f) / 100.0f;
+		}
+		else if (output == PositionConstraint::constraintWorldMatrix)
+		{
 
-			// Get target matrices
-			//
-			targetMatrix = targetMatrixHandle.asMatrix();
-			targetParentMatrix = targetParentMatrixHandle.asMatrix();
-			targetOffsetTranslate = targetOffsetTranslateHandle.asVector();
-			targetOffsetMatrix = relative ? Maxformations::createPositionMatrix(targetOffsetTranslate) : MMatrix::identity;
+			MDataHandle constraintWorldMatrixHandle = data.outputValue(PositionConstraint::constraintWorldMatrix, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-			targetMatrices[i] = Maxformations::createPositionMatrix(targetOffsetMatrix * Maxformations::normalizeMatrix(targetMatrix));
-			targetWorldMatrices[i] = Maxformations::createPositionMatrix(targetOffsetMatrix * Maxformations::normalizeMatrix(targetMatrix * targetParentMatrix));
+			constraintWorldMatrixHandle.setMMatrix(constraintWorldMatrix);
+			constraintWorldMatrixHandle.setClean();
 
 		}
+		else if (output == PositionConstraint::constraintWorldInverseMatrix)
+		{
 
-		// Calculate weighted constraint matrix
-		//
-		MMatrix positionMatrix, constraintMatrix, constraintWorldMatrix;
+			MDataHandle constraintWorldInverseMatrixHandle = data.outputValue(PositionConstraint::constraintWorldInverseMatrix, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		if (localOrWorld)  // Local
+			constraintWorldInverseMatrixHandle.setMMatrix(Maxformations::invertMatrix(constraintWorldMatrix));
+			constraintWorldInverseMatrixHandle.setClean();
+
+		}
+		else if (output == PositionConstraint::evaluatedTargets)
 		{
 
-			positionMatrix = Maxformations::blendMatrices(restMatrix, targetMatrices, targetWeights);
+			// The evaluated target count is written alongside the constraint matrices
+			//
+			MDataHandle evaluatedTargetsHandle = data.outputValue(PositionConstraint::evaluatedTargets, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
 
-			constraintMatrix = offsetMatrix * positionMatrix;
-			constraintWorldMatrix = constraintMatrix * constraintParentMatrix;
+			evaluatedTargetsHandle.setClean();
 
 		}
-		else  // World
+		else
 		{
 
-			positionMatrix = Maxformations::blendMatrices(restWorldMatrix, targetWorldMatrices, targetWeights);
-
-			constraintWorldMatrix = offsetMatrix * positionMatrix;
-			constraintMatrix = constraintWorldMatrix * constraintParentInverseMatrix;
+			return MS::kUnknownParameter;
 
 		}
 
-		// Get output data handles
+		// Mark data block as clean
 		//
-		MDataHandle constraintTranslateXHandle = data.outputValue(PositionConstraint::constraintTranslateX, &status);
+		status = data.setClean(plug);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle constraintTranslateYHandle = data.outputValue(PositionConstraint::constraintTranslateY, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		return MS::kSuccess;
 
-		MDataHandle constraintTranslateZHandle = data.outputValue(PositionConstraint::constraintTranslateZ, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+	}
+	else
+	{
 
-		MDataHandle constraintMatrixHandle = data.outputValue(PositionConstraint::constraintMatrix, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		return MS::kUnknownParameter;
 
-		MDataHandle constraintInverseMatrixHandle = data.outputValue(PositionConstraint::constraintInverseMatrix, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+	}
+
+}
+
+
+MStatus PositionConstraint::computeMatrices(MDataBlock& data, MMatrix& constraintMatrix, MMatrix& constraintWorldMatrix)
+/**
+Computes the blended constraint matrices from the node's inputs.
+This is only called once per evaluation, see `compute` for how the individual outputs are derived.
+
+@param data: Data block containing storage for the node's attributes.
+@param constraintMatrix: The passed matrix to populate.
+@param constraintWorldMatrix: The passed world matrix to populate.
+@return: Return status.
+*/
+{
 
-		MDataHandle constraintWorldMatrixHandle = data.outputValue(PositionConstraint::constraintWorldMatrix, &status);
+	MStatus status;
+
+	// Get input data handles
+	//
+	MDataHandle relativeHandle = data.inputValue(PositionConstraint::relative, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle blendModeHandle = data.inputValue(PositionConstraint::blendMode, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle offsetTranslateHandle = data.inputValue(PositionConstraint::offsetTranslate, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle localOrWorldHandle = data.inputValue(PositionConstraint::localOrWorld, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle enableRestPositionHandle = data.inputValue(PositionConstraint::enableRestPosition, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle restTranslateHandle = data.inputValue(PositionConstraint::restTranslate, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDataHandle constraintParentInverseMatrixHandle = data.inputValue(PositionConstraint::constraintParentInverseMatrix, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MArrayDataHandle targetArrayHandle = data.inputArrayValue(PositionConstraint::target, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Get values from handles
+	//
+	bool localOrWorld = localOrWorldHandle.asBool();
+	bool relative = relativeHandle.asBool();
+	Maxformations::BlendMode blendMode = Maxformations::BlendMode(blendModeHandle.asShort());
+	MVector offsetTranslate = offsetTranslateHandle.asVector();
+	MMatrix offsetMatrix = relative ? Maxformations::createPositionMatrix(offsetTranslate) : MMatrix::identity;
+
+	MMatrix constraintParentInverseMatrix = constraintParentInverseMatrixHandle.asMatrix();
+	MMatrix constraintParentMatrix = Maxformations::invertMatrix(constraintParentInverseMatrix);
+
+	bool restEnabled = enableRestPositionHandle.asBool();
+	MVector restTranslate = restTranslateHandle.asVector();
+	MMatrix restTranslateMatrix = Maxformations::createPositionMatrix(restTranslate);
+	MMatrix restMatrix = restEnabled ? restTranslateMatrix : MMatrix::identity;
+	MMatrix restWorldMatrix = restTranslateMatrix * constraintParentMatrix;
+
+	// Collect target matrices
+	//
+	unsigned int targetCount = targetArrayHandle.elementCount();
+
+	MFloatArray targetWeights;
+	MMatrixArray targetMatrices;
+	MMatrixArray targetWorldMatrices;
+
+	float weight;
+
+	MDataHandle targetHandle, targetWeightHandle, targetMatrixHandle, targetParentMatrixHandle, targetOffsetTranslateHandle;
+	MVector targetOffsetTranslate;
+	MMatrix targetMatrix, targetParentMatrix, targetOffsetMatrix;
+
+	for (unsigned int i = 0; i < targetCount; i++)
+	{
+
+		// Jump to array element
+		//
+		status = targetArrayHandle.jumpToArrayElement(i);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		MDataHandle constraintWorldInverseMatrixHandle = data.outputValue(PositionConstraint::constraintWorldInverseMatrix, &status);
+		targetHandle = targetArrayHandle.inputValue(&status);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		// Update output data handles
+		// Get target data handles
 		//
-		MVector constraintTranslate = Maxformations::matrixToPosition(constraintMatrix);
+		targetWeightHandle = targetHandle.child(PositionConstraint::targetWeight);
+		targetMatrixHandle = targetHandle.child(PositionConstraint::targetMatrix);
+		targetParentMatrixHandle = targetHandle.child(PositionConstraint::targetParentMatrix);
+		targetOffsetTranslateHandle = targetHandle.child(PositionConstraint::targetOffsetTranslate);
 
-		constraintTranslateXHandle.setMDistance(MDistance(constraintTranslate.x, MDistance::kCentimeters));
-		constraintTranslateYHandle.setMDistance(MDistance(constraintTranslate.y, MDistance::kCentimeters));
-		constraintTranslateZHandle.setMDistance(MDistance(constraintTranslate.z, MDistance::kCentimeters));
+		// Get target weight
+		//
+		weight = Maxformations::clamp(targetWeightHandle.asFloat(), 0.0f, 100.0f) / 100.0f;
 
-		constraintTranslateXHandle.setClean();
-		constraintTranslateYHandle.setClean();
-		constraintTranslateZHandle.setClean();
+		if (weight == 0.0f)
+		{
 
-		constraintMatrixHandle.setMMatrix(constraintMatrix);
-		constraintInverseMatrixHandle.setMMatrix(constraintMatrix.inverse());
-		constraintWorldMatrixHandle.setMMatrix(constraintWorldMatrix);
-		constraintWorldInverseMatrixHandle.setMMatrix(constraintWorldMatrix.inverse());
+			continue;  // Skip targets that don't contribute!
 
-		constraintMatrixHandle.setClean();
-		constraintInverseMatrixHandle.setClean();
-		constraintWorldMatrixHandle.setClean();
-		constraintWorldInverseMatrixHandle.setClean();
+		}
 
-		// Mark data block as clean
+		targetWeights.append(weight);
+
+		// Get target matrices
 		//
-		status = data.setClean(plug);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+		targetMatrix = targetMatrixHandle.asMatrix();
+		targetParentMatrix = targetParentMatrixHandle.asMatrix();
+		targetOffsetTranslate = targetOffsetTranslateHandle.asVector();
+		targetOffsetMatrix = relative ? Maxformations::createPositionMatrix(targetOffsetTranslate) : MMatrix::identity;
 
-		return MS::kSuccess;
+		targetMatrices.append(Maxformations::createPositionMatrix(targetOffsetMatrix * Maxformations::normalizeMatrix(targetMatrix)));
+		targetWorldMatrices.append(Maxformations::createPositionMatrix(targetOffsetMatrix * Maxformations::normalizeMatrix(targetMatrix * targetParentMatrix)));
 
 	}
-	else
+
+	// Update evaluated target count
+	//
+	MDataHandle evaluatedTargetsHandle = data.outputValue(PositionConstraint::evaluatedTargets, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	evaluatedTargetsHandle.setInt(int(targetWeights.length()));
+	evaluatedTargetsHandle.setClean();
+
+	// Calculate weighted constraint matrix
+	//
+	MMatrix positionMatrix;
+
+	if (localOrWorld)  // Local
 	{
 
-		return MS::kUnknownParameter;
+		positionMatrix = Maxformations::blendMatrices(restMatrix, targetMatrices, targetWeights, blendMode);
+
+		constraintMatrix = offsetMatrix * positionMatrix;
+		constraintWorldMatrix = constraintMatrix * constraintParentMatrix;
 
 	}
+	else  // World
+	{
 
-}
+		positionMatrix = Maxformations::blendMatrices(restWorldMatrix, targetWorldMatrices, targetWeights, blendMode);
+
+		constraintWorldMatrix = offsetMatrix * positionMatrix;
+		constraintMatrix = constraintWorldMatrix * constraintParentInverseMatrix;
+
+	}
+
+	return MS::kSuccess;
+
+};
+
+
+MStatus PositionConstraint::setDependentsDirty(const MPlug& plug, MPlugArray& plugArray)
+/**
+This method can be overridden in user defined nodes to specify which plugs should be set dirty based upon an input plug which Maya is marking dirty.
+Any input change invalidates the cached constraint matrices.
+
+@param plug: Plug which is being set dirty by Maya.
+@param plugArray: The programmer should add any plugs which they want to set dirty to this list.
+@return: Return status.
+*/
+{
+
+	this->cache.invalidate();
+
+	return MPxConstraint::setDependentsDirty(plug, plugArray);
+
+};
+
+
+MStatus PositionConstraint::preEvaluation(const MDGContext& context, const MEvaluationNode& evaluationNode)
+/**
+Prepares the node for evaluation by the evaluation manager.
+Dirty propagation is skipped in this case so the cached constraint matrices are invalidated here instead.
+
+@param context: Context in which the evaluation will happen.
+@param evaluationNode: Evaluation node which contains information about the dirty plugs that are about to be evaluated.
+@return: Return status.
+*/
+{
+
+	if (context.isNormal())
+	{
+
+		this->cache.invalidate();
+
+	}
+
+	return MPxConstraint::preEvaluation(context, evaluationNode);
+
+};
+
+
+MPxNode::SchedulingType PositionConstraint::schedulingType() const
+/**
+When overridden this method controls the degree of parallelism supported by the node during threaded evaluation.
+The cached constraint matrices are guarded by their own lock so this constraint can evaluate in parallel!
+
+@return: The scheduling type.
+*/
+{
+
+	return MPxNode::kParallel;
+
+};
+
+
+void PositionConstraint::getCacheSetup(const MEvaluationNode& evaluationNode, MNodeCacheDisablingInfo& disablingInfo, MNodeCacheSetupInfo& cacheSetupInfo, MObjectArray& monitoredAttributes) const
+/**
+Provide node-specific setup info for the Cached Playback system.
+The cached constraint matrices are only trusted for normal contexts so background evaluations always recompute them!
+
+@param evaluationNode: This node's evaluation node, contains animated plug information.
+@param disablingInfo: Information about why the node disables Cached Playback to be reported to the user.
+@param cacheSetupInfo: Preferences and requirements this node has for Cached Playback.
+@param monitoredAttributes: Attributes impacting the behavior of this method that will be monitored for change.
+@return: void.
+*/
+{
+
+	// Call parent function
+	//
+	MPxConstraint::getCacheSetup(evaluationNode, disablingInfo, cacheSetupInfo, monitoredAttributes);
+	assert(!disablingInfo.getCacheDisabled());
+
+	// Update caching preference
+	//
+	cacheSetupInfo.setPreference(MNodeCacheSetupInfo::kWantToCacheByDefault, true);
+
+};
 
 
 const MObject PositionConstraint::targetAttribute() const
@@ -329,6 +515,15 @@ Use this function to define any static attributes.
 	
 	CHECK_MSTATUS(fnNumericAttr.addToCategory(PositionConstraint::inputCategory));
 
+	// ".blendMode" attribute
+	//
+	PositionConstraint::blendMode = fnEnumAttr.create("blendMode", "bm", short(0), &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnEnumAttr.addField("Slerp", 0));
+	CHECK_MSTATUS(fnEnumAttr.addField("Dual Quaternion", 1));
+	CHECK_MSTATUS(fnEnumAttr.addToCategory(PositionConstraint::inputCategory));
+
 	// ".offsetTranslateX" attribute
 	//
 	PositionConstraint::offsetTranslateX = fnUnitAttr.create("offsetTranslateX", "otx", MFnUnitAttribute::kDistance, 0.0, &status);
@@ -557,10 +752,20 @@ Use this function to define any static attributes.
 	CHECK_MSTATUS(fnMatrixAttr.setStorable(false));
 	CHECK_MSTATUS(fnMatrixAttr.addToCategory(PositionConstraint::outputCategory));
 
+	// ".evaluatedTargets" attribute
+	//
+	PositionConstraint::evaluatedTargets = fnNumericAttr.create("evaluatedTargets", "evt", MFnNumericData::kInt, 0, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnNumericAttr.setWritable(false));
+	CHECK_MSTATUS(fnNumericAttr.setStorable(false));
+	CHECK_MSTATUS(fnNumericAttr.addToCategory(PositionConstraint::outputCategory));
+
 	// Add attributes
 	//
 	CHECK_MSTATUS(PositionConstraint::addAttribute(PositionConstraint::localOrWorld));
 	CHECK_MSTATUS(PositionConstraint::addAttribute(PositionConstraint::relative));
+	CHECK_MSTATUS(PositionConstraint::addAttribute(PositionConstraint::blendMode));
 	CHECK_MSTATUS(PositionConstraint::addAttribute(PositionConstraint::offsetTranslate));
 	CHECK_MSTATUS(PositionConstraint::addAttribute(PositionConstraint::restTranslate));
 	CHECK_MSTATUS(PositionConstraint::addAttribute(PositionConstraint::target));
@@ -570,31 +775,77 @@ Use this function to define any static attributes.
 	CHECK_MSTATUS(PositionConstraint::addAttribute(PositionConstraint::constraintWorldMatrix));
 	CHECK_MSTATUS(PositionConstraint::addAttribute(PositionConstraint::constraintWorldInverseMatrix));
 	CHECK_MSTATUS(PositionConstraint::addAttribute(PositionConstraint::constraintParentInverseMatrix));
+	CHECK_MSTATUS(PositionConstraint::addAttribute(PositionConstraint::evaluatedTargets));
 
 	// Define attribute relationships
 	//
-	MObjectArray inputs, outputs;
-
-	status = Maxformations::getAttributesByCategory(PositionConstraint::id, PositionConstraint::inputCategory, inputs);
-	CHECK_MSTATUS_AND_RETURN_IT(status);
-
-	status = Maxformations::getAttributesByCategory(PositionConstraint::id, PositionConstraint::outputCategory, outputs);
-	CHECK_MSTATUS_AND_RETURN_IT(status);
-
-	unsigned int inputCount = inputs.length();
-	unsigned int outputCount = outputs.length();
-
-	for (unsigned int i = 0; i < inputCount; i++)
-	{
-
-		for (unsigned int j = 0; j < outputCount; j++)
-		{
-
-			CHECK_MSTATUS(PositionConstraint::attributeAffects(inputs[i], outputs[j]));
-
-		}
-
-	}
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::localOrWorld, PositionConstraint::constraintTranslate));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::relative, PositionConstraint::constraintTranslate));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::offsetTranslate, PositionConstraint::constraintTranslate));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::enableRestPosition, PositionConstraint::constraintTranslate));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::restTranslate, PositionConstraint::constraintTranslate));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::constraintParentInverseMatrix, PositionConstraint::constraintTranslate));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::blendMode, PositionConstraint::constraintTranslate));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::target, PositionConstraint::constraintTranslate));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::targetWeight, PositionConstraint::constraintTranslate));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::targetMatrix, PositionConstraint::constraintTranslate));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::targetParentMatrix, PositionConstraint::constraintTranslate));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::targetOffsetTranslate, PositionConstraint::constraintTranslate));
+
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::localOrWorld, PositionConstraint::constraintMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::relative, PositionConstraint::constraintMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::offsetTranslate, PositionConstraint::constraintMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::enableRestPosition, PositionConstraint::constraintMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::restTranslate, PositionConstraint::constraintMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::constraintParentInverseMatrix, PositionConstraint::constraintMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::blendMode, PositionConstraint::constraintMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::target, PositionConstraint::constraintMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::targetWeight, PositionConstraint::constraintMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::targetMatrix, PositionConstraint::constraintMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::targetParentMatrix, PositionConstraint::constraintMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::targetOffsetTranslate, PositionConstraint::constraintMatrix));
+
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::localOrWorld, PositionConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::relative, PositionConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::offsetTranslate, PositionConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::enableRestPosition, PositionConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::restTranslate, PositionConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::constraintParentInverseMatrix, PositionConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::blendMode, PositionConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::target, PositionConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::targetWeight, PositionConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::targetMatrix, PositionConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::targetParentMatrix, PositionConstraint::constraintInverseMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::targetOffsetTranslate, PositionConstraint::constraintInverseMatrix));
+
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::localOrWorld, PositionConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::relative, PositionConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::offsetTranslate, PositionConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::enableRestPosition, PositionConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::restTranslate, PositionConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::constraintParentInverseMatrix, PositionConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::blendMode, PositionConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::target, PositionConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::targetWeight, PositionConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::targetMatrix, PositionConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::targetParentMatrix, PositionConstraint::constraintWorldMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::targetOffsetTranslate, PositionConstraint::constraintWorldMatrix));
+
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::localOrWorld, PositionConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::relative, PositionConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::offsetTranslate, PositionConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::enableRestPosition, PositionConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::restTranslate, PositionConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::constraintParentInverseMatrix, PositionConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::blendMode, PositionConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::target, PositionConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::targetWeight, PositionConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::targetMatrix, PositionConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::targetParentMatrix, PositionConstraint::constraintWorldInverseMatrix));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::targetOffsetTranslate, PositionConstraint::constraintWorldInverseMatrix));
+
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::target, PositionConstraint::evaluatedTargets));
+	CHECK_MSTATUS(PositionConstraint::attributeAffects(PositionConstraint::targetWeight, PositionConstraint::evaluatedTargets));
 
 	return MS::kSuccess;
 
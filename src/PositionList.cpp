@@ -7,6 +7,7 @@
 //
 
 #include "PositionList.h"
+#include "MaxformEvaluator.h"
 
 MObject	PositionList::active;
 MObject	PositionList::average;
@@ -53,6 +54,9 @@ Only these values should be used when performing computations!
 
 	MStatus status;
 
+	MAXFORM_PROFILE_COMPUTE("PositionList::compute", this->thisMObject());
+	MaxformEvaluator::recordCompute(this->thisMObject());
+
 	// Evaluate requested plug
 	//
 	MObject attribute = plug.attribute(&status);
@@ -67,21 +71,9 @@ Only these values should be used when performing computations!
 	if (isValue)
 	{
 		
-		// Get input data handles
-		//
-		MDataHandle averageHandle = data.inputValue(PositionList::average, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
-
-		MArrayDataHandle listHandle = data.inputArrayValue(PositionList::list, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
-
-		// Get input values
-		//
-		bool normalizeWeights = averageHandle.asBool();
-
 		// Calculate weighted average
 		//
-		MVector position = PositionList::sum(listHandle, normalizeWeights, &status);
+		MVector position = PositionList::getValue(data, &status);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
 		MMatrix matrix = Maxformations::createPositionMatrix(position);
@@ -117,7 +109,7 @@ Only these values should be used when performing computations!
 		matrixHandle.setMMatrix(matrix);
 		matrixHandle.setClean();
 
-		inverseMatrixHandle.setMMatrix(matrix.inverse());
+		inverseMatrixHandle.setMMatrix(Maxformations::rigidInverse(matrix));  // Position matrices are always rigid!
 		inverseMatrixHandle.setClean();
 
 		// Mark plug as clean
@@ -149,7 +141,7 @@ Only these values should be used when performing computations!
 
 		// Calculate weighted average
 		//
-		MVector position = PositionList::sum(listHandle, active - 1, normalizeWeights, &status);
+		MVector position = ListController<PositionListTraits>::sum(listHandle, active - 1, normalizeWeights, &status);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
 		// Get output data handles
@@ -192,6 +184,29 @@ Only these values should be used when performing computations!
 };
 
 
+MVector PositionList::getValue(MDataBlock& data, MStatus* status)
+/**
+Returns the weighted average of this list from the supplied data block.
+This is shared with the maxform evaluator which calls it directly when fusing controller stacks!
+
+@param data: Data block containing storage for the node's attributes.
+@param status: Returns status.
+@return: Weighted average.
+*/
+{
+
+	MDataHandle averageHandle = data.inputValue(PositionList::average, status);
+	CHECK_MSTATUS_AND_RETURN(*status, MVector());
+
+	MArrayDataHandle listHandle = data.inputArrayValue(PositionList::list, status);
+	CHECK_MSTATUS_AND_RETURN(*status, MVector());
+
+	bool normalizeWeights = averageHandle.asBool();
+
+	return ListController<PositionListTraits>::sum(listHandle, normalizeWeights, status);
+
+};
+
 bool PositionList::setInternalValue(const MPlug& plug, const MDataHandle& handle)
 /**
 This method is overridden by nodes that store attribute data in some internal format.
@@ -268,27 +283,44 @@ Updates the active controller.
 	MStatus status;
 
 	// Redundancy check
+	// Loaded lists already cache their active index so there is nothing to defer!
 	//
-	Maxform* maxform = this->getAssociatedTransform(&status);
-	CHECK_MSTATUS_AND_RETURN_IT(status);
-
-	if (this->previousIndex == this->activeIndex || maxform == nullptr)
+	if (this->previousIndex == this->activeIndex)
 	{
 
 		return MS::kSuccess;  // Nothing to do here~!
 
 	}
 
-	// Transfer connections
+	// Evaluate if file is being opened
+	// Any DAG changes will interfere with file IO operations so these edits are deferred until loading has finished!
 	//
-	MStatus pullStatus = this->pullController(this->previousIndex);
-	MStatus pushStatus = this->pushController(this->activeIndex);
+	bool isDeferred = Maxformations::deferUntilLoaded(this->thisMObject(), PositionList::updateDeferredController);
 
-	if (pullStatus || pushStatus)
+	if (isDeferred)
+	{
+
+		return MS::kSuccess;
+
+	}
+
+	// Transfer connections using a single modifier
+	// This way the graph topology is only rebuilt once per switch!
+	//
+	MAXFORM_PROFILE_TOPOLOGY("PositionList::updateActiveController");
+
+	Maxformations::BatchModifier modifier;
+
+	bool isUpdated = this->updateActiveController(modifier, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = modifier.doIt();
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	if (isUpdated)
 	{
 
 		MGlobal::displayInfo("Updated active position controller!");
-		this->previousIndex = this->activeIndex;
 
 	}
 
@@ -297,80 +329,87 @@ Updates the active controller.
 };
 
 
-MStatus PositionList::pullController(unsigned int index)
+bool PositionList::updateActiveController(Maxformations::BatchModifier& modifier, MStatus* status)
 /**
-Transfers any connections from the associated maxform back to the specified list element.
-A `MS::kNotFound` status will be returned if the index is not in range!
+Queues the connection transfers required to switch over to the active controller.
 
-@param index: The index to transfer connections to.
-@return: Return status.
+@param modifier: The modifier to queue edits onto.
+@param status: Return status.
+@return: Has active controller changed.
 */
 {
 
-	MStatus status;
-
-	// Check if maxform exists
+	// Redundancy check
 	//
-	Maxform* maxform = this->getAssociatedTransform(&status);
-	CHECK_MSTATUS_AND_RETURN_IT(status);
+	Maxform* maxform = this->getAssociatedTransform(status);
+	CHECK_MSTATUS_AND_RETURN(*status, false);
 
-	if (maxform == nullptr)
+	if (this->previousIndex == this->activeIndex || maxform == nullptr)
 	{
 
-		return MS::kNotFound;
+		return false;  // Nothing to do here~!
 
 	}
 
-	// Check if active index is in range
+	// Queue connection transfers
 	//
-	MPlug listPlug = MPlug(this->thisMObject(), PositionList::list);
+	MStatus pullStatus = this->pullController(this->previousIndex, modifier);
+	MStatus pushStatus = this->pushController(this->activeIndex, modifier);
 
-	unsigned int numElements = listPlug.numElements(&status);
-	CHECK_MSTATUS_AND_RETURN_IT(status);
+	bool isUpdated = pullStatus || pushStatus;
 
-	if (0 <= index && index < numElements)
+	if (isUpdated)
 	{
 
-		// Get required plugs
-		//
-		MPlug translatePlug = MPlug(maxform->thisMObject(), Maxform::translate);
+		this->previousIndex = this->activeIndex;
 
-		MPlug listElement = listPlug.elementByLogicalIndex(index);
-		MPlug positionElement = listElement.child(PositionList::position);
+	}
 
-		// Pull position connections from maxform
-		//
-		status = Maxformations::breakConnections(positionElement, true, false);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+	return isUpdated;
 
-		status = Maxformations::transferConnections(translatePlug, positionElement);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+};
 
-		return status;
 
-	}
-	else
-	{
+MStatus PositionList::updateDeferredController(const MObject& node, Maxformations::BatchModifier& modifier)
+/**
+Deferred callback that queues the active controller edits for the supplied list.
+See `Maxformations::deferUntilLoaded` for details.
 
-		return MS::kNotFound;
+@param node: The list controller node.
+@param modifier: The modifier to queue edits onto.
+@return: Return status.
+*/
+{
 
-	}
+	MStatus status;
+
+	MFnDependencyNode fnNode(node, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	PositionList* list = static_cast<PositionList*>(fnNode.userNode(&status));
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	list->updateActiveController(modifier, &status);
+	return status;
 
 };
 
 
-MStatus PositionList::pushController(unsigned int index)
+MStatus PositionList::pullController(unsigned int index, Maxformations::BatchModifier& modifier)
 /**
-Transfers any connections from the specified list element to the associated maxform.
+Queues the transfer of any connections from the associated maxform back to the specified list element.
 A `MS::kNotFound` status will be returned if the index is not in range!
 
-@param index: The index to transfer connections from.
+@param index: The index to transfer connections to.
+@param modifier: The modifier to queue edits onto.
 @return: Return status.
 */
 {
 
 	MStatus status;
 
+	MAXFORM_PROFILE_TOPOLOGY("PositionList::pullController");
+
 	// Check if maxform exists
 	//
 	Maxform* maxform = this->getAssociatedTransform(&status);
@@ -383,253 +422,103 @@ A `MS::kNotFound` status will be returned if the index is not in range!
 
 	}
 
-	// Check if active index is in range
+	// Pull position connections from maxform
 	//
-	MPlug listPlug = MPlug(this->thisMObject(), PositionList::list);
-
-	unsigned int numElements = listPlug.numElements(&status);
-	CHECK_MSTATUS_AND_RETURN_IT(status);
-
-	if (0 <= index && index < numElements)
-	{
-
-		// Get required plugs
-		//
-		MPlug translatePlug = MPlug(maxform->thisMObject(), Maxform::translate);
-
-		MPlug listElement = listPlug.elementByLogicalIndex(index);
-		MPlug positionElement = listElement.child(PositionList::position);
-
-		// Push position connections to maxform
-		//
-		status = Maxformations::transferValues(positionElement, translatePlug);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
-
-		status = Maxformations::transferConnections(positionElement, translatePlug);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
-
-		status = Maxformations::connectPlugs(translatePlug, positionElement, true);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
-
-		return status;
-
-	}
-	else
-	{
-
-		return MS::kNotFound;
-
-	}
+	return ListController<PositionListTraits>::pullController(this->thisMObject(), maxform->thisMObject(), index, modifier);
 
 };
 
 
-MVector PositionList::sum(MArrayDataHandle& handle, const unsigned int active, const bool normalizeWeights, MStatus* status)
+MStatus PositionList::pushController(unsigned int index, Maxformations::BatchModifier& modifier)
 /**
-Returns the weighted average from the supplied array data handle.
+Queues the transfer of any connections from the specified list element to the associated maxform.
+A `MS::kNotFound` status will be returned if the index is not in range!
 
-@param handle: The array data handle to average from.
-@param active: The index to average up to.
-@param normalizeWeights: Determines if weights should be normalized.
-@param status: Returns status.
-@return: Weighted average vector.
+@param index: The index to transfer connections from.
+@param modifier: The modifier to queue edits onto.
+@return: Return status.
 */
 {
 
-	// Check if active index is within range
-	//
-	unsigned int numElements = handle.elementCount(status);
-	CHECK_MSTATUS_AND_RETURN(*status, MVector::zero);
-
-	if (!(0u <= active && active < numElements))
-	{
-
-		return MVector::zero;
+	MStatus status;
 
-	}
+	MAXFORM_PROFILE_TOPOLOGY("PositionList::pushController");
 
-	// Collect position entries
+	// Check if maxform exists
 	//
-	unsigned int numItems = active + 1;
-	std::vector<PositionListItem> items = std::vector<PositionListItem>(numItems);
-
-	MDataHandle elementHandle, nameHandle, weightHandle, absoluteHandle, positionhandle, positionXHandle, positionYHandle, positionZHandle;
-	MString name;
-	float weight;
-	bool absolute;
-	double positionX, positionY, positionZ;
+	Maxform* maxform = this->getAssociatedTransform(&status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
 
-	for (unsigned int i = 0; i < numItems; i++)
+	if (maxform == nullptr)
 	{
 
-		// Jump to array element
-		//
-		*status = handle.jumpToArrayElement(i);
-		CHECK_MSTATUS_AND_RETURN(*status, MVector::zero);
-
-		elementHandle = handle.inputValue(status);
-		CHECK_MSTATUS_AND_RETURN(*status, MVector::zero);
-
-		// Get element data handles
-		//
-		nameHandle = elementHandle.child(PositionList::name);
-		weightHandle = elementHandle.child(PositionList::weight);
-		absoluteHandle = elementHandle.child(PositionList::absolute);
-		positionhandle = elementHandle.child(PositionList::position);
-		positionXHandle = positionhandle.child(PositionList::x_position);
-		positionYHandle = positionhandle.child(PositionList::y_position);
-		positionZHandle = positionhandle.child(PositionList::z_position);
-
-		// Get values from handles
-		//
-		name = nameHandle.asString();
-		weight = Maxformations::clamp(weightHandle.asFloat(), -1.0f, 1.0f);
-		absolute = absoluteHandle.asBool();
-		positionX = positionXHandle.asDistance().asCentimeters();
-		positionY = positionYHandle.asDistance().asCentimeters();
-		positionZ = positionZHandle.asDistance().asCentimeters();
-
-		// Assign value to arrays
-		//
-		items[i] = PositionListItem{ name, weight, absolute, MVector(positionX, positionY, positionZ) };
+		return MS::kNotFound;
 
 	}
 
-	return PositionList::sum(items, normalizeWeights);
+	// Push position connections to maxform
+	//
+	return ListController<PositionListTraits>::pushController(this->thisMObject(), maxform->thisMObject(), index, modifier);
 
 };
 
 
-MVector PositionList::sum(MArrayDataHandle& handle, const bool normalizeWeights, MStatus* status)
+MObject& PositionListTraits::list()
 /**
-Returns the weighted average from the supplied array data handle.
+Returns the list attribute used by the list controller core.
 
-@param handle: The array data handle to average from.
-@param normalizeWeights: Determines if weights should be normalized.
-@param status: Returns status.
-@return: Weighted average vector.
+@return: List attribute.
 */
 {
 
-	// Check if there are enough elements
-	//
-	unsigned int elementCount = handle.elementCount();
-	unsigned int active = elementCount - 1;
-
-	if (0u <= active && active < elementCount)
-	{
-
-		return PositionList::sum(handle, active, normalizeWeights, status);
-
-	}
-	else
-	{
-
-		return MVector::zero;
-
-	}
+	return PositionList::list;
 
 };
 
 
-MVector PositionList::sum(std::vector<PositionListItem>& items, const bool normalizeWeights)
+ListItem<MVector> PositionListTraits::getItem(MDataHandle& elementHandle)
 /**
-Returns the weighted average of the supplied position items.
+Returns a list item from the supplied list element data handle.
 
-@param items: The position items to average.
-@param normalizeWeights: Determines if weights should be normalized.
-@return: Weighted average vector.
+@param elementHandle: The list element data handle.
+@return: List item.
 */
 {
-	
-	// Evaluate item count
-	//
-	unsigned long itemCount = items.size();
-	MVector average = MVector(MVector::zero);
-
-	if (itemCount == 0)
-	{
-
-		return average;
-
-	}
 
-	// Check if weights should be normalized
+	// Get element data handles
 	//
-	if (normalizeWeights)
-	{
-
-		PositionList::normalize(items);
+	MDataHandle positionHandle = elementHandle.child(PositionList::position);
+	MDataHandle positionXHandle = positionHandle.child(PositionList::x_position);
+	MDataHandle positionYHandle = positionHandle.child(PositionList::y_position);
+	MDataHandle positionZHandle = positionHandle.child(PositionList::z_position);
 
-	}
-	
-	// Calculate weighted average
+	// Get values from handles
 	//
-	for (PositionListItem item : items)
-	{
+	ListItem<MVector> item;
+	item.name = elementHandle.child(PositionList::name).asString();
+	item.weight = Maxformations::clamp(elementHandle.child(PositionList::weight).asFloat(), -1.0f, 1.0f);
+	item.absolute = elementHandle.child(PositionList::absolute).asBool();
+	item.value = MVector(positionXHandle.asDistance().asCentimeters(), positionYHandle.asDistance().asCentimeters(), positionZHandle.asDistance().asCentimeters());
 
-		// Evaluate which method to use
-		//
-		if (item.absolute)
-		{
-
-			average = Maxformations::lerp(average, item.translate, item.weight);
+	return item;
 
-		}
-		else
-		{
-
-			average += (item.translate * item.weight);
-
-		}
-		
-	}
-	
-	return average;
-	
-}
+};
 
 
-void PositionList::normalize(std::vector<PositionListItem>& items)
+void PositionListTraits::getPlugs(const MPlug& element, const MObject& transform, MPlugArray& elementPlugs, MPlugArray& transformPlugs)
 /**
-Normalizes the passed weights so that the total sum equals 1.0.
+Collects the list element plugs alongside the maxform plugs they drive.
 
-@param items: The items to normalize.
-@return: void
+@param element: The list element plug.
+@param transform: The associated maxform node.
+@param elementPlugs: The passed array to populate with list element plugs.
+@param transformPlugs: The passed array to populate with maxform plugs.
+@return: Void.
 */
 {
 
-	// Get weight sum
-	//
-	unsigned long itemCount = items.size();
-	float sum = 0.0;
-
-	for (unsigned long i = 0; i < itemCount; i++)
-	{
-
-		sum += std::fabs(items[i].weight);
-
-	}
-
-	// Check for divide by zero errors!
-	//
-	if (sum == 0.0 || sum == 1.0)
-	{
-
-		return;
-
-	}
-
-	// Multiply weights by scale factor
-	//
-	float factor = 1.0 / sum;
-
-	for (unsigned long i = 0; i < itemCount; i++)
-	{
-
-		items[i].weight *= factor;
-
-	}
+	elementPlugs.append(element.child(PositionList::position));
+	transformPlugs.append(MPlug(transform, Maxform::translate));
 
 };
 
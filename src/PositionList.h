@@ -10,6 +10,7 @@
 
 #include "Maxformations.h"
 #include "PositionController.h"
+#include "ListController.h"
 
 #include <utility>
 #include <map>
@@ -33,13 +34,14 @@
 #include <maya/MGlobal.h>
 
  
-struct PositionListItem
+struct PositionListTraits
 {
 
-	MString	name = "";
-	float weight = 1.0;
-	bool absolute = false;
-	MVector translate = MVector::zero;
+	typedef ListBlend::Additive	Blend;
+
+	static	MObject&				list();
+	static	ListItem<MVector>	getItem(MDataHandle& elementHandle);
+	static	void					getPlugs(const MPlug& element, const MObject& transform, MPlugArray& elementPlugs, MPlugArray& transformPlugs);
 
 };
 
@@ -53,18 +55,16 @@ public:
 	virtual					~PositionList();
 
 	virtual MStatus			compute(const MPlug& plug, MDataBlock& data);
+	static	MVector			getValue(MDataBlock& data, MStatus* status);
 
 	virtual	bool			setInternalValue(const MPlug& plug, const MDataHandle& handle);
 	virtual	void			dependentChanged(const MObject& otherNode) override;
 
-	static	MVector			sum(MArrayDataHandle& handle, const bool normalizeWeights, MStatus* status);
-	static	MVector			sum(MArrayDataHandle& handle, const unsigned int active, const bool normalizeWeights, MStatus* status);
-	static	MVector			sum(std::vector<PositionListItem>& items, const bool normalizeWeights);
-	static	void			normalize(std::vector<PositionListItem>& items);
-
 	virtual	MStatus			updateActiveController();
-	virtual	MStatus			pullController(unsigned int index);
-	virtual	MStatus			pushController(unsigned int index);
+	virtual	bool			updateActiveController(Maxformations::BatchModifier& modifier, MStatus* status);
+	static	MStatus			updateDeferredController(const MObject& node, Maxformations::BatchModifier& modifier);
+	virtual	MStatus			pullController(unsigned int index, Maxformations::BatchModifier& modifier);
+	virtual	MStatus			pushController(unsigned int index, Maxformations::BatchModifier& modifier);
 
 	virtual	bool			isAbstractClass() const;
 	static  void*			creator();
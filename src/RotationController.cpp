@@ -17,7 +17,7 @@ MString RotationController::classification("rotationController");
 MTypeId	RotationController::id(0x0013b1d9);
 
 
-RotationController::RotationController() { this->rotationController = MObjectHandle(); this->matrix3Controller = MObjectHandle(); };
+RotationController::RotationController() { this->rotationController = MObjectHandle(); this->matrix3Controller = MObjectHandle(); this->associatedTransform = nullptr; this->isAssociatedTransformCached = false; };
 RotationController::~RotationController() { this->rotationController = MObjectHandle(); this->matrix3Controller = MObjectHandle(); };
 
 
@@ -40,6 +40,44 @@ Only these values should be used when performing computations!
 };
 
 
+MPxNode::SchedulingType RotationController::schedulingType() const
+/**
+When overridden this method controls the degree of parallelism supported by the node during threaded evaluation.
+Rotation controllers only read from their own data block so they are safe to evaluate in parallel!
+
+@return: The scheduling type.
+*/
+{
+
+	return MPxNode::kParallel;
+
+};
+
+
+void RotationController::getCacheSetup(const MEvaluationNode& evaluationNode, MNodeCacheDisablingInfo& disablingInfo, MNodeCacheSetupInfo& cacheSetupInfo, MObjectArray& monitoredAttributes) const
+/**
+Provide node-specific setup info for the Cached Playback system.
+
+@param evaluationNode: This node's evaluation node, contains animated plug information.
+@param disablingInfo: Information about why the node disables Cached Playback to be reported to the user.
+@param cacheSetupInfo: Preferences and requirements this node has for Cached Playback.
+@param monitoredAttributes: Attributes impacting the behavior of this method that will be monitored for change.
+@return: void.
+*/
+{
+
+	// Call parent function
+	//
+	MPxNode::getCacheSetup(evaluationNode, disablingInfo, cacheSetupInfo, monitoredAttributes);
+	assert(!disablingInfo.getCacheDisabled());
+
+	// Update caching preference
+	//
+	cacheSetupInfo.setPreference(MNodeCacheSetupInfo::kWantToCacheByDefault, true);
+
+};
+
+
 MStatus RotationController::connectionMade(const MPlug& plug, const MPlug& otherPlug, bool asSrc)
 /**
 This method gets called when connections are made to attributes of this node.
@@ -67,6 +105,10 @@ You should return kUnknownParameter to specify that maya should handle this conn
 	if (isValue && asSrc)
 	{
 
+		// Invalidate any cached transforms along this chain
+		//
+		Matrix3Controller::invalidateAssociatedTransforms(this->thisMObject());
+
 		// Evaluate classification
 		//
 		MObject otherNode = otherPlug.node();
@@ -128,6 +170,10 @@ You should return kUnknownParameter to specify that maya should handle this conn
 	if (isValue && asSrc)
 	{
 
+		// Invalidate any cached transforms along this chain
+		//
+		Matrix3Controller::invalidateAssociatedTransforms(this->thisMObject());
+
 		// Evaluate other node's classification
 		//
 		MObject otherNode = otherPlug.node();
@@ -210,6 +256,39 @@ Maxform* RotationController::getAssociatedTransform(MStatus* status)
 Returns the maxform node associated with this rotation controller.
 If no maxform node exists then a null pointer is returned instead!
 
+@param status: Return status.
+@return: Maxform pointer.
+*/
+{
+
+	// Check if cached transform is still valid
+	// The cache is only invalidated when this chain is rewired so nested controllers only resolve once!
+	//
+	if (this->isAssociatedTransformCached)
+	{
+
+		return this->associatedTransform;
+
+	}
+
+	// Resolve transform
+	//
+	Maxform* maxform = this->resolveAssociatedTransform(status);
+	CHECK_MSTATUS_AND_RETURN(*status, nullptr);
+
+	this->associatedTransform = maxform;
+	this->isAssociatedTransformCached = true;
+
+	return maxform;
+
+};
+
+
+Maxform* RotationController::resolveAssociatedTransform(MStatus* status)
+/**
+Resolves the maxform node associated with this rotation controller by walking up the controller hierarchy.
+If no maxform node exists then a null pointer is returned instead!
+
 @param status: Return status.
 @return: Maxform pointer.
 */
@@ -257,6 +336,25 @@ If no maxform node exists then a null pointer is returned instead!
 
 };
 
+bool RotationController::invalidateAssociatedTransform()
+/**
+Clears the cached maxform node so the next request resolves the controller hierarchy again.
+See `Matrix3Controller::invalidateAssociatedTransforms` for details.
+
+@return: Was the cached maxform node valid.
+*/
+{
+
+	bool wasCached = this->isAssociatedTransformCached;
+
+	this->associatedTransform = nullptr;
+	this->isAssociatedTransformCached = false;
+
+	return wasCached;
+
+};
+
+
 
 MStatus RotationController::initialize()
 /**
@@ -29,6 +29,8 @@ public:
 	virtual					~RotationController();
 
 	virtual	MStatus			compute(const MPlug& plug, MDataBlock& data);
+	virtual	SchedulingType	schedulingType() const;
+	virtual	void			getCacheSetup(const MEvaluationNode& evaluationNode, MNodeCacheDisablingInfo& disablingInfo, MNodeCacheSetupInfo& cacheSetupInfo, MObjectArray& monitoredAttributes) const;
 
 	virtual	MStatus			connectionMade(const MPlug& plug, const MPlug& otherPlug, bool asSrc);
 	virtual	MStatus			connectionBroken(const MPlug& plug, const MPlug& otherPlug, bool asSrc);
@@ -39,6 +41,8 @@ public:
 
 	virtual	void			dependentChanged(const MObject& otherNode);
 	virtual	Maxform*		getAssociatedTransform(MStatus* status);
+	virtual	Maxform*		resolveAssociatedTransform(MStatus* status);
+	virtual	bool			invalidateAssociatedTransform();
 
 public:
 
@@ -56,6 +60,8 @@ protected:
 
 			MObjectHandle	rotationController;
 			MObjectHandle	matrix3Controller;
+			Maxform*		associatedTransform;
+			bool			isAssociatedTransformCached;
 
 };
 #endif
\ No newline at end of file
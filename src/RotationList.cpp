@@ -7,9 +7,12 @@
 //
 
 #include "RotationList.h"
+#include "MaxformEvaluator.h"
 
 MObject	RotationList::active;
 MObject	RotationList::average;
+MObject	RotationList::accumulation;
+MObject	RotationList::slerpPrecision;
 MObject	RotationList::list;
 MObject	RotationList::name;
 MObject	RotationList::weight;
@@ -51,6 +54,9 @@ Only these values should be used when performing computations!
 @return: Return status.
 */
 {
+
+	MAXFORM_PROFILE_COMPUTE("RotationList::compute", this->thisMObject());
+	MaxformEvaluator::recordCompute(this->thisMObject());
 	
 	MStatus status;
 
@@ -68,21 +74,9 @@ Only these values should be used when performing computations!
 	if (isValue)
 	{
 		
-		// Get input data handles
-		//
-		MDataHandle averageHandle = data.inputValue(RotationList::average, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
-
-		MArrayDataHandle listHandle = data.inputArrayValue(RotationList::list, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
-
-		// Get input values
-		//
-		bool normalizeWeights = averageHandle.asBool();
-
 		// Calculate weighted average
 		//
-		MQuaternion quat = RotationList::sum(listHandle, normalizeWeights, &status);
+		MQuaternion quat = RotationList::getValue(data, &status);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
 		MMatrix matrix = quat.asMatrix();
@@ -119,7 +113,7 @@ Only these values should be used when performing computations!
 		matrixHandle.setMMatrix(matrix);
 		matrixHandle.setClean();
 
-		inverseMatrixHandle.setMMatrix(matrix.inverse());
+		inverseMatrixHandle.setMMatrix(Maxformations::rigidInverse(matrix));  // Rotation matrices are always rigid!
 		inverseMatrixHandle.setClean();
 
 		// Mark plug as clean
@@ -141,6 +135,12 @@ Only these values should be used when performing computations!
 		MDataHandle averageHandle = data.inputValue(RotationList::average, &status);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
+		MDataHandle accumulationHandle = data.inputValue(RotationList::accumulation, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		MDataHandle slerpPrecisionHandle = data.inputValue(RotationList::slerpPrecision, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
 		MArrayDataHandle listHandle = data.inputArrayValue(RotationList::list, &status);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
@@ -148,10 +148,12 @@ Only these values should be used when performing computations!
 		//
 		unsigned int active = activeHandle.asShort();
 		bool normalizeWeights = averageHandle.asBool();
+		RotationAccumulation accumulation = RotationAccumulation(accumulationHandle.asShort());
+		Maxformations::SlerpPrecision precision = Maxformations::SlerpPrecision(slerpPrecisionHandle.asShort());
 
 		// Calculate weighted average
 		//
-		MQuaternion quat = RotationList::sum(listHandle, active - 1, normalizeWeights, &status);
+		MQuaternion quat = RotationList::sum(listHandle, active - 1, normalizeWeights, accumulation, precision, &status);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
 		MMatrix matrix = quat.asMatrix();
@@ -197,6 +199,37 @@ Only these values should be used when performing computations!
 };
 
 
+MQuaternion RotationList::getValue(MDataBlock& data, MStatus* status)
+/**
+Returns the weighted average of this list from the supplied data block.
+This is shared with the maxform evaluator which calls it directly when fusing controller stacks!
+
+@param data: Data block containing storage for the node's attributes.
+@param status: Returns status.
+@return: Weighted average.
+*/
+{
+
+	MDataHandle averageHandle = data.inputValue(RotationList::average, status);
+	CHECK_MSTATUS_AND_RETURN(*status, MQuaternion());
+
+	MDataHandle accumulationHandle = data.inputValue(RotationList::accumulation, status);
+	CHECK_MSTATUS_AND_RETURN(*status, MQuaternion());
+
+	MDataHandle slerpPrecisionHandle = data.inputValue(RotationList::slerpPrecision, status);
+	CHECK_MSTATUS_AND_RETURN(*status, MQuaternion());
+
+	MArrayDataHandle listHandle = data.inputArrayValue(RotationList::list, status);
+	CHECK_MSTATUS_AND_RETURN(*status, MQuaternion());
+
+	bool normalizeWeights = averageHandle.asBool();
+	RotationAccumulation accumulation = RotationAccumulation(accumulationHandle.asShort());
+	Maxformations::SlerpPrecision precision = Maxformations::SlerpPrecision(slerpPrecisionHandle.asShort());
+
+	return RotationList::sum(listHandle, normalizeWeights, accumulation, precision, status);
+
+};
+
 bool RotationList::setInternalValue(const MPlug& plug, const MDataHandle& handle)
 /**
 This method is overridden by nodes that store attribute data in some internal format.
@@ -273,27 +306,44 @@ Updates the active controller.
 	MStatus status;
 
 	// Redundancy check
+	// Loaded lists already cache their active index so there is nothing to defer!
 	//
-	Maxform* maxform = this->getAssociatedTransform(&status);
-	CHECK_MSTATUS_AND_RETURN_IT(status);
-
-	if (this->previousIndex == this->activeIndex || maxform == nullptr)
+	if (this->previousIndex == this->activeIndex)
 	{
 
 		return MS::kSuccess;  // Nothing to do here~!
 
 	}
 
-	// Transfer connections
+	// Evaluate if file is being opened
+	// Any DAG changes will interfere with file IO operations so these edits are deferred until loading has finished!
+	//
+	bool isDeferred = Maxformations::deferUntilLoaded(this->thisMObject(), RotationList::updateDeferredController);
+
+	if (isDeferred)
+	{
+
+		return MS::kSuccess;
+
+	}
+
+	// Transfer connections using a single modifier
+	// This way the graph topology is only rebuilt once per switch!
 	//
-	MStatus pullStatus = this->pullController(this->previousIndex);
-	MStatus pushStatus = this->pushController(this->activeIndex);
+	MAXFORM_PROFILE_TOPOLOGY("RotationList::updateActiveController");
+
+	Maxformations::BatchModifier modifier;
+
+	bool isUpdated = this->updateActiveController(modifier, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = modifier.doIt();
+	CHECK_MSTATUS_AND_RETURN_IT(status);
 
-	if (pullStatus || pushStatus)
+	if (isUpdated)
 	{
 
 		MGlobal::displayInfo("Updated active rotation controller!");
-		this->previousIndex = this->activeIndex;
 
 	}
 
@@ -302,88 +352,87 @@ Updates the active controller.
 };
 
 
-MStatus RotationList::pullController(unsigned int index)
+bool RotationList::updateActiveController(Maxformations::BatchModifier& modifier, MStatus* status)
 /**
-Transfers any connections from the associated maxform back to the specified index.
+Queues the connection transfers required to switch over to the active controller.
 
-@param index: The index to transfer connections to.
-@return: Return status.
+@param modifier: The modifier to queue edits onto.
+@param status: Return status.
+@return: Has active controller changed.
 */
 {
 
-	MStatus status;
-
-	// Check if maxform exists
+	// Redundancy check
 	//
-	Maxform* maxform = this->getAssociatedTransform(&status);
-	CHECK_MSTATUS_AND_RETURN_IT(status);
+	Maxform* maxform = this->getAssociatedTransform(status);
+	CHECK_MSTATUS_AND_RETURN(*status, false);
 
-	if (maxform == nullptr)
+	if (this->previousIndex == this->activeIndex || maxform == nullptr)
 	{
 
-		return MS::kNotFound;
+		return false;  // Nothing to do here~!
 
 	}
 
-	// Check if active index is in range
+	// Queue connection transfers
 	//
-	MPlug listPlug = MPlug(this->thisMObject(), RotationList::list);
+	MStatus pullStatus = this->pullController(this->previousIndex, modifier);
+	MStatus pushStatus = this->pushController(this->activeIndex, modifier);
 
-	unsigned int numElements = listPlug.numElements(&status);
-	CHECK_MSTATUS_AND_RETURN_IT(status);
+	bool isUpdated = pullStatus || pushStatus;
 
-	if (0 <= index && index < numElements)
+	if (isUpdated)
 	{
 
-		// Get required plugs
-		//
-		MPlug rotatePlug = MPlug(maxform->thisMObject(), Maxform::rotate);
-		MPlug rotateOrderPlug = MPlug(maxform->thisMObject(), Maxform::rotateOrder);
+		this->previousIndex = this->activeIndex;
 
-		MPlug listElement = listPlug.elementByLogicalIndex(index);
-		MPlug rotationElement = listElement.child(RotationList::rotation);
-		MPlug axisOrderElement = listElement.child(RotationList::axisOrder);
+	}
 
-		// Pull rotation connections from maxform
-		//
-		status = Maxformations::breakConnections(rotationElement, true, false);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+	return isUpdated;
 
-		status = Maxformations::transferConnections(rotatePlug, rotationElement);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+};
 
-		// Pull rotate-order connections from maxform
-		//
-		status = Maxformations::breakConnections(axisOrderElement, true, false);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		status = Maxformations::transferConnections(rotateOrderPlug, axisOrderElement);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+MStatus RotationList::updateDeferredController(const MObject& node, Maxformations::BatchModifier& modifier)
+/**
+Deferred callback that queues the active controller edits for the supplied list.
+See `Maxformations::deferUntilLoaded` for details.
 
-		return status;
+@param node: The list controller node.
+@param modifier: The modifier to queue edits onto.
+@return: Return status.
+*/
+{
 
-	}
-	else
-	{
+	MStatus status;
 
-		return MS::kFailure;
+	MFnDependencyNode fnNode(node, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
 
-	}
+	RotationList* list = static_cast<RotationList*>(fnNode.userNode(&status));
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	list->updateActiveController(modifier, &status);
+	return status;
 
 };
 
 
-MStatus RotationList::pushController(unsigned int index)
+MStatus RotationList::pullController(unsigned int index, Maxformations::BatchModifier& modifier)
 /**
-Transfers any connections from the specified index to the associated maxform.
+Queues the transfer of any connections from the associated maxform back to the specified list element.
+A `MS::kNotFound` status will be returned if the index is not in range!
 
-@param index: The index to transfer connections from.
+@param index: The index to transfer connections to.
+@param modifier: The modifier to queue edits onto.
 @return: Return status.
 */
 {
 
 	MStatus status;
 
+	MAXFORM_PROFILE_TOPOLOGY("RotationList::pullController");
+
 	// Check if maxform exists
 	//
 	Maxform* maxform = this->getAssociatedTransform(&status);
@@ -396,273 +445,173 @@ Transfers any connections from the specified index to the associated maxform.
 
 	}
 
-	// Check if active index is in range
+	// Pull rotation connections from maxform
 	//
-	MPlug listPlug = MPlug(this->thisMObject(), RotationList::list);
-
-	unsigned int numElements = listPlug.numElements(&status);
-	CHECK_MSTATUS_AND_RETURN_IT(status);
-
-	if (0 <= index && index < numElements)
-	{
+	return ListController<RotationListTraits>::pullController(this->thisMObject(), maxform->thisMObject(), index, modifier);
 
-		// Get required plugs
-		//
-		MPlug rotatePlug = MPlug(maxform->thisMObject(), Maxform::rotate);
-		MPlug rotateOrderPlug = MPlug(maxform->thisMObject(), Maxform::rotateOrder);
-
-		MPlug listElement = listPlug.elementByLogicalIndex(index);
-		MPlug rotationElement = listElement.child(RotationList::rotation);
-		MPlug axisOrderElement = listElement.child(RotationList::axisOrder);
-
-		// Push rotation connections to maxform
-		//
-		status = Maxformations::transferValues(rotationElement, rotatePlug);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+};
 
-		status = Maxformations::transferConnections(rotationElement, rotatePlug);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
 
-		status = Maxformations::connectPlugs(rotatePlug, rotationElement, true);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+MStatus RotationList::pushController(unsigned int index, Maxformations::BatchModifier& modifier)
+/**
+Queues the transfer of any connections from the specified list element to the associated maxform.
+A `MS::kNotFound` status will be returned if the index is not in range!
 
-		// Push axis-order connections to maxform
-		//
-		status = Maxformations::transferValues(axisOrderElement, rotateOrderPlug);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+@param index: The index to transfer connections from.
+@param modifier: The modifier to queue edits onto.
+@return: Return status.
+*/
+{
 
-		status = Maxformations::transferConnections(axisOrderElement, rotateOrderPlug);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+	MStatus status;
 
-		status = Maxformations::connectPlugs(rotateOrderPlug, axisOrderElement, true);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
+	MAXFORM_PROFILE_TOPOLOGY("RotationList::pushController");
 
-		return status;
+	// Check if maxform exists
+	//
+	Maxform* maxform = this->getAssociatedTransform(&status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
 
-	}
-	else
+	if (maxform == nullptr)
 	{
 
 		return MS::kNotFound;
 
 	}
 
+	// Push rotation connections to maxform
+	//
+	return ListController<RotationListTraits>::pushController(this->thisMObject(), maxform->thisMObject(), index, modifier);
+
 };
 
 
-MQuaternion RotationList::sum(MArrayDataHandle& handle, const unsigned int active, const bool normalizeWeights, MStatus* status)
+MQuaternion RotationList::sum(MArrayDataHandle& handle, const bool normalizeWeights, const RotationAccumulation accumulation, const Maxformations::SlerpPrecision precision, MStatus* status)
 /**
-Returns the weighted average from the supplied array data handle.
+Returns the weighted average from the supplied array data handle using the specified accumulation method.
 
 @param handle: The array data handle to average from.
-@param active: The index to average up to.
 @param normalizeWeights: Determines if weights should be normalized.
+@param accumulation: The method used to accumulate the rotations.
+@param precision: The precision used to slerp the rotations.
 @param status: Returns status.
-@return: Weighted average vector.
+@return: Weighted average.
 */
 {
 
-	// Check if active index is within range
-	//
-	unsigned int numElements = handle.elementCount(status);
-	CHECK_MSTATUS_AND_RETURN(*status, MQuaternion::identity);
-
-	if (!(0u <= active && active < numElements))
+	switch (accumulation)
 	{
 
-		return MQuaternion::identity;
+		case RotationAccumulation::Nlerp:
+			return ListController<RotationListTraits, ListBlend::Normalized>::sum(handle, normalizeWeights, status);
 
-	}
+		case RotationAccumulation::Logarithmic:
+			return ListController<RotationListTraits, ListBlend::Logarithmic>::sum(handle, normalizeWeights, ListBlend::Logarithmic{ precision }, status);
 
-	// Collect rotation entries
-	//
-	unsigned int numItems = active + 1;
-	std::vector<RotationListItem> items = std::vector<RotationListItem>(numItems);
-
-	MDataHandle elementHandle, nameHandle, weightHandle, absoluteHandle, axisOrderHandle, rotationHandle, rotationXHandle, rotationYHandle, rotationZHandle;
-	MString name;
-	float weight;
-	bool absolute;
-	MEulerRotation::RotationOrder axisOrder;
-	double rotationX, rotationY, rotationZ;
-
-	for (unsigned int i = 0; i < numItems; i++)
-	{
-
-		// Jump to array element
-		//
-		*status = handle.jumpToArrayElement(i);
-		CHECK_MSTATUS_AND_RETURN(*status, MQuaternion::identity)
-
-		elementHandle = handle.inputValue(status);
-		CHECK_MSTATUS_AND_RETURN(*status, MQuaternion::identity);
-
-		// Get element data handles
-		//
-		nameHandle = elementHandle.child(RotationList::name);
-		weightHandle = elementHandle.child(RotationList::weight);
-		absoluteHandle = elementHandle.child(RotationList::absolute);
-		axisOrderHandle = elementHandle.child(RotationList::axisOrder);
-		rotationHandle = elementHandle.child(RotationList::rotation);
-		rotationXHandle = rotationHandle.child(RotationList::x_rotation);
-		rotationYHandle = rotationHandle.child(RotationList::y_rotation);
-		rotationZHandle = rotationHandle.child(RotationList::z_rotation);
-
-		// Get values from handles
-		//
-		name = nameHandle.asString();
-		weight = Maxformations::clamp(weightHandle.asFloat(), -1.0f, 1.0f);
-		absolute = absoluteHandle.asBool();
-		axisOrder = MEulerRotation::RotationOrder(axisOrderHandle.asShort());
-		rotationX = rotationXHandle.asAngle().asRadians();
-		rotationY = rotationYHandle.asAngle().asRadians();
-		rotationZ = rotationZHandle.asAngle().asRadians();
-
-		// Assign item to array
-		//
-		items[i] = RotationListItem{ name, weight, absolute, MEulerRotation(rotationX, rotationY, rotationZ, axisOrder) };
+		default:
+			return ListController<RotationListTraits>::sum(handle, normalizeWeights, ListBlend::Spherical{ precision }, status);
 
 	}
 
-	return RotationList::sum(items, normalizeWeights);
-
 };
 
 
-MQuaternion RotationList::sum(MArrayDataHandle& handle, const bool normalizeWeights, MStatus* status)
+MQuaternion RotationList::sum(MArrayDataHandle& handle, const unsigned int active, const bool normalizeWeights, const RotationAccumulation accumulation, const Maxformations::SlerpPrecision precision, MStatus* status)
 /**
-Returns the weighted average from the supplied array data handle.
+Returns the weighted average, up to the specified index, from the supplied array data handle using the specified accumulation method.
 
 @param handle: The array data handle to average from.
+@param active: The index to average up to.
 @param normalizeWeights: Determines if weights should be normalized.
+@param accumulation: The method used to accumulate the rotations.
+@param precision: The precision used to slerp the rotations.
 @param status: Returns status.
-@return: Weighted average vector.
+@return: Weighted average.
 */
 {
 
-	// Check if there are enough elements
-	//
-	unsigned int elementCount = handle.elementCount();
-	unsigned int active = elementCount - 1;
+	MAXFORM_PROFILE_SOLVER("RotationList::sum");
 
-	if (0u <= active && active < elementCount)
+	switch (accumulation)
 	{
 
-		return RotationList::sum(handle, (elementCount - 1), normalizeWeights, status);
+		case RotationAccumulation::Nlerp:
+			return ListController<RotationListTraits, ListBlend::Normalized>::sum(handle, active, normalizeWeights, status);
 
-	}
-	else
-	{
+		case RotationAccumulation::Logarithmic:
+			return ListController<RotationListTraits, ListBlend::Logarithmic>::sum(handle, active, normalizeWeights, ListBlend::Logarithmic{ precision }, status);
 
-		return MQuaternion::identity;
+		default:
+			return ListController<RotationListTraits>::sum(handle, active, normalizeWeights, ListBlend::Spherical{ precision }, status);
 
 	}
 
 };
 
 
-MQuaternion RotationList::sum(std::vector<RotationListItem>& items, const bool normalizeWeights)
+MObject& RotationListTraits::list()
 /**
-Returns the weighted average of the supplied rotation items.
+Returns the list attribute used by the list controller core.
 
-@param items: The rotation items to average.
-@param normalizeWeights: Determines if weights should be normalized.
-@return: Weighted average quaternion.
+@return: List attribute.
 */
 {
 
-	// Evaluate item count
-	//
-	unsigned long itemCount = items.size();
-	MQuaternion average = MQuaternion(MQuaternion::identity);
-
-	if (itemCount == 0)
-	{
-
-		return average;
-
-	}
-
-	// Check if weights should be normalized
-	//
-	if (normalizeWeights)
-	{
-
-		RotationList::normalize(items);
+	return RotationList::list;
 
-	}
-
-	// Calculate weighted average
-	//
-	MQuaternion rotation;
-
-	for (RotationListItem item : items)
-	{
-
-		// Evaluate which method to use
-		//
-		rotation = item.eulerRotation.asQuaternion();
-
-		if (item.absolute)
-		{
-
-			average = Maxformations::slerp(average, rotation, item.weight);
-
-		}
-		else
-		{
-			
-			average = Maxformations::slerp(MQuaternion::identity, rotation, item.weight) * average;
-
-		}
-
-	}
-
-	return average;
-	
 };
 
 
-void RotationList::normalize(std::vector<RotationListItem>& items)
+ListItem<MQuaternion> RotationListTraits::getItem(MDataHandle& elementHandle)
 /**
-Normalizes the passed weights so that the total sum equals 1.0.
+Returns a list item from the supplied list element data handle.
 
-@param items: The items to normalize.
-@return: void
+@param elementHandle: The list element data handle.
+@return: List item.
 */
 {
 
-	// Get weight sum
+	// Get element data handles
 	//
-	unsigned long itemCount = items.size();
-	float sum = 0.0;
+	MDataHandle axisOrderHandle = elementHandle.child(RotationList::axisOrder);
+	MDataHandle rotationHandle = elementHandle.child(RotationList::rotation);
+	MDataHandle rotationXHandle = rotationHandle.child(RotationList::x_rotation);
+	MDataHandle rotationYHandle = rotationHandle.child(RotationList::y_rotation);
+	MDataHandle rotationZHandle = rotationHandle.child(RotationList::z_rotation);
 
-	for (unsigned long i = 0; i < itemCount; i++)
-	{
-
-		sum += std::fabs(items[i].weight);
+	// Get values from handles
+	//
+	MEulerRotation::RotationOrder axisOrder = MEulerRotation::RotationOrder(axisOrderHandle.asShort());
+	MEulerRotation eulerRotation = MEulerRotation(rotationXHandle.asAngle().asRadians(), rotationYHandle.asAngle().asRadians(), rotationZHandle.asAngle().asRadians(), axisOrder);
 
-	}
+	ListItem<MQuaternion> item;
+	item.name = elementHandle.child(RotationList::name).asString();
+	item.weight = Maxformations::clamp(elementHandle.child(RotationList::weight).asFloat(), -1.0f, 1.0f);
+	item.absolute = elementHandle.child(RotationList::absolute).asBool();
+	item.value = eulerRotation.asQuaternion();
 
-	// Check for divide by zero errors!
-	//
-	if (sum == 0.0 || sum == 1.0)
-	{
+	return item;
 
-		return;
+};
 
-	}
 
-	// Multiply weights by scale factor
-	//
-	float factor = 1.0 / sum;
+void RotationListTraits::getPlugs(const MPlug& element, const MObject& transform, MPlugArray& elementPlugs, MPlugArray& transformPlugs)
+/**
+Collects the list element plugs alongside the maxform plugs they drive.
 
-	for (unsigned long i = 0; i < itemCount; i++)
-	{
+@param element: The list element plug.
+@param transform: The associated maxform node.
+@param elementPlugs: The passed array to populate with list element plugs.
+@param transformPlugs: The passed array to populate with maxform plugs.
+@return: Void.
+*/
+{
 
-		items[i].weight *= factor;
+	elementPlugs.append(element.child(RotationList::rotation));
+	transformPlugs.append(MPlug(transform, Maxform::rotate));
 
-	}
+	elementPlugs.append(element.child(RotationList::axisOrder));
+	transformPlugs.append(MPlug(transform, Maxform::rotateOrder));
 
 };
 
@@ -733,6 +682,29 @@ Use this function to define any static attributes.
 	CHECK_MSTATUS(fnNumericAttr.setChannelBox(true));
 	CHECK_MSTATUS(fnNumericAttr.addToCategory(RotationList::inputCategory));
 
+	// ".accumulation" attribute
+	//
+	RotationList::accumulation = fnEnumAttr.create("accumulation", "acc", short(0), &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnEnumAttr.addField("Slerp", 0));
+	CHECK_MSTATUS(fnEnumAttr.addField("Nlerp", 1));
+	CHECK_MSTATUS(fnEnumAttr.addField("Logarithmic", 2));
+	CHECK_MSTATUS(fnEnumAttr.setChannelBox(true));
+	CHECK_MSTATUS(fnEnumAttr.addToCategory(RotationList::inputCategory));
+
+	// ".slerpPrecision" attribute
+	// The default is always exact so saved scenes evaluate the same regardless of the global slerp precision!
+	//
+	RotationList::slerpPrecision = fnEnumAttr.create("slerpPrecision", "sp", short(Maxformations::SlerpPrecision::Exact), &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnEnumAttr.addField("Exact", 0));
+	CHECK_MSTATUS(fnEnumAttr.addField("Polynomial", 1));
+	CHECK_MSTATUS(fnEnumAttr.addField("Nlerp", 2));
+	CHECK_MSTATUS(fnEnumAttr.setChannelBox(true));
+	CHECK_MSTATUS(fnEnumAttr.addToCategory(RotationList::inputCategory));
+
 	// ".name" attribute
 	//
 	RotationList::name = fnTypedAttr.create("name", "n", MFnData::kString, &status);
@@ -886,6 +858,8 @@ Use this function to define any static attributes.
 	//
 	CHECK_MSTATUS(RotationList::addAttribute(RotationList::active));
 	CHECK_MSTATUS(RotationList::addAttribute(RotationList::average));
+	CHECK_MSTATUS(RotationList::addAttribute(RotationList::accumulation));
+	CHECK_MSTATUS(RotationList::addAttribute(RotationList::slerpPrecision));
 	CHECK_MSTATUS(RotationList::addAttribute(RotationList::list));
 
 	CHECK_MSTATUS(RotationList::addAttribute(RotationList::preValue));
@@ -896,24 +870,32 @@ Use this function to define any static attributes.
 	//
 	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::active, RotationList::preValue));
 	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::average, RotationList::preValue));
+	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::accumulation, RotationList::preValue));
+	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::slerpPrecision, RotationList::preValue));
 	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::weight, RotationList::preValue));
 	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::absolute, RotationList::preValue));
 	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::axisOrder, RotationList::preValue));
 	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::rotation, RotationList::preValue));
 
 	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::average, RotationList::value));
+	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::accumulation, RotationList::value));
+	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::slerpPrecision, RotationList::value));
 	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::weight, RotationList::value));
 	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::absolute, RotationList::value));
 	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::axisOrder, RotationList::value));
 	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::rotation, RotationList::value));
 
 	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::average, RotationList::matrix));
+	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::accumulation, RotationList::matrix));
+	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::slerpPrecision, RotationList::matrix));
 	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::weight, RotationList::matrix));
 	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::absolute, RotationList::matrix));
 	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::axisOrder, RotationList::matrix));
 	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::rotation, RotationList::matrix));
 
 	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::average, RotationList::inverseMatrix));
+	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::accumulation, RotationList::inverseMatrix));
+	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::slerpPrecision, RotationList::inverseMatrix));
 	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::weight, RotationList::inverseMatrix));
 	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::absolute, RotationList::inverseMatrix));
 	CHECK_MSTATUS(RotationList::attributeAffects(RotationList::axisOrder, RotationList::inverseMatrix));
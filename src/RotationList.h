@@ -10,6 +10,7 @@
 
 #include "Maxformations.h"
 #include "RotationController.h"
+#include "ListController.h"
 
 #include <utility>
 #include <map>
@@ -33,13 +34,24 @@
 #include <math.h>
 
 
-struct RotationListItem
+enum class RotationAccumulation
 {
 
-	MString	name = "";
-	float weight = 1.0;
-	bool absolute = false;
-	MEulerRotation eulerRotation = MEulerRotation::identity;
+	Slerp = 0,
+	Nlerp = 1,
+	Logarithmic = 2
+
+};
+
+
+struct RotationListTraits
+{
+
+	typedef ListBlend::Spherical	Blend;
+
+	static	MObject&				list();
+	static	ListItem<MQuaternion>	getItem(MDataHandle& elementHandle);
+	static	void					getPlugs(const MPlug& element, const MObject& transform, MPlugArray& elementPlugs, MPlugArray& transformPlugs);
 
 };
 
@@ -53,18 +65,19 @@ public:
 	virtual					~RotationList();
 
 	virtual MStatus			compute(const MPlug& plug, MDataBlock& data);
+	static	MQuaternion		getValue(MDataBlock& data, MStatus* status);
 
 	virtual	bool			setInternalValue(const MPlug& plug, const MDataHandle& handle);
 	virtual	void			dependentChanged(const MObject& otherNode) override;
 
-	static	MQuaternion		sum(MArrayDataHandle& handle, const bool normalizeWeights, MStatus* status);
-	static	MQuaternion		sum(MArrayDataHandle& handle, const unsigned int active, const bool normalizeWeights, MStatus* status);
-	static	MQuaternion		sum(std::vector<RotationListItem>& items, const bool normalizeWeights);
-	static	void			normalize(std::vector<RotationListItem>& items);
-
 	virtual	MStatus			updateActiveController();
-	virtual	MStatus			pullController(unsigned int index);
-	virtual	MStatus			pushController(unsigned int index);
+	virtual	bool			updateActiveController(Maxformations::BatchModifier& modifier, MStatus* status);
+	static	MStatus			updateDeferredController(const MObject& node, Maxformations::BatchModifier& modifier);
+	virtual	MStatus			pullController(unsigned int index, Maxformations::BatchModifier& modifier);
+	virtual	MStatus			pushController(unsigned int index, Maxformations::BatchModifier& modifier);
+
+	static	MQuaternion		sum(MArrayDataHandle& handle, const bool normalizeWeights, const RotationAccumulation accumulation, const Maxformations::SlerpPrecision precision, MStatus* status);
+	static	MQuaternion		sum(MArrayDataHandle& handle, const unsigned int active, const bool normalizeWeights, const RotationAccumulation accumulation, const Maxformations::SlerpPrecision precision, MStatus* status);
 
 	virtual	bool			isAbstractClass() const;
 	static  void*			creator();
@@ -74,6 +87,8 @@ public:
 
 	static	MObject			active;
 	static	MObject			average;
+	static	MObject			accumulation;
+	static	MObject			slerpPrecision;
 	static	MObject			list;
 	static	MObject			name;
 	static	MObject			weight;
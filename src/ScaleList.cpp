@@ -7,6 +7,7 @@
 //
 
 #include "ScaleList.h"
+#include "MaxformEvaluator.h"
 
 MObject	ScaleList::active;
 MObject	ScaleList::average;
@@ -53,6 +54,9 @@ Only these values should be used when performing computations!
 
 	MStatus status;
 
+	MAXFORM_PROFILE_COMPUTE("ScaleList::compute", this->thisMObject());
+	MaxformEvaluator::recordCompute(this->thisMObject());
+
 	// Check requested attribute
 	//
 	MObject attribute = plug.attribute(&status);
@@ -67,21 +71,9 @@ Only these values should be used when performing computations!
 	if (isValue)
 	{
 		
-		// Get input data handles
-		//
-		MDataHandle averageHandle = data.inputValue(ScaleList::average, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
-
-		MArrayDataHandle listHandle = data.inputArrayValue(ScaleList::list, &status);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
-
-		// Get values from handles
-		//
-		bool normalizeWeights = averageHandle.asBool();
-		
 		// Calculate weighted average
 		//
-		MVector scale = ScaleList::sum(listHandle, normalizeWeights, &status);
+		MVector scale = ScaleList::getValue(data, &status);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
 		MMatrix matrix = Maxformations::createScaleMatrix(scale);
@@ -117,7 +109,7 @@ Only these values should be used when performing computations!
 		matrixHandle.setMMatrix(matrix);
 		matrixHandle.setClean();
 
-		inverseMatrixHandle.setMMatrix(matrix.inverse());
+		inverseMatrixHandle.setMMatrix(Maxformations::affineInverse(matrix));  // Scale matrices are never rigid!
 		inverseMatrixHandle.setClean();
 
 		// Mark plug as clean
@@ -149,7 +141,7 @@ Only these values should be used when performing computations!
 
 		// Calculate weighted average
 		//
-		MVector scale = ScaleList::sum(listHandle, active - 1, normalizeWeights, &status);
+		MVector scale = ListController<ScaleListTraits>::sum(listHandle, active - 1, normalizeWeights, &status);
 		CHECK_MSTATUS_AND_RETURN_IT(status);
 
 		// Get output data handles
@@ -192,6 +184,29 @@ Only these values should be used when performing computations!
 };
 
 
+MVector ScaleList::getValue(MDataBlock& data, MStatus* status)
+/**
+Returns the weighted average of this list from the supplied data block.
+This is shared with the maxform evaluator which calls it directly when fusing controller stacks!
+
+@param data: Data block containing storage for the node's attributes.
+@param status: Returns status.
+@return: Weighted average.
+*/
+{
+
+	MDataHandle averageHandle = data.inputValue(ScaleList::average, status);
+	CHECK_MSTATUS_AND_RETURN(*status, MVector());
+
+	MArrayDataHandle listHandle = data.inputArrayValue(ScaleList::list, status);
+	CHECK_MSTATUS_AND_RETURN(*status, MVector());
+
+	bool normalizeWeights = averageHandle.asBool();
+
+	return ListController<ScaleListTraits>::sum(listHandle, normalizeWeights, status);
+
+};
+
 bool ScaleList::setInternalValue(const MPlug& plug, const MDataHandle& handle)
 /**
 This method is overridden by nodes that store attribute data in some internal format.
@@ -268,376 +283,242 @@ Updates the active controller.
 	MStatus status;
 
 	// Redundancy check
+	// Loaded lists already cache their active index so there is nothing to defer!
 	//
-	Maxform* maxform = this->getAssociatedTransform(&status);
-	CHECK_MSTATUS_AND_RETURN_IT(status);
-
-	if (this->previousIndex == this->activeIndex || maxform == nullptr)
+	if (this->previousIndex == this->activeIndex)
 	{
 
 		return MS::kSuccess;  // Nothing to do here~!
 
 	}
 
-	// Transfer connections
+	// Evaluate if file is being opened
+	// Any DAG changes will interfere with file IO operations so these edits are deferred until loading has finished!
 	//
-	MStatus pullStatus = this->pullController(this->previousIndex);
-	MStatus pushStatus = this->pushController(this->activeIndex);
+	bool isDeferred = Maxformations::deferUntilLoaded(this->thisMObject(), ScaleList::updateDeferredController);
 
-	if (pullStatus || pushStatus)
+	if (isDeferred)
 	{
 
-		MGlobal::displayInfo("Updated active scale controller!");
-		this->previousIndex = this->activeIndex;
+		return MS::kSuccess;
 
 	}
 
-	return MS::kSuccess;
-
-};
-
-
-MStatus ScaleList::pullController(unsigned int index)
-/**
-Transfers any connections from the associated maxform back to the specified index.
-
-@param index: The index to transfer connections to.
-@return: Return status.
-*/
-{
-
-	MStatus status;
-
-	// Check if maxform exists
+	// Transfer connections using a single modifier
+	// This way the graph topology is only rebuilt once per switch!
 	//
-	Maxform* maxform = this->getAssociatedTransform(&status);
-	CHECK_MSTATUS_AND_RETURN_IT(status);
-
-	if (maxform == nullptr)
-	{
-
-		return MS::kNotFound;
+	MAXFORM_PROFILE_TOPOLOGY("ScaleList::updateActiveController");
 
-	}
+	Maxformations::BatchModifier modifier;
 
-	// Check if active index is in range
-	//
-	MPlug listPlug = MPlug(this->thisMObject(), ScaleList::list);
+	bool isUpdated = this->updateActiveController(modifier, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
 
-	unsigned int numElements = listPlug.numElements(&status);
+	status = modifier.doIt();
 	CHECK_MSTATUS_AND_RETURN_IT(status);
 
-	if (0 <= index && index < numElements)
+	if (isUpdated)
 	{
 
-		// Get required plugs
-		//
-		MPlug scalePlug = MPlug(maxform->thisMObject(), Maxform::rotate);
-
-		MPlug listElement = listPlug.elementByLogicalIndex(index);
-		MPlug scaleElement = listElement.child(ScaleList::scale);
-
-		// Pull scale connections from maxform
-		//
-		status = Maxformations::breakConnections(scaleElement, true, false);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
-
-		status = Maxformations::transferConnections(scalePlug, scaleElement);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
-
-		return status;
+		MGlobal::displayInfo("Updated active scale controller!");
 
 	}
-	else
-	{
 
-		return MS::kNotFound;
-
-	}
+	return MS::kSuccess;
 
 };
 
 
-MStatus ScaleList::pushController(unsigned int index)
+bool ScaleList::updateActiveController(Maxformations::BatchModifier& modifier, MStatus* status)
 /**
-Transfers any connections from the specified index to the associated maxform.
+Queues the connection transfers required to switch over to the active controller.
 
-@param index: The index to transfer connections from.
-@return: Return status.
+@param modifier: The modifier to queue edits onto.
+@param status: Return status.
+@return: Has active controller changed.
 */
 {
 
-	MStatus status;
-
-	// Check if maxform exists
+	// Redundancy check
 	//
-	Maxform* maxform = this->getAssociatedTransform(&status);
-	CHECK_MSTATUS_AND_RETURN_IT(status);
+	Maxform* maxform = this->getAssociatedTransform(status);
+	CHECK_MSTATUS_AND_RETURN(*status, false);
 
-	if (maxform == nullptr)
+	if (this->previousIndex == this->activeIndex || maxform == nullptr)
 	{
 
-		return MS::kNotFound;
+		return false;  // Nothing to do here~!
 
 	}
 
-	// Check if active index is in range
+	// Queue connection transfers
 	//
-	MPlug listPlug = MPlug(this->thisMObject(), ScaleList::list);
+	MStatus pullStatus = this->pullController(this->previousIndex, modifier);
+	MStatus pushStatus = this->pushController(this->activeIndex, modifier);
 
-	unsigned int numElements = listPlug.numElements(&status);
-	CHECK_MSTATUS_AND_RETURN_IT(status);
+	bool isUpdated = pullStatus || pushStatus;
 
-	if (0 <= index && index < numElements)
+	if (isUpdated)
 	{
 
-		// Get required plugs
-		//
-		MPlug scalePlug = MPlug(maxform->thisMObject(), Maxform::scale);
-
-		MPlug listElement = listPlug.elementByLogicalIndex(index);
-		MPlug scaleElement = listElement.child(ScaleList::scale);
-
-		// Push scale connections to maxform
-		//
-		status = Maxformations::transferValues(scaleElement, scalePlug);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
-
-		status = Maxformations::transferConnections(scaleElement, scalePlug);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
-
-		status = Maxformations::connectPlugs(scalePlug, scaleElement, true);
-		CHECK_MSTATUS_AND_RETURN_IT(status);
-
-		return status;
+		this->previousIndex = this->activeIndex;
 
 	}
-	else
-	{
-
-		return MS::kNotFound;
 
-	}
+	return isUpdated;
 
 };
 
 
-MVector ScaleList::sum(MArrayDataHandle& handle, const unsigned int active, const bool normalizeWeights, MStatus* status)
+MStatus ScaleList::updateDeferredController(const MObject& node, Maxformations::BatchModifier& modifier)
 /**
-Returns the weighted average from the supplied array data handle.
+Deferred callback that queues the active controller edits for the supplied list.
+See `Maxformations::deferUntilLoaded` for details.
 
-@param handle: The array data handle to average from.
-@param active: The index to average up to.
-@param normalizeWeights: Determines if weights should be normalized.
-@param status: Returns status.
-@return: Weighted average vector.
+@param node: The list controller node.
+@param modifier: The modifier to queue edits onto.
+@return: Return status.
 */
 {
 
-	// Check if active index is within range
-	//
-	unsigned int numElements = handle.elementCount(status);
-	CHECK_MSTATUS_AND_RETURN(*status, MVector::one);
-
-	if (!(0u <= active && active < numElements))
-	{
-
-		return MVector::one;
-
-	}
-
-	// Collect scale entries
-	//
-	unsigned int numItems = active + 1;
-	std::vector<ScaleListItem> items = std::vector<ScaleListItem>(numItems);
-
-	MDataHandle elementHandle, nameHandle, weightHandle, absoluteHandle, scaleHandle, scaleXHandle, scaleYHandle, scaleZHandle;
-	MString name;
-	float weight;
-	bool absolute;
-	double scaleX, scaleY, scaleZ;
-
-	for (unsigned int i = 0; i < numItems; i++)
-	{
-
-		// Jump to array element
-		//
-		*status = handle.jumpToArrayElement(i);
-		CHECK_MSTATUS_AND_RETURN(*status, MVector::one)
-
-		elementHandle = handle.inputValue(status);
-		CHECK_MSTATUS_AND_RETURN(*status, MVector::one);
-
-		// Get element data handles
-		//
-		nameHandle = elementHandle.child(ScaleList::name);
-		weightHandle = elementHandle.child(ScaleList::weight);
-		absoluteHandle = elementHandle.child(ScaleList::absolute);
-		scaleHandle = elementHandle.child(ScaleList::scale);
-		scaleXHandle = scaleHandle.child(ScaleList::x_scale);
-		scaleYHandle = scaleHandle.child(ScaleList::y_scale);
-		scaleZHandle = scaleHandle.child(ScaleList::z_scale);
+	MStatus status;
 
-		// Get values from handles
-		//
-		name = nameHandle.asString();
-		weight = Maxformations::clamp(weightHandle.asFloat(), -1.0f, 1.0f);
-		absolute = absoluteHandle.asBool();
-		scaleX = scaleXHandle.asDouble();
-		scaleY = scaleYHandle.asDouble();
-		scaleZ = scaleZHandle.asDouble();
-
-		// Assign value to arrays
-		//
-		items[i] = ScaleListItem{ name, weight, absolute, MVector(scaleX, scaleY, scaleZ) };
+	MFnDependencyNode fnNode(node, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
 
-	}
+	ScaleList* list = static_cast<ScaleList*>(fnNode.userNode(&status));
+	CHECK_MSTATUS_AND_RETURN_IT(status);
 
-	return ScaleList::sum(items, normalizeWeights);
+	list->updateActiveController(modifier, &status);
+	return status;
 
 };
 
 
-MVector ScaleList::sum(MArrayDataHandle& handle, const bool normalizeWeights, MStatus* status)
+MStatus ScaleList::pullController(unsigned int index, Maxformations::BatchModifier& modifier)
 /**
-Returns the weighted average from the supplied array data handle.
+Queues the transfer of any connections from the associated maxform back to the specified list element.
+A `MS::kNotFound` status will be returned if the index is not in range!
 
-@param handle: The array data handle to average from.
-@param normalizeWeights: Determines if weights should be normalized.
-@param status: Returns status.
-@return: Weighted average vector.
+@param index: The index to transfer connections to.
+@param modifier: The modifier to queue edits onto.
+@return: Return status.
 */
 {
 
-	// Check if there are enough elements
-	//
-	unsigned int elementCount = handle.elementCount();
-	unsigned int active = elementCount - 1;
+	MStatus status;
 
-	if (0u <= active && active < elementCount)
-	{
+	MAXFORM_PROFILE_TOPOLOGY("ScaleList::pullController");
 
-		return ScaleList::sum(handle, (elementCount - 1), normalizeWeights, status);
+	// Check if maxform exists
+	//
+	Maxform* maxform = this->getAssociatedTransform(&status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
 
-	}
-	else
+	if (maxform == nullptr)
 	{
 
-		return MVector::one;
+		return MS::kNotFound;
 
 	}
 
+	// Pull scale connections from maxform
+	//
+	return ListController<ScaleListTraits>::pullController(this->thisMObject(), maxform->thisMObject(), index, modifier);
+
 };
 
 
-MVector ScaleList::sum(std::vector<ScaleListItem>& items, const bool normalizeWeights)
+MStatus ScaleList::pushController(unsigned int index, Maxformations::BatchModifier& modifier)
 /**
-Returns the weighted average of the supplied scale items.
+Queues the transfer of any connections from the specified list element to the associated maxform.
+A `MS::kNotFound` status will be returned if the index is not in range!
 
-@param items: The scale items to average.
-@return: Weighted average vector.
+@param index: The index to transfer connections from.
+@param modifier: The modifier to queue edits onto.
+@return: Return status.
 */
 {
-	
-	// Evaluate item count
-	//
-	unsigned long itemCount = items.size();
-	MVector average = MVector(MVector::one);
 
-	if (itemCount == 0)
-	{
+	MStatus status;
 
-		return average;
+	MAXFORM_PROFILE_TOPOLOGY("ScaleList::pushController");
 
-	}
-	
-	// Check if weights should be normalized
+	// Check if maxform exists
 	//
-	if (normalizeWeights)
+	Maxform* maxform = this->getAssociatedTransform(&status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	if (maxform == nullptr)
 	{
 
-		ScaleList::normalize(items);
+		return MS::kNotFound;
 
 	}
 
-	// Calculate weighted average
+	// Push scale connections to maxform
 	//
-	MVector scale;
-
-	for (ScaleListItem item : items)
-	{
-		
-		// Evaluate which method to use
-		//
-		if (item.absolute)
-		{
+	return ListController<ScaleListTraits>::pushController(this->thisMObject(), maxform->thisMObject(), index, modifier);
 
-			average = Maxformations::lerp(average, item.scale, item.weight);
-
-		}
-		else if (abs(item.weight) > DBL_MIN)
-		{
+};
 
-			scale = Maxformations::lerp(MVector::one, item.scale, item.weight);
-			average.x *= scale.x;
-			average.y *= scale.y;
-			average.z *= scale.z;
 
-		}
-		else
-		{
+MObject& ScaleListTraits::list()
+/**
+Returns the list attribute used by the list controller core.
 
-			continue;
+@return: List attribute.
+*/
+{
 
-		}
+	return ScaleList::list;
 
-	}
-	
-	return average;
-	
-}
+};
 
 
-void ScaleList::normalize(std::vector<ScaleListItem>& items)
+ListItem<MVector> ScaleListTraits::getItem(MDataHandle& elementHandle)
 /**
-Normalizes the passed weights so that the total sum equals 1.0.
+Returns a list item from the supplied list element data handle.
 
-@param items: The items to normalize.
-@return: void
+@param elementHandle: The list element data handle.
+@return: List item.
 */
 {
 
-	// Get weight sum
+	// Get element data handles
 	//
-	unsigned long itemCount = items.size();
-	float sum = 0.0;
-
-	for (unsigned long i = 0; i < itemCount; i++)
-	{
-
-		sum += std::fabs(items[i].weight);
+	MDataHandle scaleHandle = elementHandle.child(ScaleList::scale);
+	MDataHandle scaleXHandle = scaleHandle.child(ScaleList::x_scale);
+	MDataHandle scaleYHandle = scaleHandle.child(ScaleList::y_scale);
+	MDataHandle scaleZHandle = scaleHandle.child(ScaleList::z_scale);
 
-	}
-
-	// Check for divide by zero errors!
+	// Get values from handles
 	//
-	if (sum == 0.0 || sum == 1.0)
-	{
+	ListItem<MVector> item;
+	item.name = elementHandle.child(ScaleList::name).asString();
+	item.weight = Maxformations::clamp(elementHandle.child(ScaleList::weight).asFloat(), -1.0f, 1.0f);
+	item.absolute = elementHandle.child(ScaleList::absolute).asBool();
+	item.value = MVector(scaleXHandle.asDouble(), scaleYHandle.asDouble(), scaleZHandle.asDouble());
 
-		return;
+	return item;
 
-	}
+};
 
-	// Multiply weights by scale factor
-	//
-	float factor = 1.0 / sum;
 
-	for (unsigned long i = 0; i < itemCount; i++)
-	{
+void ScaleListTraits::getPlugs(const MPlug& element, const MObject& transform, MPlugArray& elementPlugs, MPlugArray& transformPlugs)
+/**
+Collects the list element plugs alongside the maxform plugs they drive.
 
-		items[i].weight *= factor;
+@param element: The list element plug.
+@param transform: The associated maxform node.
+@param elementPlugs: The passed array to populate with list element plugs.
+@param transformPlugs: The passed array to populate with maxform plugs.
+@return: Void.
+*/
+{
 
-	}
+	elementPlugs.append(element.child(ScaleList::scale));
+	transformPlugs.append(MPlug(transform, Maxform::scale));
 
 };
 
@@ -10,6 +10,7 @@
 
 #include "Maxformations.h"
 #include "ScaleController.h"
+#include "ListController.h"
 
 #include <utility>
 #include <map>
@@ -32,13 +33,14 @@
 #include <maya/MGlobal.h>
 
 
-struct ScaleListItem
+struct ScaleListTraits
 {
 
-	MString	name = "";
-	float weight = 1.0;
-	bool absolute = false;
-	MVector scale = MVector::one;
+	typedef ListBlend::Multiplicative	Blend;
+
+	static	MObject&				list();
+	static	ListItem<MVector>	getItem(MDataHandle& elementHandle);
+	static	void					getPlugs(const MPlug& element, const MObject& transform, MPlugArray& elementPlugs, MPlugArray& transformPlugs);
 
 };
 
@@ -52,18 +54,16 @@ public:
 	virtual					~ScaleList();
 
 	virtual MStatus			compute(const MPlug& plug, MDataBlock& data);
+	static	MVector			getValue(MDataBlock& data, MStatus* status);
 
 	virtual	bool			setInternalValue(const MPlug& plug, const MDataHandle& handle);
 	virtual	void			dependentChanged(const MObject& otherNode) override;
 
-	static	MVector			sum(MArrayDataHandle& handle, const bool normalizeWeights, MStatus* status);
-	static	MVector			sum(MArrayDataHandle& handle, const unsigned int active, const bool normalizeWeights, MStatus* status);
-	static	MVector			sum(std::vector<ScaleListItem>& items, const bool normalizeWeights);
-	static	void			normalize(std::vector<ScaleListItem>& items);
-
 	virtual	MStatus			updateActiveController();
-	virtual	MStatus			pullController(unsigned int index);
-	virtual	MStatus			pushController(unsigned int index);
+	virtual	bool			updateActiveController(Maxformations::BatchModifier& modifier, MStatus* status);
+	static	MStatus			updateDeferredController(const MObject& node, Maxformations::BatchModifier& modifier);
+	virtual	MStatus			pullController(unsigned int index, Maxformations::BatchModifier& modifier);
+	virtual	MStatus			pushController(unsigned int index, Maxformations::BatchModifier& modifier);
 
 	virtual	bool			isAbstractClass() const;
 	static  void*			creator();
@@ -60,6 +60,8 @@ Only these values should be used when performing computations!
 
 	MStatus status;
 
+	MAXFORM_PROFILE_COMPUTE("SplineIKChainControl::compute", this->thisMObject());
+
 	// Check requested attribute
 	//
 	MObject attribute = plug.attribute(&status);
@@ -201,7 +203,7 @@ Only these values should be used when performing computations!
 				offsetMatrices[i] = scaleMatrix * offsetRotateMatrix * worldMatrices[i];
 				parentMatrix = (i > 0) ? offsetMatrices[i - 1] : joints[0].parentMatrix;
 
-				matrices[i] = offsetMatrices[i] * parentMatrix.inverse();
+				matrices[i] = offsetMatrices[i] * Maxformations::invertMatrix(parentMatrix);
 
 			}
 
@@ -297,6 +299,8 @@ Returns an array of ik-control specs from the supplied array handle.
 */
 {
 
+	MAXFORM_PROFILE_SOLVER("SplineIKChainControl::getJoints");
+
 	// Presize joint array
 	//
 	std::vector<IKControlSpec> joints = std::vector<IKControlSpec>();
@@ -403,6 +407,8 @@ The first half of samples consists of points along the curve and the second half
 
 	MStatus status;
 
+	MAXFORM_PROFILE_SOLVER("SplineIKChainControl::getSplineSamples");
+
 	// Initialize function set
 	//
 	MFnNurbsCurve fnNurbsCurve(splineShape, &status);
@@ -511,6 +517,7 @@ The solution uses the default forward-x and up-y axes!
 MStatus SplineIKChainControl::findSolution(const MPointArray& points, const std::vector<IKControlSpec>& joints, MPointArray& solutions)
 /**
 Finds a solution that fits supplied joint chain to the sample points.
+See `MaxformCore::fitChain` for details.
 
 @param points: The sample points to align the joints to.
 @param joints: The joints to find solutions for.
@@ -519,79 +526,25 @@ Finds a solution that fits supplied joint chain to the sample points.
 */
 {
 
-	// Resize passed array
-	//
-	unsigned int numJoints = static_cast<unsigned int>(joints.size());
-
-	MStatus status = solutions.setLength(numJoints);
-	CHECK_MSTATUS_AND_RETURN_IT(status);
-
-	solutions[0] = points[0];
+	MAXFORM_PROFILE_SOLVER("SplineIKChainControl::findSolution");
 
-	// Iterate through joints
+	// Collect bone lengths
 	//
-	unsigned int numPoints = points.length();
-	unsigned int lastSegment = numPoints - 1;
-	unsigned int segment = 0;
-
-	MPoint origin, startPoint, endPoint;
-	double startDistance, endDistance, boneLength;
-	MPointArray hits;
-	unsigned hitCount;
+	size_t jointCount = joints.size();
+	std::vector<double> lengths = std::vector<double>(jointCount);
 
-	for (unsigned int i = 1; i < numJoints; i++)
+	for (size_t i = 0; i < jointCount; i++)
 	{
 
-		// Iterate through point samples
-		//
-		boneLength = joints[i].length;
-		origin = solutions[i - 1];
-
-		for (unsigned int j = segment; j < lastSegment; j++)
-		{
-
-			// Check if bone is in range
-			//
-			startPoint = points[j];
-			startDistance = origin.distanceTo(startPoint);
-
-			endPoint = points[j + 1];
-			endDistance = origin.distanceTo(endPoint);
-			
-			if (!(boneLength <= endDistance))
-			{
-
-				continue;
-
-			}
-
-			// Calculate point in segment
-			//
-			hits = SplineIKChainControl::lineSphereIntersection(startPoint, endPoint, origin, boneLength);
-			hitCount = hits.length();
-
-			//debugIntersection(i, startPoint, endPoint, origin, boneLength, hits);
-
-			if (hitCount > 0)
-			{
-
-				solutions[i] = hits[hitCount - 1];
-				segment = ((j + 1) < lastSegment) ? (j + 1) : segment;  // Move starting segment in point array
-
-				break;
-
-			}
-			else
-			{
-				
-				continue;
-
-			}
-
-		}
+		lengths[i] = joints[i].length;
 
 	}
 
+	// Fit joints to sample points
+	//
+	std::vector<MaxformCore::Vector3> solvedPoints = MaxformCore::fitChain(Maxformations::toCoreVectors(points), lengths);
+	solutions = Maxformations::fromCoreVectors(solvedPoints);
+
 	return MS::kSuccess;
 
 };
@@ -676,59 +629,17 @@ See the following for details: https://stackoverflow.com/questions/6533856/ray-s
 */
 {
 
-	// Calculate the discriminant
-	//
-	double ax = startPoint.x, ay = startPoint.y, az = startPoint.z;
-	double bx = endPoint.x, by = endPoint.y, bz = endPoint.z;
-	double cx = center.x, cy = center.y, cz = center.z;
-
-	double a = pow(bx - ax, 2.0) + pow(by - ay, 2.0) + pow(bz - az, 2.0);
-	double b = 2.0 * ((bx - ax) * (ax - cx) + (by - ay) * (ay - cy) + (bz - az) * (az - cz));
-	double c = pow(ax - cx, 2.0) + pow(ay - cy, 2.0) + pow(az - cz, 2.0) - pow(radius, 2.0);
-
-	double discriminant = pow(b, 2.0) - 4.0 * a * c;
-
-	if (discriminant < 0.0)
-	{
-
-		return MPointArray();
-
-	}
-
-	// Evaluate discriminant
-	// This determines how many points of contact there are
-	//
-	double t1 = (-b - sqrt(discriminant)) / (2.0 * a);
-	double t2 = (-b + sqrt(discriminant)) / (2.0 * a);
-
-	MPoint solution1 = MPoint(Maxformations::lerp(ax, bx, t1), Maxformations::lerp(ay, by, t1), Maxformations::lerp(az, bz, t1));
-	MPoint solution2 = MPoint(Maxformations::lerp(ax, bx, t2), Maxformations::lerp(ay, by, t2), Maxformations::lerp(az, bz, t2));
-
-	MPointArray points;
+	MaxformCore::Vector3 hits[2];
+	unsigned int hitCount = MaxformCore::lineSphereIntersection(Maxformations::toCoreVector(startPoint), Maxformations::toCoreVector(endPoint), Maxformations::toCoreVector(center), radius, hits);
 
-	if ((0.0 <= t1 && t1 <= 1.0) && (0.0 <= t2 && t2 <= 1.0))  // 2 solutions
-	{
-
-		points.setLength(2);
-		points[0] = solution1;
-		points[1] = solution2;
+	MPointArray points = MPointArray(hitCount);
 
-	}
-	else if (0.0 <= t1 && t1 <= 1.0)  // 1 solution
-	{
-
-		points.setLength(1);
-		points[0] = solution1;
-
-	}
-	else if (0.0 <= t2 && t2 <= 1.0)  // 1 solution
+	for (unsigned int i = 0; i < hitCount; i++)
 	{
 
-		points.setLength(1);
-		points[0] = solution2;
+		points[i] = Maxformations::fromCoreVector(hits[i]);
 
 	}
-	else;
 
 	return points;
 
@@ -24,15 +24,52 @@
 #include "LookAtConstraint.h"
 #include "PathConstraint.h"
 #include "AttachmentConstraint.h"
+#include "MaxformAffects.h"
+#include "MaxformBenchmark.h"
+#include "MaxformStats.h"
+#include "MaxformEvaluator.h"
 
 #include <maya/MFnPlugin.h>
 
+#include <cstdlib>
+
 
 MStatus initializePlugin(MObject obj) 
 {
 
 	MStatus status;
 
+	// Initialize global slerp precision
+	// The "MAXFORM_SLERP_PRECISION" variable accepts: 0 (Exact), 1 (Polynomial) or 2 (Nlerp)
+	// This only changes the fallback used by callers without a `slerpPrecision` attribute, the attribute defaults stay exact so scenes evaluate the same everywhere!
+	//
+	const char* slerpPrecision = std::getenv("MAXFORM_SLERP_PRECISION");
+
+	if (slerpPrecision != nullptr)
+	{
+
+		int precision = Maxformations::clamp(std::atoi(slerpPrecision), 0, 2);
+		Maxformations::setSlerpPrecision(Maxformations::SlerpPrecision(precision));
+
+	}
+
+	// Register profiler categories
+	//
+	status = MaxformProfiler::registerCategories();
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Register scene callbacks
+	// These keep the global queries, used by our nodes, cached for the parallel evaluator
+	//
+	status = Maxformations::registerSceneCallbacks();
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Register expose callbacks
+	// A single playback callback is shared between every expose transform
+	//
+	status = ExposeTransform::registerCallbacks();
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
 	// Register nodes
 	//
 	MFnPlugin plugin(obj, "Ben Singleton", "2023", "Any");
@@ -94,6 +131,21 @@ MStatus initializePlugin(MObject obj)
 	status = plugin.registerNode("attachmentConstraint", AttachmentConstraint::id, AttachmentConstraint::creator, AttachmentConstraint::initialize, MPxNode::kConstraintNode, &AttachmentConstraint::classification);
 	CHECK_MSTATUS_AND_RETURN_IT(status);
 
+	// Register commands
+	//
+	status = plugin.registerCommand(MaxformAffects::commandName, MaxformAffects::creator, MaxformAffects::newSyntax);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = plugin.registerCommand(MaxformBenchmark::commandName, MaxformBenchmark::creator, MaxformBenchmark::newSyntax);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = plugin.registerCommand(MaxformStats::commandName, MaxformStats::creator, MaxformStats::newSyntax);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Register evaluators
+	//
+	status = plugin.registerEvaluator(MaxformEvaluator::evaluatorName, MaxformEvaluator::priority, MaxformEvaluator::creator);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
 
 	return status;
 
@@ -104,6 +156,21 @@ MStatus uninitializePlugin(MObject obj)
 
 	MStatus status;
 
+	// Deregister scene callbacks
+	//
+	status = Maxformations::deregisterSceneCallbacks();
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Deregister expose callbacks
+	//
+	status = ExposeTransform::deregisterCallbacks();
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Deregister profiler categories
+	//
+	status = MaxformProfiler::deregisterCategories();
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
 	// Deregister nodes
 	//
 	MFnPlugin plugin(obj);
@@ -165,6 +232,22 @@ MStatus uninitializePlugin(MObject obj)
 	status = plugin.deregisterNode(AttachmentConstraint::id);
 	CHECK_MSTATUS_AND_RETURN_IT(status);
 
+	// Deregister commands
+	//
+	status = plugin.deregisterCommand(MaxformAffects::commandName);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = plugin.deregisterCommand(MaxformBenchmark::commandName);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = plugin.deregisterCommand(MaxformStats::commandName);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Deregister evaluators
+	//
+	status = plugin.deregisterEvaluator(MaxformEvaluator::evaluatorName);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
 	return status;
 
 }
@@ -0,0 +1,256 @@
+//
+// File: MaxformCoreBenchmark.cpp
+//
+// Usage: MaxformCoreBenchmark [iterations]
+//
+// Author: Benjamin H. Singleton
+//
+// Headless benchmark for the Maya-independent core.
+// The results use the same JSON layout as `maxformBenchmark` so both can be diffed with the same tools.
+//
+
+#include "MaxformCore.h"
+
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+
+namespace
+{
+
+	const unsigned int seed = 1296133222;
+	const unsigned int fixtureCount = 64;
+	const unsigned int chainLength = 16;
+
+	std::vector<std::string> names;
+	std::vector<double> timings;
+
+	template<class Kernel> void timeKernel(const std::string& name, const unsigned int iterations, Kernel kernel)
+	/**
+	Records the average number of nanoseconds the supplied kernel takes per call.
+	Every result is folded into a volatile checksum so the calls cannot be optimized away!
+
+	@param name: The kernel name.
+	@param iterations: The number of calls to time.
+	@param kernel: The kernel to invoke with the iteration index.
+	@return: Void.
+	*/
+	{
+
+		volatile double checksum = 0.0;
+
+		// Warm up caches before timing
+		//
+		for (unsigned int i = 0; i < fixtureCount; i++)
+		{
+
+			checksum = checksum + kernel(i);
+
+		}
+
+		// Time kernel
+		//
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+		for (unsigned int i = 0; i < iterations; i++)
+		{
+
+			checksum = checksum + kernel(i);
+
+		}
+
+		std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+		double elapsed = std::chrono::duration<double, std::nano>(end - start).count();
+
+		names.push_back(name);
+		timings.push_back(elapsed / static_cast<double>(iterations));
+
+	};
+
+	double random(std::mt19937& generator, const double min, const double max)
+	/**
+	Returns a random number between the specified range.
+	The raw generator output is scaled manually since the standard distributions are not guaranteed to be stable across platforms!
+
+	@param generator: The seeded generator.
+	@param min: The minimum value.
+	@param max: The maximum value.
+	@return: The random number.
+	*/
+	{
+
+		double fraction = static_cast<double>(generator()) / static_cast<double>(std::mt19937::max());
+		return min + ((max - min) * fraction);
+
+	};
+
+	MaxformCore::Matrix4 randomMatrix(std::mt19937& generator)
+	/**
+	Returns a random rigid matrix.
+
+	@param generator: The seeded generator.
+	@return: The matrix.
+	*/
+	{
+
+		MaxformCore::Vector3 axis = MaxformCore::normal(MaxformCore::Vector3{ random(generator, -1.0, 1.0), random(generator, -1.0, 1.0), random(generator, -1.0, 1.0) });
+
+		MaxformCore::Matrix4 matrix;
+		MaxformCore::quaternionToMatrix(MaxformCore::axisAngle(axis, random(generator, -MaxformCore::PI, MaxformCore::PI)), matrix);
+
+		matrix.rows[3][0] = random(generator, -10.0, 10.0);
+		matrix.rows[3][1] = random(generator, -10.0, 10.0);
+		matrix.rows[3][2] = random(generator, -10.0, 10.0);
+
+		return matrix;
+
+	};
+
+	void runKernels(const unsigned int iterations)
+	/**
+	Times each kernel using fixtures generated from a fixed seed.
+
+	@param iterations: The number of calls to time per kernel.
+	@return: Void.
+	*/
+	{
+
+		std::mt19937 generator(seed);
+
+		// Generate fixtures
+		//
+		std::vector<MaxformCore::Vector3> goals(fixtureCount);
+		MaxformCore::MatrixBatch matrices(fixtureCount);
+		MaxformCore::QuaternionBatch quats(fixtureCount);
+		std::vector<double> weights(fixtureCount);
+
+		for (unsigned int i = 0; i < fixtureCount; i++)
+		{
+
+			goals[i] = MaxformCore::Vector3{ random(generator, -4.0, 4.0), random(generator, -4.0, 4.0), random(generator, -4.0, 4.0) };
+			matrices[i] = randomMatrix(generator);
+			quats[i] = MaxformCore::matrixToQuaternion(matrices[i]);
+			weights[i] = random(generator, 0.05, 0.95);
+
+		}
+
+		std::vector<MaxformCore::Vector3> chain(chainLength);
+		std::vector<double> lengths(chainLength, 0.5);
+
+		for (unsigned int i = 0; i < chainLength; i++)
+		{
+
+			chain[i] = MaxformCore::Vector3{ i * 0.5, std::sin(i * 0.4) * 0.25, 0.0 };
+
+		}
+
+		std::vector<MaxformCore::Vector3> curve(chainLength * 4);
+
+		for (unsigned int i = 0; i < curve.size(); i++)
+		{
+
+			curve[i] = MaxformCore::Vector3{ i * 0.2, std::sin(i * 0.1), std::cos(i * 0.1) };
+
+		}
+
+		// Time solver kernels
+		//
+		timeKernel("solveTriangle", iterations, [&](unsigned int index) { double startRadian, endRadian; MaxformCore::solveTriangle(2.0, 1.5, 1.0 + MaxformCore::length(goals[index % fixtureCount]) * 0.25, startRadian, endRadian); return startRadian + endRadian; });
+		timeKernel("lineSphereIntersection", iterations, [&](unsigned int index) { MaxformCore::Vector3 hits[2]; return static_cast<double>(MaxformCore::lineSphereIntersection(goals[index % fixtureCount], goals[(index + 1) % fixtureCount], MaxformCore::Vector3{ 0.0, 0.0, 0.0 }, 2.0, hits)); });
+		timeKernel("compressPoints", iterations, [&](unsigned int index) { return MaxformCore::compressPoints(chain, goals[index % fixtureCount]).back().x; });
+		timeKernel("fabrik", iterations, [&](unsigned int index) { std::vector<MaxformCore::Vector3> points = chain; MaxformCore::fabrik(points, chain[0], goals[index % fixtureCount], 10); return points.back().x; });
+		timeKernel("fitChain", iterations, [&](unsigned int) { return MaxformCore::fitChain(curve, lengths).back().x; });
+
+		// Time matrix kernels
+		//
+		MaxformCore::Matrix4 product;
+		MaxformCore::MatrixBatch batch(chainLength), localBatch;
+
+		timeKernel("multiply", iterations, [&](unsigned int index) { MaxformCore::multiply(matrices[index % fixtureCount], matrices[(index + 1) % fixtureCount], product); return product.rows[3][0]; });
+		timeKernel("affineInverse", iterations, [&](unsigned int index) { MaxformCore::affineInverse(matrices[index % fixtureCount], product); return product.rows[3][0]; });
+		timeKernel("transformPoint", iterations, [&](unsigned int index) { return MaxformCore::transformPoint(goals[index % fixtureCount], matrices[index % fixtureCount]).x; });
+
+		std::vector<MaxformCore::Vector3> points;
+
+		timeKernel("transformPoints", iterations, [&](unsigned int index) { points.assign(goals.begin(), goals.end()); MaxformCore::transformPoints(points, matrices[index % fixtureCount]); return points[index % fixtureCount].x; });
+		timeKernel("transformPoints.origin", iterations, [&](unsigned int index) { MaxformCore::transformPoints(matrices, MaxformCore::Vector3{ 0.0, 0.0, 0.0 }, points); return points[index % fixtureCount].x; });
+		timeKernel("staggerBatch", iterations, [&](unsigned int index) { batch.assign(matrices.begin(), matrices.begin() + chainLength); MaxformCore::staggerBatch(batch, localBatch); return localBatch[index % chainLength].rows[3][0]; });
+		timeKernel("expandBatch", iterations, [&](unsigned int index) { batch.assign(matrices.begin(), matrices.begin() + chainLength); MaxformCore::expandBatch(batch); return batch[index % chainLength].rows[3][0]; });
+
+		// Time interpolation kernels for every precision
+		// The batch kernels interpolate the entire fixture against its rotated copy per call!
+		//
+		const MaxformCore::SlerpPrecision precisions[3] = { MaxformCore::SlerpPrecision::Exact, MaxformCore::SlerpPrecision::Polynomial, MaxformCore::SlerpPrecision::Nlerp };
+		const char* precisionNames[3] = { "exact", "polynomial", "nlerp" };
+
+		MaxformCore::QuaternionBatch endQuats(quats.begin() + 1, quats.end()), slerpedQuats;
+		endQuats.push_back(quats.front());
+
+		for (unsigned int i = 0; i < 3; i++)
+		{
+
+			MaxformCore::SlerpPrecision precision = precisions[i];
+
+			timeKernel(std::string("slerp.") + precisionNames[i], iterations, [&](unsigned int index) { return MaxformCore::slerp(quats[index % fixtureCount], endQuats[index % fixtureCount], weights[index % fixtureCount], precision).w; });
+			timeKernel(std::string("slerpBatch.") + precisionNames[i], iterations, [&](unsigned int index) { MaxformCore::slerpBatch(quats, endQuats, weights, precision, slerpedQuats); return slerpedQuats[index % fixtureCount].w; });
+
+		}
+
+		// Time layer accumulation kernels
+		// The slerp chain is what the logarithms replace when accumulating relative layers!
+		//
+		const MaxformCore::Quaternion identity = { 0.0, 0.0, 0.0, 1.0 };
+
+		timeKernel("logMap", iterations, [&](unsigned int index) { return MaxformCore::logMap(quats[index % fixtureCount]).x; });
+		timeKernel("slerpChain", iterations, [&](unsigned int) { MaxformCore::Quaternion quat = identity; for (unsigned int i = 0; i < fixtureCount; i++) { quat = MaxformCore::multiply(MaxformCore::slerp(identity, quats[i], weights[i], MaxformCore::SlerpPrecision::Exact), quat); } return quat.w; });
+		timeKernel("sumLogMaps", iterations, [&](unsigned int) { return MaxformCore::expMap(MaxformCore::sumLogMaps(quats, weights)).w; });
+
+		// Time rotation averaging kernels
+		//
+		timeKernel("averageQuaternions", iterations, [&](unsigned int) { return MaxformCore::averageQuaternions(quats, weights).w; });
+
+		// Time rigid blend kernels
+		// The slerp chain above is what the dual quaternion blend replaces on constraints!
+		//
+		timeKernel("blendDualQuaternions", iterations, [&](unsigned int) { MaxformCore::Quaternion quat; MaxformCore::Vector3 point; MaxformCore::blendDualQuaternions(quats, goals, weights, quat, point); return point.x; });
+
+	};
+
+};
+
+
+int main(int argc, char** argv)
+{
+
+	unsigned int iterations = 100000;
+
+	if (argc > 1)
+	{
+
+		int value = std::atoi(argv[1]);
+		iterations = (value > 0) ? static_cast<unsigned int>(value) : 1;
+
+	}
+
+	runKernels(iterations);
+
+	// Print results
+	//
+	std::printf("{\n\t\"iterations\": %u,\n\t\"kernels\": {\n", iterations);
+
+	for (size_t i = 0; i < names.size(); i++)
+	{
+
+		std::printf("\t\t\"%s\": %.3f%s\n", names[i].c_str(), timings[i], ((i + 1) < names.size()) ? "," : "");
+
+	}
+
+	std::printf("\t}\n}\n");
+
+	return 0;
+
+};
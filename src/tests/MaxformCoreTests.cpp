@@ -0,0 +1,814 @@
+//
+// File: MaxformCoreTests.cpp
+//
+// Headless correctness tests for the Maya-independent core.
+// Expected values are either derived analytically or recorded from the reference solvers, any change to them must be intentional!
+//
+// Author: Benjamin H. Singleton
+//
+
+#include "MaxformCore.h"
+
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cmath>
+#include <algorithm>
+
+
+namespace
+{
+
+	unsigned int failureCount = 0;
+	unsigned int checkCount = 0;
+
+	void check(const bool condition, const std::string& name)
+	/**
+	Records the outcome of a single check and reports any failures.
+
+	@param condition: Did the check pass.
+	@param name: The name of the check.
+	@return: Void.
+	*/
+	{
+
+		checkCount++;
+
+		if (!condition)
+		{
+
+			failureCount++;
+			std::printf("FAILED: %s\n", name.c_str());
+
+		}
+
+	};
+
+	bool isClose(const double value, const double otherValue, const double tolerance)
+	/**
+	Evaluates if the two supplied values are within the specified tolerance.
+
+	@param value: The first value.
+	@param otherValue: The second value.
+	@param tolerance: The max difference.
+	@return: Is close.
+	*/
+	{
+
+		return std::fabs(value - otherValue) <= tolerance;
+
+	};
+
+	bool isClose(const MaxformCore::Vector3& vector, const MaxformCore::Vector3& otherVector, const double tolerance)
+	/**
+	Evaluates if the two supplied vectors are within the specified tolerance, per component.
+
+	@param vector: The first vector.
+	@param otherVector: The second vector.
+	@param tolerance: The max difference.
+	@return: Is close.
+	*/
+	{
+
+		return isClose(vector.x, otherVector.x, tolerance) && isClose(vector.y, otherVector.y, tolerance) && isClose(vector.z, otherVector.z, tolerance);
+
+	};
+
+	bool isClose(const MaxformCore::Matrix4& matrix, const MaxformCore::Matrix4& otherMatrix, const double tolerance)
+	/**
+	Evaluates if the two supplied matrices are within the specified tolerance, per element.
+
+	@param matrix: The first matrix.
+	@param otherMatrix: The second matrix.
+	@param tolerance: The max difference.
+	@return: Is close.
+	*/
+	{
+
+		for (unsigned int i = 0; i < 4; i++)
+		{
+
+			for (unsigned int j = 0; j < 4; j++)
+			{
+
+				if (!isClose(matrix.rows[i][j], otherMatrix.rows[i][j], tolerance))
+				{
+
+					return false;
+
+				}
+
+			}
+
+		}
+
+		return true;
+
+	};
+
+	bool isClose(const MaxformCore::Quaternion& quat, const MaxformCore::Quaternion& otherQuat, const double tolerance)
+	/**
+	Evaluates if the two supplied quaternions are within the specified tolerance, per component.
+
+	@param quat: The first quaternion.
+	@param otherQuat: The second quaternion.
+	@param tolerance: The max difference.
+	@return: Is close.
+	*/
+	{
+
+		return isClose(quat.x, otherQuat.x, tolerance) && isClose(quat.y, otherQuat.y, tolerance) && isClose(quat.z, otherQuat.z, tolerance) && isClose(quat.w, otherQuat.w, tolerance);
+
+	};
+
+	double angleBetween(const MaxformCore::Quaternion& quat, const MaxformCore::Quaternion& otherQuat)
+	/**
+	Returns the angle, in degrees, between the two rotations represented by the supplied quaternions.
+	Both quaternions are normalized first since the polynomial slerp does not preserve unit length exactly!
+
+	@param quat: The first rotation.
+	@param otherQuat: The second rotation.
+	@return: The angle in degrees.
+	*/
+	{
+
+		double dot = std::fabs(MaxformCore::dot(MaxformCore::normal(quat), MaxformCore::normal(otherQuat)));
+		return 2.0 * std::acos(std::min(dot, 1.0)) * (180.0 / MaxformCore::PI);
+
+	};
+
+	void checkPoints(const std::vector<MaxformCore::Vector3>& points, const std::vector<MaxformCore::Vector3>& expected, const double tolerance, const std::string& name)
+	/**
+	Checks the supplied points against the expected points.
+
+	@param points: The points to check.
+	@param expected: The expected points.
+	@param tolerance: The max difference per component.
+	@param name: The name of the check.
+	@return: Void.
+	*/
+	{
+
+		check(points.size() == expected.size(), name + ".size");
+
+		size_t pointCount = std::min(points.size(), expected.size());
+
+		for (size_t i = 0; i < pointCount; i++)
+		{
+
+			check(isClose(points[i], expected[i], tolerance), name + "[" + std::to_string(i) + "]");
+
+		}
+
+	};
+
+	void checkBoneLengths(const std::vector<MaxformCore::Vector3>& points, const std::vector<MaxformCore::Vector3>& restPoints, const double tolerance, const std::string& name)
+	/**
+	Checks that the supplied points preserve the bone lengths of the rest points.
+
+	@param points: The solved points.
+	@param restPoints: The rest points.
+	@param tolerance: The max difference per bone.
+	@param name: The name of the check.
+	@return: Void.
+	*/
+	{
+
+		for (size_t i = 1; i < points.size() && i < restPoints.size(); i++)
+		{
+
+			double length = MaxformCore::distanceBetween(points[i - 1], points[i]);
+			double restLength = MaxformCore::distanceBetween(restPoints[i - 1], restPoints[i]);
+
+			check(isClose(length, restLength, tolerance), name + ".boneLength[" + std::to_string(i) + "]");
+
+		}
+
+	};
+
+	void testSolveTriangle()
+	/**
+	Tests the law of cosines solver against a 3-4-5 triangle and both limits.
+
+	@return: Void.
+	*/
+	{
+
+		double startRadian, endRadian;
+
+		MaxformCore::solveTriangle(3.0, 4.0, 5.0, startRadian, endRadian);
+		check(isClose(startRadian, std::acos(0.6), 1e-12), "solveTriangle.default.start");
+		check(isClose(endRadian, MaxformCore::PI * 0.5, 1e-12), "solveTriangle.default.end");
+
+		MaxformCore::solveTriangle(3.0, 4.0, 1.0, startRadian, endRadian);
+		check(startRadian == 0.0 && endRadian == 0.0, "solveTriangle.collapsed");
+
+		MaxformCore::solveTriangle(3.0, 4.0, 7.5, startRadian, endRadian);
+		check(startRadian == 0.0 && endRadian == MaxformCore::PI, "solveTriangle.hyperExtended");
+
+	};
+
+	void testLineSphereIntersection()
+	/**
+	Tests the line-sphere intersection for crossing, tangent, missing and partial segments.
+
+	@return: Void.
+	*/
+	{
+
+		MaxformCore::Vector3 origin = { 0.0, 0.0, 0.0 };
+		MaxformCore::Vector3 hits[2];
+
+		unsigned int hitCount = MaxformCore::lineSphereIntersection({ -2.0, 0.0, 0.0 }, { 2.0, 0.0, 0.0 }, origin, 1.0, hits);
+		check(hitCount == 2, "lineSphereIntersection.crossing.count");
+		check(isClose(hits[0], { -1.0, 0.0, 0.0 }, 1e-12) && isClose(hits[1], { 1.0, 0.0, 0.0 }, 1e-12), "lineSphereIntersection.crossing.hits");
+
+		hitCount = MaxformCore::lineSphereIntersection({ -2.0, 2.0, 0.0 }, { 2.0, 2.0, 0.0 }, origin, 1.0, hits);
+		check(hitCount == 0, "lineSphereIntersection.missing");
+
+		hitCount = MaxformCore::lineSphereIntersection({ 0.0, 0.0, 0.0 }, { 0.0, 3.0, 0.0 }, origin, 2.0, hits);
+		check(hitCount == 1, "lineSphereIntersection.partial.count");
+		check(isClose(hits[0], { 0.0, 2.0, 0.0 }, 1e-12), "lineSphereIntersection.partial.hit");
+
+		hitCount = MaxformCore::lineSphereIntersection({ 2.0, 0.0, 0.0 }, { 3.0, 0.0, 0.0 }, origin, 1.0, hits);
+		check(hitCount == 0, "lineSphereIntersection.outsideSegment");
+
+	};
+
+	void testFitChain()
+	/**
+	Tests fitting a chain onto a straight line and a recorded curved sample.
+
+	@return: Void.
+	*/
+	{
+
+		std::vector<MaxformCore::Vector3> line;
+
+		for (unsigned int i = 0; i <= 10; i++)
+		{
+
+			line.push_back({ static_cast<double>(i), 0.0, 0.0 });
+
+		}
+
+		std::vector<MaxformCore::Vector3> solutions = MaxformCore::fitChain(line, { 0.0, 2.0, 3.0, 1.5 });
+		checkPoints(solutions, { { 0.0, 0.0, 0.0 }, { 2.0, 0.0, 0.0 }, { 5.0, 0.0, 0.0 }, { 6.5, 0.0, 0.0 } }, 1e-12, "fitChain.line");
+
+		std::vector<MaxformCore::Vector3> curve = { { 0.0, 0.0, 0.0 }, { 1.0, 1.0, 0.0 }, { 2.0, 1.5, 0.0 }, { 3.0, 1.5, 0.0 }, { 4.0, 1.0, 0.0 }, { 5.0, 0.0, 0.0 } };
+		solutions = MaxformCore::fitChain(curve, { 0.0, 1.2, 1.0, 1.5 });
+
+		checkPoints(
+			solutions,
+			{
+				{ 0.0, 0.0, 0.0 },
+				{ 0.84852813742385702, 0.84852813742385702, 0.0 },
+				{ 1.710606447130375, 1.3553032235651874, 0.0 },
+				{ 3.2100821641409851, 1.3949589179295074, 0.0 }
+			},
+			1e-9,
+			"fitChain.curve"
+		);
+
+		check(MaxformCore::fitChain({}, { 0.0, 1.0 }).size() == 2, "fitChain.empty");
+
+	};
+
+	void testFabrik()
+	/**
+	Tests the FABRIK solver against a recorded solve and its invariants.
+
+	@return: Void.
+	*/
+	{
+
+		std::vector<MaxformCore::Vector3> restPoints = { { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 }, { 2.0, 0.0, 0.0 }, { 3.0, 0.0, 0.0 } };
+		MaxformCore::Vector3 goal = { 1.5, 1.5, 0.5 };
+
+		std::vector<MaxformCore::Vector3> points = restPoints;
+		MaxformCore::fabrik(points, restPoints[0], goal, 10);
+
+		checkPoints(
+			points,
+			{
+				{ 0.0, 0.0, 0.0 },
+				{ 0.99992941649838751, 0.011271460378909347, 0.0037571534596363009 },
+				{ 1.7904926321414303, 0.59222655491283227, 0.19740885163761096 },
+				{ 1.500000000000167, 1.4999999999994786, 0.49999999999982619 }
+			},
+			1e-9,
+			"fabrik.reachable"
+		);
+
+		checkBoneLengths(points, restPoints, 1e-9, "fabrik.reachable");
+
+		// Unreachable goals should straighten the chain towards the goal
+		//
+		points = restPoints;
+		MaxformCore::fabrik(points, restPoints[0], { 0.0, 10.0, 0.0 }, 10);
+
+		checkPoints(points, { { 0.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 2.0, 0.0 }, { 0.0, 3.0, 0.0 } }, 1e-6, "fabrik.unreachable");
+
+	};
+
+	void testCompressPoints()
+	/**
+	Tests the chain compression against recorded solves and its invariants.
+
+	@return: Void.
+	*/
+	{
+
+		std::vector<MaxformCore::Vector3> restPoints = { { 0.0, 0.0, 0.0 }, { 1.0, 0.5, 0.0 }, { 2.0, 0.0, 0.0 } };
+		std::vector<MaxformCore::Vector3> points = MaxformCore::compressPoints(restPoints, { 1.5, 0.0, 0.0 });
+
+		checkPoints(
+			points,
+			{
+				{ 0.0, 0.0, 0.0 },
+				{ -0.42774725498596777, 1.03297254845033, 0.0 },
+				{ 0.572252745014032, 0.53297254845032971, 0.0 }
+			},
+			1e-9,
+			"compressPoints.twoBone"
+		);
+
+		checkBoneLengths(points, restPoints, 1e-9, "compressPoints.twoBone");
+
+		restPoints = { { 0.0, 0.0, 0.0 }, { 1.0, 0.3, 0.0 }, { 2.0, 0.4, 0.0 }, { 3.0, 0.3, 0.0 }, { 4.0, 0.0, 0.0 } };
+		points = MaxformCore::compressPoints(restPoints, { 3.0, 0.0, 0.0 });
+
+		checkPoints(
+			points,
+			{
+				{ 0.0, 0.0, 0.0 },
+				{ -0.22981246632186042, 1.0184234042494622, 0.0 },
+				{ 0.77018753367813941, 1.1184234042494627, 0.0 },
+				{ 0.74375167754988381, 0.11378359540712624, 0.0 },
+				{ -0.28877660913559522, 0.26833241356614468, 0.0 }
+			},
+			1e-9,
+			"compressPoints.fourBone"
+		);
+
+		checkBoneLengths(points, restPoints, 1e-9, "compressPoints.fourBone");
+
+		// Chains with less than 3 points are returned untouched
+		//
+		restPoints = { { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 } };
+		checkPoints(MaxformCore::compressPoints(restPoints, { 0.5, 0.0, 0.0 }), restPoints, 0.0, "compressPoints.singleBone");
+
+	};
+
+	void testQuaternions()
+	/**
+	Tests that the quaternion product and conversions agree with the row-major matrix conventions.
+
+	@return: Void.
+	*/
+	{
+
+		MaxformCore::Quaternion quat = MaxformCore::axisAngle(MaxformCore::normal(MaxformCore::Vector3{ 1.0, 2.0, 3.0 }), 0.7);
+		MaxformCore::Quaternion otherQuat = MaxformCore::axisAngle(MaxformCore::normal(MaxformCore::Vector3{ -2.0, 0.5, 1.0 }), 2.1);
+
+		MaxformCore::Matrix4 matrix, otherMatrix, product, quatProduct;
+		MaxformCore::quaternionToMatrix(quat, matrix);
+		MaxformCore::quaternionToMatrix(otherQuat, otherMatrix);
+		MaxformCore::multiply(matrix, otherMatrix, product);
+		MaxformCore::quaternionToMatrix(MaxformCore::multiply(quat, otherQuat), quatProduct);
+
+		check(isClose(product, quatProduct, 1e-12), "quaternion.multiply");
+
+		MaxformCore::Quaternion roundTrip = MaxformCore::matrixToQuaternion(product);
+		MaxformCore::Quaternion expected = MaxformCore::multiply(quat, otherQuat);
+
+		check(isClose(std::fabs(MaxformCore::dot(roundTrip, expected)), 1.0, 1e-12), "quaternion.matrixToQuaternion");
+
+		MaxformCore::Vector3 vector = { 0.3, -1.2, 2.0 };
+		check(isClose(MaxformCore::rotate(vector, quat), MaxformCore::transformPoint(vector, matrix), 1e-12), "quaternion.rotate");
+
+		MaxformCore::Quaternion identity = MaxformCore::multiply(quat, MaxformCore::conjugate(quat));
+		check(isClose(identity.w, 1.0, 1e-12) && isClose(identity.x, 0.0, 1e-12), "quaternion.conjugate");
+
+		MaxformCore::Vector3 rotated = MaxformCore::rotate({ 1.0, 0.0, 0.0 }, MaxformCore::axisAngle({ 0.0, 0.0, 1.0 }, MaxformCore::PI * 0.5));
+		check(isClose(rotated, { 0.0, 1.0, 0.0 }, 1e-12), "quaternion.axisAngle");
+
+	};
+
+	void testSlerp()
+	/**
+	Tests the maximum angular error of each slerp precision and that the batch kernel matches the scalar kernel.
+	The documented bounds, see `MaxformCore::slerp`, are checked against the exact slerp for arcs up to 180 degrees, including extrapolated weights.
+
+	@return: Void.
+	*/
+	{
+
+		const MaxformCore::SlerpPrecision precisions[3] = { MaxformCore::SlerpPrecision::Exact, MaxformCore::SlerpPrecision::Polynomial, MaxformCore::SlerpPrecision::Nlerp };
+		const double maxErrors[3] = { 1e-9, 0.001, 0.045 };
+		const char* precisionNames[3] = { "exact", "polynomial", "nlerp" };
+
+		const MaxformCore::Vector3 axes[3] = { { 0.0, 0.0, 1.0 }, { 0.6, 0.8, 0.0 }, { 0.48, 0.6, 0.64 } };
+
+		MaxformCore::QuaternionBatch startQuats, endQuats;
+		std::vector<double> weights;
+
+		for (unsigned int arc = 1; arc <= 180; arc++)
+		{
+
+			for (unsigned int i = 0; i < 3; i++)
+			{
+
+				MaxformCore::Quaternion startQuat = MaxformCore::axisAngle({ 1.0, 0.0, 0.0 }, 0.3 * i);
+				MaxformCore::Quaternion endQuat = MaxformCore::multiply(startQuat, MaxformCore::axisAngle(axes[i], arc * (MaxformCore::PI / 180.0)));
+
+				for (unsigned int step = 1; step < 20; step++)
+				{
+
+					startQuats.push_back(startQuat);
+					endQuats.push_back(endQuat);
+					weights.push_back(step / 20.0);
+
+				}
+
+				// Relative layers may also extrapolate with negative or overshooting weights
+				//
+				for (double weight : { -1.0, -0.5, 1.5, 1.75 })
+				{
+
+					startQuats.push_back(startQuat);
+					endQuats.push_back(endQuat);
+					weights.push_back(weight);
+
+				}
+
+			}
+
+		}
+
+		// The exact slerp should travel the weighted arc while the approximations stay within their bounds
+		//
+		MaxformCore::QuaternionBatch quats;
+		size_t quatCount = startQuats.size();
+
+		for (unsigned int i = 0; i < 3; i++)
+		{
+
+			double maxError = 0.0;
+			bool isMatched = true;
+
+			MaxformCore::slerpBatch(startQuats, endQuats, weights, precisions[i], quats);
+
+			for (size_t j = 0; j < quatCount; j++)
+			{
+
+				MaxformCore::Quaternion quat = MaxformCore::slerp(startQuats[j], endQuats[j], weights[j], precisions[i]);
+				MaxformCore::Quaternion exactQuat = MaxformCore::slerp(startQuats[j], endQuats[j], weights[j], MaxformCore::SlerpPrecision::Exact);
+
+				double travelled = std::fmod(std::fabs(weights[j]) * angleBetween(startQuats[j], endQuats[j]), 360.0);
+				travelled = (travelled > 180.0) ? (360.0 - travelled) : travelled;
+
+				double error = (i == 0) ? std::fabs(angleBetween(startQuats[j], quat) - travelled) : angleBetween(quat, exactQuat);
+				maxError = std::max(maxError, error);
+
+				isMatched &= isClose(quats[j], quat, 1e-12);
+
+			}
+
+			check(quats.size() == quatCount && isMatched, std::string("slerp.") + precisionNames[i] + ".batch");
+			check(maxError <= maxErrors[i], std::string("slerp.") + precisionNames[i] + ".maxError");
+
+		}
+
+		// Opposite hemispheres should blend along the shortest arc while the weight limits return the inputs untouched
+		//
+		MaxformCore::Quaternion startQuat = MaxformCore::axisAngle({ 0.0, 1.0, 0.0 }, 0.2);
+		MaxformCore::Quaternion endQuat = MaxformCore::axisAngle({ 0.0, 1.0, 0.0 }, 0.8);
+		MaxformCore::Quaternion negatedQuat = { -endQuat.x, -endQuat.y, -endQuat.z, -endQuat.w };
+
+		for (unsigned int i = 0; i < 3; i++)
+		{
+
+			MaxformCore::slerpBatch({ startQuat, startQuat, startQuat }, { negatedQuat, negatedQuat, negatedQuat }, { 0.0, 0.5, 1.0 }, precisions[i], quats);
+
+			check(isClose(angleBetween(quats[1], MaxformCore::axisAngle({ 0.0, 1.0, 0.0 }, 0.5)), 0.0, maxErrors[i]), std::string("slerp.") + precisionNames[i] + ".shortestArc");
+			check(isClose(quats[0], startQuat, 0.0) && isClose(quats[2], negatedQuat, 0.0), std::string("slerp.") + precisionNames[i] + ".limits");
+
+		}
+
+	};
+
+	void testLogMaps()
+	/**
+	Tests the trig-free logarithm against the exact exponential and the slerp chain it replaces.
+
+	@return: Void.
+	*/
+	{
+
+		const MaxformCore::Vector3 axis = MaxformCore::normal(MaxformCore::Vector3{ 0.3, -0.5, 0.8 });
+		const MaxformCore::Quaternion identity = { 0.0, 0.0, 0.0, 1.0 };
+
+		// Round tripping through the exact exponential should stay within the documented bound for rotations up to 180 degrees
+		//
+		double maxError = 0.0;
+		double maxSlerpError = 0.0;
+
+		MaxformCore::QuaternionBatch quats;
+		std::vector<double> weights;
+
+		for (unsigned int angle = 0; angle <= 180; angle++)
+		{
+
+			MaxformCore::Quaternion quat = MaxformCore::axisAngle(axis, angle * (MaxformCore::PI / 180.0));
+			MaxformCore::Quaternion negatedQuat = { -quat.x, -quat.y, -quat.z, -quat.w };
+
+			maxError = std::max(maxError, angleBetween(MaxformCore::expMap(MaxformCore::logMap(quat)), quat));
+			maxError = std::max(maxError, angleBetween(MaxformCore::expMap(MaxformCore::logMap(negatedQuat)), quat));
+
+			MaxformCore::Quaternion slerpedQuat = MaxformCore::slerp(identity, negatedQuat, 0.35, MaxformCore::SlerpPrecision::Exact);
+			MaxformCore::Quaternion scaledQuat = MaxformCore::expMap(MaxformCore::scale(MaxformCore::logMap(negatedQuat), 0.35));
+
+			maxSlerpError = std::max(maxSlerpError, angleBetween(slerpedQuat, scaledQuat));
+
+			quats.push_back((angle % 2) ? negatedQuat : quat);
+			weights.push_back(std::sin(angle * 0.1));
+
+		}
+
+		check(maxError <= 1e-4, "logMap.maxError");
+		check(maxSlerpError <= 1e-4, "logMap.slerp");
+
+		// The vectorised sum should match the scalar logarithms, including the odd tail
+		//
+		MaxformCore::Vector3 expected = { 0.0, 0.0, 0.0 };
+
+		for (size_t i = 0; i < quats.size(); i++)
+		{
+
+			expected = MaxformCore::add(expected, MaxformCore::scale(MaxformCore::logMap(quats[i]), weights[i]));
+
+		}
+
+		check(isClose(MaxformCore::sumLogMaps(quats, weights), expected, 1e-12), "logMap.sumLogMaps");
+
+		// Layers that share an axis should match the slerp chain while perpendicular layers deviate by their commutator
+		//
+		MaxformCore::Quaternion xLayer = MaxformCore::axisAngle({ 1.0, 0.0, 0.0 }, 10.0 * (MaxformCore::PI / 180.0));
+		MaxformCore::Quaternion yLayer = MaxformCore::axisAngle({ 0.0, 1.0, 0.0 }, 10.0 * (MaxformCore::PI / 180.0));
+		MaxformCore::Quaternion axisLayer = MaxformCore::axisAngle(axis, 40.0 * (MaxformCore::PI / 180.0));
+
+		MaxformCore::Quaternion chain = MaxformCore::multiply(MaxformCore::slerp(identity, axisLayer, 0.5, MaxformCore::SlerpPrecision::Exact), MaxformCore::slerp(identity, axisLayer, 0.75, MaxformCore::SlerpPrecision::Exact));
+		MaxformCore::Quaternion logarithmic = MaxformCore::expMap(MaxformCore::sumLogMaps({ axisLayer, axisLayer }, { 0.5, 0.75 }));
+
+		check(angleBetween(chain, logarithmic) <= 2e-4, "logMap.sharedAxis");
+
+		chain = MaxformCore::multiply(xLayer, yLayer);
+		logarithmic = MaxformCore::expMap(MaxformCore::sumLogMaps({ xLayer, yLayer }, { 1.0, 1.0 }));
+
+		double deviation = angleBetween(chain, logarithmic);
+		check(deviation > 0.8 && deviation < 1.0, "logMap.commutator");
+
+	};
+
+	void testAverageQuaternions()
+	/**
+	Tests the eigenvector average against symmetric clusters, sign flips and ordering.
+
+	@return: Void.
+	*/
+	{
+
+		const MaxformCore::Vector3 axis = MaxformCore::normal(MaxformCore::Vector3{ 0.3, -0.5, 0.8 });
+		const MaxformCore::Quaternion identity = { 0.0, 0.0, 0.0, 1.0 };
+
+		// Two equally weighted rotations should average to their midpoint
+		//
+		MaxformCore::Quaternion start = MaxformCore::axisAngle(axis, 0.2);
+		MaxformCore::Quaternion end = MaxformCore::axisAngle(axis, 1.4);
+
+		MaxformCore::Quaternion midpoint = MaxformCore::slerp(start, end, 0.5, MaxformCore::SlerpPrecision::Exact);
+		check(angleBetween(MaxformCore::averageQuaternions({ start, end }, { 1.0, 1.0 }), midpoint) <= 1e-5, "averageQuaternions.midpoint");
+
+		// A symmetric cluster, large enough to cover every SIMD lane, should average back onto its centre regardless of sign and order
+		//
+		MaxformCore::Quaternion centre = MaxformCore::axisAngle(axis, 2.1);
+		MaxformCore::Vector3 offsetAxes[3] = { { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, 1.0 } };
+
+		MaxformCore::QuaternionBatch quats;
+		std::vector<double> weights;
+
+		for (unsigned int i = 0; i < 33; i++)
+		{
+
+			double angle = 0.05 * ((i / 3) + 1);
+			const MaxformCore::Vector3& offsetAxis = offsetAxes[i % 3];
+
+			MaxformCore::Quaternion positive = MaxformCore::multiply(MaxformCore::axisAngle(offsetAxis, angle), centre);
+			MaxformCore::Quaternion negative = MaxformCore::multiply(MaxformCore::axisAngle(offsetAxis, -angle), centre);
+
+			quats.push_back((i % 2) ? MaxformCore::Quaternion{ -positive.x, -positive.y, -positive.z, -positive.w } : positive);
+			quats.push_back(negative);
+
+			weights.push_back(1.0 + (i % 5));
+			weights.push_back(1.0 + (i % 5));
+
+		}
+
+		MaxformCore::Quaternion average = MaxformCore::averageQuaternions(quats, weights);
+		check(angleBetween(average, centre) <= 1e-5, "averageQuaternions.centre");
+
+		std::reverse(quats.begin(), quats.end());
+		std::reverse(weights.begin(), weights.end());
+
+		check(angleBetween(MaxformCore::averageQuaternions(quats, weights), average) <= 1e-5, "averageQuaternions.order");
+
+		// Non-positive weights should be ignored and an empty average should fall back onto identity
+		//
+		check(angleBetween(MaxformCore::averageQuaternions({ start, centre, end }, { 1.0, -2.0, 1.0 }), midpoint) <= 1e-5, "averageQuaternions.negativeWeight");
+		check(angleBetween(MaxformCore::averageQuaternions({ start, end }, { 0.0, 0.0 }), identity) == 0.0, "averageQuaternions.identity");
+
+	};
+
+	void testDualQuaternions()
+	/**
+	Tests the dual quaternion blend against the slerp blend it can replace on constraints.
+	The slerp blend lerps positions separately, so only the rotations are expected to agree!
+
+	@return: Void.
+	*/
+	{
+
+		const MaxformCore::Vector3 axis = MaxformCore::normal(MaxformCore::Vector3{ 0.3, -0.5, 0.8 });
+		const MaxformCore::Vector3 origin = { 0.0, 0.0, 0.0 };
+
+		MaxformCore::Quaternion start = MaxformCore::axisAngle(axis, 0.2);
+		MaxformCore::Quaternion end = MaxformCore::axisAngle(MaxformCore::Vector3{ 1.0, 0.0, 0.0 }, 1.8);
+
+		MaxformCore::Quaternion rotation;
+		MaxformCore::Vector3 position;
+
+		// Rotations should stay within the uncorrected nlerp error of the slerp blend, about 1.3 degrees for these targets 100 degrees apart, and match it at the midpoint
+		//
+		double maxError = 0.0;
+
+		for (unsigned int step = 0; step <= 100; step++)
+		{
+
+			double weight = step * 0.01;
+
+			MaxformCore::blendDualQuaternions({ start, end }, { origin, origin }, { 1.0 - weight, weight }, rotation, position);
+			maxError = std::max(maxError, angleBetween(rotation, MaxformCore::slerp(start, end, weight, MaxformCore::SlerpPrecision::Exact)));
+
+		}
+
+		MaxformCore::blendDualQuaternions({ start, end }, { origin, origin }, { 0.5, 0.5 }, rotation, position);
+
+		check(maxError <= 1.5, "dualQuaternion.slerp.maxError");
+		check(angleBetween(rotation, MaxformCore::slerp(start, end, 0.5, MaxformCore::SlerpPrecision::Exact)) <= 1e-5, "dualQuaternion.slerp.midpoint");
+		check(isClose(position, origin, 1e-12), "dualQuaternion.slerp.origin");
+
+		// Pure translations should match the lerp'd positions of the slerp blend
+		//
+		const MaxformCore::Quaternion identity = { 0.0, 0.0, 0.0, 1.0 };
+		const MaxformCore::Vector3 startPoint = { 1.0, 2.0, -3.0 };
+		const MaxformCore::Vector3 endPoint = { -4.0, 0.5, 6.0 };
+
+		MaxformCore::blendDualQuaternions({ identity, identity }, { startPoint, endPoint }, { 0.3, 0.7 }, rotation, position);
+		check(isClose(position, MaxformCore::add(MaxformCore::scale(startPoint, 0.3), MaxformCore::scale(endPoint, 0.7)), 1e-12), "dualQuaternion.translation");
+
+		// Rotations about a shared pivot should keep the pivot fixed whereas the slerp blend lets it drift
+		//
+		const MaxformCore::Vector3 pivot = { 2.0, -1.0, 3.0 };
+		MaxformCore::Matrix4 startMatrix, endMatrix, matrix;
+
+		MaxformCore::quaternionToMatrix(start, startMatrix);
+		MaxformCore::quaternionToMatrix(end, endMatrix);
+
+		MaxformCore::Vector3 startOffset = MaxformCore::subtract(pivot, MaxformCore::transformPoint(pivot, startMatrix));
+		MaxformCore::Vector3 endOffset = MaxformCore::subtract(pivot, MaxformCore::transformPoint(pivot, endMatrix));
+
+		MaxformCore::blendDualQuaternions({ start, end }, { startOffset, endOffset }, { 0.5, 0.5 }, rotation, position);
+		MaxformCore::quaternionToMatrix(rotation, matrix);
+
+		check(isClose(MaxformCore::add(MaxformCore::transformPoint(pivot, matrix), position), pivot, 1e-12), "dualQuaternion.pivot");
+
+		MaxformCore::Vector3 lerpedOffset = MaxformCore::scale(MaxformCore::add(startOffset, endOffset), 0.5);
+		check(MaxformCore::distanceBetween(MaxformCore::add(MaxformCore::transformPoint(pivot, matrix), lerpedOffset), pivot) > 0.1, "dualQuaternion.pivot.slerpDrift");
+
+		// Flipping the sign of a rotation should not change the blend
+		//
+		MaxformCore::Quaternion otherRotation;
+		MaxformCore::Vector3 otherPosition;
+
+		MaxformCore::blendDualQuaternions({ start, MaxformCore::Quaternion{ -end.x, -end.y, -end.z, -end.w } }, { startOffset, endOffset }, { 0.5, 0.5 }, otherRotation, otherPosition);
+		check(angleBetween(rotation, otherRotation) <= 1e-5 && isClose(position, otherPosition, 1e-12), "dualQuaternion.hemisphere");
+
+		check(!MaxformCore::blendDualQuaternions({}, {}, {}, rotation, position), "dualQuaternion.empty");
+
+	};
+
+	void testMatrices()
+	/**
+	Tests the matrix product, affine inverse and batch helpers.
+
+	@return: Void.
+	*/
+	{
+
+		MaxformCore::Matrix4 matrix;
+		MaxformCore::quaternionToMatrix(MaxformCore::axisAngle(MaxformCore::normal(MaxformCore::Vector3{ 0.2, 1.0, -0.4 }), 1.1), matrix);
+
+		matrix.rows[0][0] *= 2.0;
+		matrix.rows[3][0] = 4.0;
+		matrix.rows[3][1] = -2.0;
+		matrix.rows[3][2] = 0.5;
+
+		MaxformCore::Matrix4 identity = {{ { 1.0, 0.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0, 0.0 }, { 0.0, 0.0, 0.0, 1.0 } }};
+		MaxformCore::Matrix4 inverse, product;
+
+		bool isInverted = MaxformCore::affineInverse(matrix, inverse);
+		MaxformCore::multiply(matrix, inverse, product);
+
+		check(isInverted && isClose(product, identity, 1e-12), "matrix.affineInverse");
+
+		MaxformCore::Matrix4 projective = identity;
+		projective.rows[0][3] = 0.5;
+
+		check(!MaxformCore::affineInverse(projective, inverse), "matrix.affineInverse.projective");
+
+		MaxformCore::Vector3 point = { 1.0, 2.0, 3.0 };
+		MaxformCore::Vector3 transformed = MaxformCore::transformPoint(point, matrix);
+
+		check(isClose(MaxformCore::transformPoint(transformed, inverse), point, 1e-12), "matrix.transformPoint");
+
+		// The vectorised inverse should match the cofactor inverse of a known scaled and translated matrix
+		//
+		MaxformCore::Matrix4 scaled = {{ { 0.0, 2.0, 0.0, 0.0 }, { -4.0, 0.0, 0.0, 0.0 }, { 0.0, 0.0, 0.5, 0.0 }, { 1.0, 2.0, 3.0, 1.0 } }};
+		MaxformCore::Matrix4 expected = {{ { 0.0, -0.25, 0.0, 0.0 }, { 0.5, 0.0, 0.0, 0.0 }, { 0.0, 0.0, 2.0, 0.0 }, { -1.0, 0.25, -6.0, 1.0 } }};
+
+		isInverted = MaxformCore::affineInverse(scaled, inverse);
+		check(isInverted && isClose(inverse, expected, 1e-15), "matrix.affineInverse.scaled");
+
+		MaxformCore::Matrix4 singular = scaled;
+		singular.rows[2][2] = 0.0;
+
+		check(!MaxformCore::affineInverse(singular, inverse), "matrix.affineInverse.singular");
+
+		// Batch point kernels should match the single point kernel
+		//
+		std::vector<MaxformCore::Vector3> points = { point, transformed, { -1.0, 0.0, 0.5 } };
+		std::vector<MaxformCore::Vector3> expectedPoints = points;
+
+		for (MaxformCore::Vector3& expectedPoint : expectedPoints)
+		{
+
+			expectedPoint = MaxformCore::transformPoint(expectedPoint, matrix);
+
+		}
+
+		MaxformCore::transformPoints(points, matrix);
+		checkPoints(points, expectedPoints, 1e-12, "matrix.transformPoints");
+
+		std::vector<MaxformCore::Vector3> positions;
+		MaxformCore::transformPoints(MaxformCore::MatrixBatch{ matrix, scaled }, MaxformCore::Vector3{ 0.0, 0.0, 0.0 }, positions);
+
+		checkPoints(positions, { { 4.0, -2.0, 0.5 }, { 1.0, 2.0, 3.0 } }, 0.0, "matrix.transformPoints.origin");
+
+		// Staggering then expanding a batch should round trip
+		//
+		MaxformCore::MatrixBatch worldMatrices = { matrix, matrix, matrix };
+		MaxformCore::multiplyBatch(matrix, worldMatrices);
+
+		MaxformCore::MatrixBatch localMatrices;
+		bool isStaggered = MaxformCore::staggerBatch(worldMatrices, localMatrices);
+
+		MaxformCore::expandBatch(localMatrices);
+
+		check(isStaggered && isClose(localMatrices[2], worldMatrices[2], 1e-9), "matrix.staggerBatch");
+
+	};
+
+};
+
+
+int main()
+{
+
+	testSolveTriangle();
+	testLineSphereIntersection();
+	testFitChain();
+	testFabrik();
+	testCompressPoints();
+	testQuaternions();
+	testSlerp();
+	testLogMaps();
+	testAverageQuaternions();
+	testDualQuaternions();
+	testMatrices();
+
+	std::printf("%u/%u checks passed\n", checkCount - failureCount, checkCount);
+
+	return (failureCount == 0) ? 0 : 1;
+
+};